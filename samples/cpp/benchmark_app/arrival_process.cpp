@@ -0,0 +1,118 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "arrival_process.hpp"
+
+#include <fstream>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "samples/common.hpp"
+
+namespace {
+
+class ConstantArrivalProcess : public ArrivalProcess {
+public:
+    explicit ConstantArrivalProcess(double rate) : _rate(rate) {}
+
+    bool next(ns& arrival_time) override {
+        arrival_time = ns(static_cast<int64_t>(_count++ * 1.0e9 / _rate));
+        return true;
+    }
+
+    std::string get_description() const override {
+        return "constant, " + double_to_string(_rate) + " requests/s";
+    }
+
+private:
+    double _rate;
+    uint64_t _count = 0;
+};
+
+class PoissonArrivalProcess : public ArrivalProcess {
+public:
+    explicit PoissonArrivalProcess(double rate) : _rate(rate), _interval(rate) {}
+
+    bool next(ns& arrival_time) override {
+        arrival_time = ns(static_cast<int64_t>(_time * 1.0e9));
+        _time += _interval(_generator);
+        return true;
+    }
+
+    std::string get_description() const override {
+        return "poisson, " + double_to_string(_rate) + " requests/s";
+    }
+
+private:
+    double _rate;
+    double _time = 0;
+    // the fixed seed makes the runs reproducible
+    std::mt19937_64 _generator{0};
+    std::exponential_distribution<double> _interval;
+};
+
+class ReplayArrivalProcess : public ArrivalProcess {
+public:
+    explicit ReplayArrivalProcess(const std::string& file_path) : _file_path(file_path) {
+        std::ifstream file(file_path);
+        if (!file.is_open()) {
+            throw std::logic_error("Can't open the arrival times file " + file_path);
+        }
+        double time_ms = 0;
+        while (file >> time_ms) {
+            if (time_ms < 0 || (!_times.empty() && time_ms < _times.back())) {
+                throw std::logic_error("The arrival times in " + file_path +
+                                       " must be non-negative and non-decreasing");
+            }
+            _times.push_back(time_ms);
+        }
+        if (!file.eof()) {
+            throw std::logic_error("Can't parse the arrival times file " + file_path);
+        }
+        if (_times.empty()) {
+            throw std::logic_error("The arrival times file " + file_path + " is empty");
+        }
+    }
+
+    bool next(ns& arrival_time) override {
+        if (_index == _times.size()) {
+            return false;
+        }
+        // the times are replayed from the first arrival
+        arrival_time = ns(static_cast<int64_t>((_times[_index++] - _times.front()) * 1.0e6));
+        return true;
+    }
+
+    std::string get_description() const override {
+        return "replay of " + std::to_string(_times.size()) + " arrivals from " + _file_path;
+    }
+
+private:
+    std::string _file_path;
+    std::vector<double> _times;
+    size_t _index = 0;
+};
+
+}  // namespace
+
+ArrivalProcess::Ptr create_arrival_process(const std::string& type, double rate, const std::string& file_path) {
+    if (type == "constant" || type == "poisson") {
+        if (rate <= 0) {
+            throw std::logic_error("The arrival rate must be positive for the " + type + " arrival process.");
+        }
+        if (type == "constant") {
+            return std::make_unique<ConstantArrivalProcess>(rate);
+        }
+        return std::make_unique<PoissonArrivalProcess>(rate);
+    }
+    if (type == "replay") {
+        if (file_path.empty()) {
+            throw std::logic_error("The arrival times file is required for the replay arrival process.");
+        }
+        return std::make_unique<ReplayArrivalProcess>(file_path);
+    }
+    throw std::logic_error("Incorrect arrival process " + type +
+                           ". Please set -arrival option to `constant`, `poisson` or `replay` value.");
+}
@@ -0,0 +1,31 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "utils.hpp"
+
+/// @brief Generates the arrival times of the inference requests for the open-loop benchmarking, the requests are
+/// started at these times regardless of the completion of the previous ones
+class ArrivalProcess {
+public:
+    using Ptr = std::unique_ptr<ArrivalProcess>;
+
+    virtual ~ArrivalProcess() = default;
+
+    /// @brief Returns false if there are no more arrivals, otherwise sets the time of the next one
+    /// since the start of the benchmarking
+    virtual bool next(ns& arrival_time) = 0;
+
+    virtual std::string get_description() const = 0;
+};
+
+/// @brief Creates the arrival process by its type:
+///   "constant" - the requests arrive with the fixed interval 1 / rate,
+///   "poisson" - the intervals are exponentially distributed with the mean 1 / rate,
+///   "replay" - the arrival times in milliseconds are read from the file, one per line.
+ArrivalProcess::Ptr create_arrival_process(const std::string& type, double rate, const std::string& file_path);
@@ -71,6 +71,49 @@ static const char maximum_inference_rate_message[] =
     "If not specified, default value is 0, the inference will run at maximum rate depending on a device capabilities. "
     "Tweaking this value allow better accuracy in power usage measurement by limiting the execution.";
 
+/// @brief message for open-loop arrival process
+static const char arrival_message[] =
+    "Optional. Enables the open-loop load: the inference requests are started at the arrival times regardless "
+    "of the completion of the previous ones, and the latency is measured from the arrival, so the queueing delay "
+    "is included.\n"
+    "                              'constant': the requests arrive with the fixed interval 1 / -arrival_rate.\n"
+    "                              'poisson': the intervals are exponentially distributed with the mean "
+    "1 / -arrival_rate.\n"
+    "                              'replay': the arrival times in milliseconds are read from -arrival_file, one "
+    "per line.\n"
+    "                              Requires async API.";
+
+/// @brief message for open-loop arrival rate
+static const char arrival_rate_message[] =
+    "Optional. The mean number of the request arrivals per second for the 'constant' and 'poisson' -arrival.";
+
+/// @brief message for open-loop arrival times file
+static const char arrival_file_message[] = "Optional. Path to a file with the arrival times for the 'replay' -arrival.";
+
+/// @brief message for latency SLA
+static const char sla_message[] =
+    "Optional. Latency service level in milliseconds, the number of the requests exceeding it is reported "
+    "for the open-loop load.";
+
+/// @brief message for LLM mode
+static const char llm_message[] =
+    "Optional. Benchmark a stateful LLM: each prompt is prefilled and followed by the single token decode steps, "
+    "time to first token, inter-token latency, tokens/s and KV cache size are reported for each batch size "
+    "and prompt length.";
+
+/// @brief message for LLM prompt lengths
+static const char prompt_len_message[] =
+    "Optional. Comma separated prompt lengths in tokens swept in LLM mode, e.g. \"128,1024,4096\". Default is 128.";
+
+/// @brief message for LLM batch sizes
+static const char llm_batch_message[] =
+    "Optional. Comma separated batch sizes of the prompts swept in LLM mode, e.g. \"1,4\". Default is 1.";
+
+/// @brief message for LLM generated tokens
+static const char new_tokens_message[] =
+    "Optional. Number of the tokens generated for each prompt in LLM mode including the first one. Default is 32. "
+    "Each generation is repeated -niter times.";
+
 /// @brief message for execution time
 static const char execution_time_message[] = "Optional. Time in seconds to execute topology.";
 
@@ -93,6 +136,16 @@ static const char data_shape_message[] =
     " or \"input1[1,192][1,384],input2[1,192][1,384],input3[1,192][1,384],input4[1,192][1,384]\"."
     " If model shapes are all static specifying the option will cause an exception.";
 
+static const char shape_trace_message[] =
+    "Optional. Path to the file with a sequence of input data shapes for models with dynamic shapes, replaces"
+    " -data_shape. Each line sets the shapes of one inference in -data_shape format,"
+    " e.g. \"input1[1,37],input2[1,37]\", optionally followed by the number of its occurrences,"
+    " so the file may be a recorded trace or a histogram.";
+
+static const char shape_trace_mode_message[] =
+    "Optional. How the shapes of -shape_trace are used: \"replay\" (default) repeats the trace in the file order,"
+    " \"sample\" draws the shapes randomly with the probabilities proportional to their occurrences.";
+
 static const char layout_message[] =
     "Optional. Prompts how model layouts should be treated by application. "
     "For example, \"input1[NCHW],input2[NC]\" or \"[NCHW]\" in case of one input size.";
@@ -220,7 +273,8 @@ static const char pc_sort_message[] =
     " \"simple_sort\" Analysis opts time cost, only print EXECUTED opts by normal order";
 
 // @brief message for performance counters for sequence option
-static const char pcseq_message[] = "Optional. Report latencies for each shape in -data_shape sequence.";
+static const char pcseq_message[] =
+    "Optional. Report latencies for each shape in -data_shape sequence or for each distinct shape of -shape_trace.";
 
 // @brief message for exec_graph_path option
 static const char exec_graph_path_message[] =
@@ -291,6 +345,12 @@ DEFINE_string(shape, "", shape_message);
 /// @brief Define flag for input blob shape <br>
 DEFINE_string(data_shape, "", data_shape_message);
 
+/// @brief Define flag for input data shape trace <br>
+DEFINE_string(shape_trace, "", shape_trace_message);
+
+/// @brief Define flag for the way the input data shape trace is used <br>
+DEFINE_string(shape_trace_mode, "replay", shape_trace_mode_message);
+
 /// @brief Define flag for layout shape <br>
 DEFINE_string(layout, "", layout_message);
 
@@ -317,6 +377,30 @@ DEFINE_uint64(nireq, 0, infer_requests_count_message);
 /// @brief Execute infer requests at a fixed frequency
 DEFINE_double(max_irate, 0, maximum_inference_rate_message);
 
+/// @brief Define parameter for open-loop arrival process <br>
+DEFINE_string(arrival, "", arrival_message);
+
+/// @brief Define parameter for open-loop arrival rate <br>
+DEFINE_double(arrival_rate, 0, arrival_rate_message);
+
+/// @brief Define parameter for open-loop arrival times file <br>
+DEFINE_string(arrival_file, "", arrival_file_message);
+
+/// @brief Define parameter for latency SLA <br>
+DEFINE_double(sla, 0, sla_message);
+
+/// @brief Define flag for LLM mode <br>
+DEFINE_bool(llm, false, llm_message);
+
+/// @brief Define parameter for LLM prompt lengths <br>
+DEFINE_string(prompt_len, "128", prompt_len_message);
+
+/// @brief Define parameter for LLM batch sizes <br>
+DEFINE_string(llm_batch, "1", llm_batch_message);
+
+/// @brief Define parameter for LLM generated tokens <br>
+DEFINE_uint32(new_tokens, 32, new_tokens_message);
+
 /// @brief Number of streams to use for inference on the CPU (also affects Hetero cases)
 DEFINE_string(nstreams, "", infer_num_streams_message);
 
@@ -403,13 +487,24 @@ static void show_usage() {
     std::cout << "    -niter  <integer>             " << iterations_count_message << std::endl;
     std::cout << "    -max_irate \"<float>\"        " << maximum_inference_rate_message << std::endl;
     std::cout << "    -t                            " << execution_time_message << std::endl;
+    std::cout << "    -arrival <constant/poisson/replay> " << arrival_message << std::endl;
+    std::cout << "    -arrival_rate \"<float>\"     " << arrival_rate_message << std::endl;
+    std::cout << "    -arrival_file <path>          " << arrival_file_message << std::endl;
     std::cout << std::endl;
     std::cout << "Input shapes" << std::endl;
     std::cout << "    -b  <integer>                 " << batch_size_message << std::endl;
     std::cout << "    -shape                        " << shape_message << std::endl;
     std::cout << "    -data_shape                   " << data_shape_message << std::endl;
+    std::cout << "    -shape_trace <path>           " << shape_trace_message << std::endl;
+    std::cout << "    -shape_trace_mode <replay/sample> " << shape_trace_mode_message << std::endl;
     std::cout << "    -layout                       " << layout_message << std::endl;
     std::cout << std::endl;
+    std::cout << "LLM options" << std::endl;
+    std::cout << "    -llm                          " << llm_message << std::endl;
+    std::cout << "    -prompt_len \"<integer list>\" " << prompt_len_message << std::endl;
+    std::cout << "    -llm_batch \"<integer list>\" " << llm_batch_message << std::endl;
+    std::cout << "    -new_tokens <integer>         " << new_tokens_message << std::endl;
+    std::cout << std::endl;
     std::cout << "Advanced options" << std::endl;
     std::cout << "    -extensions  <absolute_path>  " << custom_extensions_library_message << std::endl;
     std::cout << "    -c  <absolute_path>           " << custom_cldnn_message << std::endl;
@@ -436,6 +531,7 @@ static void show_usage() {
     std::cout << std::endl;
     std::cout << "Statistics dumping options:" << std::endl;
     std::cout << "    -latency_percentile     " << infer_latency_percentile_message << std::endl;
+    std::cout << "    -sla  <float>           " << sla_message << std::endl;
     std::cout << "    -report_type  <type>    " << report_type_message << std::endl;
     std::cout << "    -report_folder          " << report_folder_message << std::endl;
     std::cout << "    -json_stats             " << json_stats_message << std::endl;
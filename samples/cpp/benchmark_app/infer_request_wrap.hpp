@@ -50,6 +50,12 @@ public:
         _request.start_async();
     }
 
+    // the latency is measured from the arrival of the request, which may be earlier than the start
+    void start_async(Time::time_point arrival_time) {
+        _startTime = arrival_time;
+        _request.start_async();
+    }
+
     void wait() {
         _request.wait();
     }
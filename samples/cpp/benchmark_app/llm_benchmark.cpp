@@ -0,0 +1,279 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "llm_benchmark.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <numeric>
+#include <stdexcept>
+
+#include "openvino/runtime/intel_cpu/properties.hpp"
+#include "samples/common.hpp"
+#include "samples/latency_metrics.hpp"
+#include "samples/slog.hpp"
+#include "utils.hpp"
+
+namespace {
+
+enum class LlmInput { INPUT_IDS, ATTENTION_MASK, POSITION_IDS, TOKEN_TYPE_IDS, BEAM_IDX };
+
+LlmInput get_llm_input(const ov::Output<const ov::Node>& input) {
+    static const std::map<std::string, LlmInput> llm_inputs = {{"input_ids", LlmInput::INPUT_IDS},
+                                                               {"attention_mask", LlmInput::ATTENTION_MASK},
+                                                               {"position_ids", LlmInput::POSITION_IDS},
+                                                               {"token_type_ids", LlmInput::TOKEN_TYPE_IDS},
+                                                               {"beam_idx", LlmInput::BEAM_IDX}};
+    for (const auto& name : input.get_names()) {
+        const auto found = llm_inputs.find(name);
+        if (found != llm_inputs.end()) {
+            return found->second;
+        }
+    }
+    throw std::logic_error("Input \"" + input.get_any_name() +
+                           "\" is not supported in LLM mode. The supported inputs are input_ids, attention_mask, "
+                           "position_ids, token_type_ids and beam_idx.");
+}
+
+ov::Shape get_llm_input_shape(LlmInput llm_input, size_t batch_size, size_t past_length, size_t length) {
+    switch (llm_input) {
+    case LlmInput::ATTENTION_MASK:
+        return {batch_size, past_length + length};
+    case LlmInput::BEAM_IDX:
+        return {batch_size};
+    default:
+        return {batch_size, length};
+    }
+}
+
+template <typename T>
+void fill_tensor(ov::Tensor& tensor, const std::function<int64_t(size_t)>& value) {
+    auto data = tensor.data<T>();
+    for (size_t i = 0; i < tensor.get_size(); ++i) {
+        data[i] = static_cast<T>(value(i));
+    }
+}
+
+ov::Tensor create_tensor(const ov::element::Type& type,
+                         const ov::Shape& shape,
+                         const std::function<int64_t(size_t)>& value) {
+    ov::Tensor tensor(type, shape);
+    if (type == ov::element::i64) {
+        fill_tensor<int64_t>(tensor, value);
+    } else if (type == ov::element::i32) {
+        fill_tensor<int32_t>(tensor, value);
+    } else {
+        throw std::logic_error("Precision " + type.get_type_name() + " of LLM inputs is not supported.");
+    }
+    return tensor;
+}
+
+}  // namespace
+
+LlmBenchmark::LlmBenchmark(ov::CompiledModel& compiled_model)
+    : _compiled_model(compiled_model),
+      _request(compiled_model.create_infer_request()),
+      _inputs(compiled_model.inputs()),
+      _vocab_size(1000),
+      _has_kv_cache_size(false) {
+    for (const auto& input : _inputs) {
+        get_llm_input(input);
+    }
+    if (_request.query_state().empty()) {
+        throw std::logic_error("LLM mode requires a stateful model keeping the KV cache in the variables.");
+    }
+    // the generated token ids must be valid for the embeddings
+    const auto& logits_shape = compiled_model.output(0).get_partial_shape();
+    if (logits_shape.rank().is_static() && logits_shape.size() > 0 && logits_shape.rbegin()->is_static()) {
+        _vocab_size = std::min<size_t>(_vocab_size, logits_shape.rbegin()->get_length());
+    }
+    // the memory of the KV cache is known to the plugin only: the cache may be quantized and it has the spare room for
+    // the next tokens, so the size of the state tensors doesn't tell it
+    const auto supported_properties = compiled_model.get_property(ov::supported_properties);
+    _has_kv_cache_size = std::find(supported_properties.begin(),
+                                   supported_properties.end(),
+                                   ov::intel_cpu::kv_cache_memory_size.name()) != supported_properties.end();
+}
+
+std::string LlmBenchmark::get_data_shapes(const std::vector<ov::Output<const ov::Node>>& inputs,
+                                          size_t batch_size,
+                                          size_t prompt_length) {
+    std::string data_shapes;
+    for (const auto& input : inputs) {
+        if (!data_shapes.empty()) {
+            data_shapes += ",";
+        }
+        const auto shape = get_llm_input_shape(get_llm_input(input), batch_size, 0, prompt_length);
+        data_shapes += input.get_any_name() + ov::PartialShape(shape).to_string();
+    }
+    return data_shapes;
+}
+
+void LlmBenchmark::set_inputs(size_t batch_size, size_t past_length, size_t length) {
+    for (const auto& input : _inputs) {
+        const auto llm_input = get_llm_input(input);
+        const auto shape = get_llm_input_shape(llm_input, batch_size, past_length, length);
+        std::function<int64_t(size_t)> value;
+        switch (llm_input) {
+        case LlmInput::INPUT_IDS:
+            value = [&](size_t i) {
+                return static_cast<int64_t>(1 + (past_length + i) % (_vocab_size - 1));
+            };
+            break;
+        case LlmInput::ATTENTION_MASK:
+            value = [](size_t) {
+                return 1;
+            };
+            break;
+        case LlmInput::POSITION_IDS:
+            value = [&](size_t i) {
+                return static_cast<int64_t>(past_length + i % length);
+            };
+            break;
+        case LlmInput::TOKEN_TYPE_IDS:
+            value = [](size_t) {
+                return 0;
+            };
+            break;
+        case LlmInput::BEAM_IDX:
+            value = [](size_t i) {
+                return static_cast<int64_t>(i);
+            };
+            break;
+        }
+        _request.set_tensor(input, create_tensor(input.get_element_type(), shape, value));
+    }
+}
+
+LlmGenerationResult LlmBenchmark::generate(size_t batch_size, size_t prompt_length, size_t new_tokens) {
+    LlmGenerationResult result{batch_size, prompt_length, 0, {}, 0};
+    _request.reset_state();
+
+    // the prefill of the prompts produces the first tokens
+    set_inputs(batch_size, 0, prompt_length);
+    auto start_time = Time::now();
+    _request.infer();
+    result.first_token_latency = get_duration_ms_till_now(start_time);
+
+    for (size_t i = 1; i < new_tokens; ++i) {
+        set_inputs(batch_size, prompt_length + i - 1, 1);
+        start_time = Time::now();
+        _request.infer();
+        result.token_latencies.push_back(get_duration_ms_till_now(start_time));
+    }
+
+    if (_has_kv_cache_size) {
+        result.kv_cache_size = static_cast<size_t>(_compiled_model.get_property(ov::intel_cpu::kv_cache_memory_size));
+    }
+    return result;
+}
+
+std::string LlmGenerationStatistics::Group::get_name() const {
+    return "batch " + std::to_string(batch_size) + ", prompt " + std::to_string(prompt_length);
+}
+
+double LlmGenerationStatistics::Group::get_tokens_per_second() const {
+    const auto duration = std::accumulate(token_latencies.begin(), token_latencies.end(), 0.0);
+    return duration > 0 ? 1000.0 * batch_size * token_latencies.size() / duration : 0;
+}
+
+LlmGenerationStatistics::LlmGenerationStatistics(const std::vector<LlmGenerationResult>& results) {
+    for (const auto& result : results) {
+        auto group = std::find_if(_groups.begin(), _groups.end(), [&](const Group& group) {
+            return group.batch_size == result.batch_size && group.prompt_length == result.prompt_length;
+        });
+        if (group == _groups.end()) {
+            _groups.emplace_back();
+            group = std::prev(_groups.end());
+            group->batch_size = result.batch_size;
+            group->prompt_length = result.prompt_length;
+        }
+        ++group->generations;
+        group->first_token_latency += result.first_token_latency;
+        group->token_latencies.insert(group->token_latencies.end(),
+                                      result.token_latencies.begin(),
+                                      result.token_latencies.end());
+        group->kv_cache_size = std::max(group->kv_cache_size, result.kv_cache_size);
+    }
+    for (auto& group : _groups) {
+        group.first_token_latency /= group.generations;
+    }
+}
+
+StatisticsReport::Parameters LlmGenerationStatistics::get_parameters() const {
+    StatisticsReport::Parameters parameters;
+    for (const auto& group : _groups) {
+        const auto csv_prefix = group.get_name() + ": ";
+        const auto json_prefix =
+            "llm_b" + std::to_string(group.batch_size) + "_p" + std::to_string(group.prompt_length) + "_";
+        parameters.emplace_back(csv_prefix + "time to first token (ms)",
+                                json_prefix + "first_token_latency",
+                                group.first_token_latency);
+        if (!group.token_latencies.empty()) {
+            parameters.emplace_back(csv_prefix + "inter-token latency (ms)",
+                                    json_prefix + "token_latency",
+                                    LatencyMetrics(group.token_latencies).avg);
+            parameters.emplace_back(csv_prefix + "throughput (tokens/s)",
+                                    json_prefix + "throughput",
+                                    group.get_tokens_per_second());
+        }
+        if (group.kv_cache_size > 0) {
+            parameters.emplace_back(csv_prefix + "KV cache size (bytes)",
+                                    json_prefix + "kv_cache_size",
+                                    static_cast<unsigned long long>(group.kv_cache_size));
+        }
+    }
+    return parameters;
+}
+
+StatisticsReport::Parameters LlmGenerationStatistics::get_groupped_parameters() const {
+    StatisticsReport::Parameters parameters;
+    for (const auto& group : _groups) {
+        if (!group.token_latencies.empty()) {
+            parameters.emplace_back("Inter-token latencies",
+                                    "token_latencies",
+                                    LatencyMetrics(group.token_latencies, group.get_name()));
+        }
+    }
+    return parameters;
+}
+
+void LlmGenerationStatistics::write_to_slog() const {
+    for (const auto& group : _groups) {
+        slog::info << "Batch " << group.batch_size << ", prompt " << group.prompt_length << " tokens:" << slog::endl;
+        slog::info << "   Time to first token: " << double_to_string(group.first_token_latency) << " ms"
+                   << slog::endl;
+        if (!group.token_latencies.empty()) {
+            slog::info << "   Inter-token latency:" << slog::endl;
+            LatencyMetrics(group.token_latencies).write_to_slog();
+            slog::info << "   Throughput:          " << double_to_string(group.get_tokens_per_second())
+                       << " tokens/s" << slog::endl;
+        }
+        if (group.kv_cache_size > 0) {
+            slog::info << "   KV cache size:       " << double_to_string(group.kv_cache_size / (1024.0 * 1024.0))
+                       << " MB" << slog::endl;
+        }
+    }
+}
+
+std::vector<size_t> parse_sizes(const std::string& sizes_string, const std::string& option_name) {
+    std::vector<size_t> sizes;
+    for (const auto& size_string : split(sizes_string, ',')) {
+        size_t size = 0;
+        try {
+            size = std::stoul(size_string);
+        } catch (const std::exception&) {
+        }
+        if (size == 0) {
+            throw std::logic_error("Can't parse " + option_name + " option value \"" + sizes_string +
+                                   "\", it must be a comma separated list of positive integers.");
+        }
+        sizes.push_back(size);
+    }
+    if (sizes.empty()) {
+        throw std::logic_error(option_name + " option value must not be empty.");
+    }
+    return sizes;
+}
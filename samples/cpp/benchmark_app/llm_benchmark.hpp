@@ -0,0 +1,74 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "openvino/openvino.hpp"
+#include "statistics_report.hpp"
+
+/// @brief Latencies of the generation for one batch of the prompts
+struct LlmGenerationResult {
+    size_t batch_size;
+    size_t prompt_length;
+    double first_token_latency;           // ms, the prefill of the prompts
+    std::vector<double> token_latencies;  // ms, each single token decode step
+    size_t kv_cache_size;                 // bytes held by the KV cache at the end of the generation, 0 if unknown
+};
+
+/// @brief Drives a stateful LLM through the prefill of the prompts followed by the single token decode steps.
+/// The inputs input_ids, attention_mask, position_ids, token_type_ids and beam_idx are filled the way the generation
+/// pipelines do, the generated tokens aren't sampled from the logits since it doesn't change the latencies.
+class LlmBenchmark {
+public:
+    explicit LlmBenchmark(ov::CompiledModel& compiled_model);
+
+    /// @brief Returns -data_shape string of the inputs of the prefill, so the model can be benchmarked by other modes
+    static std::string get_data_shapes(const std::vector<ov::Output<const ov::Node>>& inputs,
+                                       size_t batch_size,
+                                       size_t prompt_length);
+
+    /// @brief Generates new_tokens tokens after the prompts, the state of the previous generation is reset
+    LlmGenerationResult generate(size_t batch_size, size_t prompt_length, size_t new_tokens);
+
+private:
+    void set_inputs(size_t batch_size, size_t past_length, size_t length);
+
+    ov::CompiledModel _compiled_model;
+    ov::InferRequest _request;
+    std::vector<ov::Output<const ov::Node>> _inputs;
+    size_t _vocab_size;
+    bool _has_kv_cache_size;
+};
+
+/// @brief Time to the first token, inter-token latency and tokens per second for each batch size and prompt length
+class LlmGenerationStatistics {
+public:
+    /// @param results are the results of all the generations, grouped by the batch size and the prompt length
+    explicit LlmGenerationStatistics(const std::vector<LlmGenerationResult>& results);
+
+    StatisticsReport::Parameters get_parameters() const;
+    /// @brief Returns the inter-token latencies of each group
+    StatisticsReport::Parameters get_groupped_parameters() const;
+    void write_to_slog() const;
+
+private:
+    struct Group {
+        size_t batch_size = 0;
+        size_t prompt_length = 0;
+        size_t generations = 0;
+        double first_token_latency = 0;  // ms, average
+        std::vector<double> token_latencies;
+        size_t kv_cache_size = 0;
+
+        std::string get_name() const;
+        double get_tokens_per_second() const;
+    };
+    std::vector<Group> _groups;
+};
+
+/// @brief Parses the comma separated list of the positive sizes, e.g. "128,512,2048"
+std::vector<size_t> parse_sizes(const std::string& sizes_string, const std::string& option_name);
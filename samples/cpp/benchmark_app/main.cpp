@@ -14,6 +14,7 @@
 // clang-format off
 #include "openvino/openvino.hpp"
 #include "openvino/pass/serialize.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
 
 #ifndef IN_OV_COMPONENT
 #    define IN_OV_COMPONENT
@@ -29,10 +30,13 @@
 #include "samples/common.hpp"
 #include "samples/slog.hpp"
 
+#include "arrival_process.hpp"
 #include "benchmark_app.hpp"
 #include "infer_request_wrap.hpp"
 #include "inputs_filling.hpp"
+#include "llm_benchmark.hpp"
 #include "remote_tensors_filling.hpp"
+#include "shape_trace.hpp"
 #include "statistics_report.hpp"
 #include "utils.hpp"
 
@@ -141,11 +145,36 @@ bool parse_and_check_command_line(int argc, char* argv[]) {
         throw std::logic_error("The percentile value is incorrect. The applicable values range is [1, 100].");
     }
     if (FLAGS_api == "") {
-        FLAGS_api = FLAGS_hint == "latency" ? "sync" : "async";
+        FLAGS_api = FLAGS_hint == "latency" && FLAGS_arrival.empty() ? "sync" : "async";
     }
     if (FLAGS_api != "async" && FLAGS_api != "sync") {
         throw std::logic_error("Incorrect API. Please set -api option to `sync` or `async` value.");
     }
+    if (!FLAGS_arrival.empty()) {
+        if (FLAGS_api == "sync") {
+            throw std::logic_error("The open-loop load set by -arrival option requires async API.");
+        }
+        if (FLAGS_max_irate > 0) {
+            throw std::logic_error("-arrival and -max_irate options can't be used together.");
+        }
+    }
+    if (FLAGS_sla < 0) {
+        throw std::logic_error("The latency SLA set by -sla option must be non-negative.");
+    }
+    if (!FLAGS_shape_trace.empty() && !FLAGS_data_shape.empty()) {
+        throw std::logic_error("-shape_trace and -data_shape options can't be used together.");
+    }
+    if (FLAGS_llm && (!FLAGS_data_shape.empty() || !FLAGS_shape_trace.empty() || !FLAGS_arrival.empty())) {
+        throw std::logic_error("-llm option can't be used together with -data_shape, -shape_trace and -arrival "
+                               "options, the input shapes and the arrivals are set by LLM mode.");
+    }
+    if (FLAGS_llm && FLAGS_new_tokens == 0) {
+        throw std::logic_error("The number of the generated tokens set by -new_tokens option must be positive.");
+    }
+    if (FLAGS_shape_trace_mode != "replay" && FLAGS_shape_trace_mode != "sample") {
+        throw std::logic_error("Incorrect shape trace mode. Please set -shape_trace_mode option to `replay` or "
+                               "`sample` value.");
+    }
     if (FLAGS_api == "sync") {
         if ((FLAGS_t == 0) && (FLAGS_nireq > FLAGS_niter)) {
             throw std::logic_error(
@@ -345,6 +374,32 @@ int main(int argc, char* argv[]) {
             return 0;
         }
 
+        ArrivalProcess::Ptr arrival_process;
+        if (!FLAGS_arrival.empty()) {
+            arrival_process = create_arrival_process(FLAGS_arrival, FLAGS_arrival_rate, FLAGS_arrival_file);
+        }
+        ShapeTrace::Ptr shape_trace;
+        if (!FLAGS_shape_trace.empty()) {
+            shape_trace = std::make_unique<ShapeTrace>(FLAGS_shape_trace, FLAGS_shape_trace_mode == "sample");
+            slog::info << "Input data shapes: " << shape_trace->get_description() << slog::endl;
+        }
+        std::vector<size_t> llm_batch_sizes;
+        std::vector<size_t> llm_prompt_lengths;
+        if (FLAGS_llm) {
+            llm_batch_sizes = parse_sizes(FLAGS_llm_batch, "-llm_batch");
+            llm_prompt_lengths = parse_sizes(FLAGS_prompt_len, "-prompt_len");
+        }
+        // -data_shape or the shapes set by the shape trace or by the first generation of LLM mode
+        const auto get_data_shapes = [&](const std::vector<ov::Output<const ov::Node>>& inputs) {
+            if (shape_trace) {
+                return shape_trace->get_data_shapes(inputs);
+            }
+            if (FLAGS_llm) {
+                return LlmBenchmark::get_data_shapes(inputs, llm_batch_sizes[0], llm_prompt_lengths[0]);
+            }
+            return FLAGS_data_shape;
+        };
+
         bool isNetworkCompiled = fileExt(FLAGS_m) == "blob";
         if (isNetworkCompiled) {
             slog::info << "Model is compiled" << slog::endl;
@@ -671,7 +726,7 @@ int main(int argc, char* argv[]) {
             app_inputs_info = get_inputs_info(FLAGS_shape,
                                               FLAGS_layout,
                                               batchSize,
-                                              FLAGS_data_shape,
+                                              get_data_shapes(compiledModel.inputs()),
                                               inputFiles,
                                               FLAGS_scale_values,
                                               FLAGS_mean_values,
@@ -718,7 +773,7 @@ int main(int argc, char* argv[]) {
             app_inputs_info = get_inputs_info(FLAGS_shape,
                                               FLAGS_layout,
                                               FLAGS_b,
-                                              FLAGS_data_shape,
+                                              get_data_shapes(inputInfo),
                                               inputFiles,
                                               FLAGS_scale_values,
                                               FLAGS_mean_values,
@@ -899,7 +954,7 @@ int main(int argc, char* argv[]) {
             app_inputs_info = get_inputs_info(FLAGS_shape,
                                               FLAGS_layout,
                                               FLAGS_b,
-                                              FLAGS_data_shape,
+                                              get_data_shapes(compiledModel.inputs()),
                                               inputFiles,
                                               FLAGS_scale_values,
                                               FLAGS_mean_values,
@@ -986,7 +1041,8 @@ int main(int argc, char* argv[]) {
         // Iteration limit
         uint64_t niter = FLAGS_niter;
         size_t shape_groups_num = app_inputs_info.size();
-        if ((niter > 0) && (FLAGS_api == "async")) {
+        // the open-loop requests are started at the arrival times, so the iterations aren't aligned
+        if ((niter > 0) && (FLAGS_api == "async") && !arrival_process) {
             if (shape_groups_num > nireq) {
                 niter = ((niter + shape_groups_num - 1) / shape_groups_num) * shape_groups_num;
                 if (FLAGS_niter != niter) {
@@ -1008,8 +1064,8 @@ int main(int argc, char* argv[]) {
         if (FLAGS_t != 0) {
             // time limit
             duration_seconds = FLAGS_t;
-        } else if (FLAGS_niter == 0) {
-            // default time limit
+        } else if (FLAGS_niter == 0 && FLAGS_arrival != "replay") {
+            // default time limit, the replay runs till the end of the arrival times
             duration_seconds = device_default_device_duration_in_seconds(device_name);
         }
         uint64_t duration_nanoseconds = get_duration_in_nanoseconds(duration_seconds);
@@ -1039,6 +1095,48 @@ int main(int argc, char* argv[]) {
                 statistics->add_parameters(StatisticsReport::Category::RUNTIME_CONFIG,
                                            {StatisticsVariant(ss.str(), dev_name + "_streams_num", nstreams.second)});
             }
+            if (arrival_process) {
+                statistics->add_parameters(
+                    StatisticsReport::Category::RUNTIME_CONFIG,
+                    {StatisticsVariant("arrival process", "arrival", arrival_process->get_description())});
+            }
+        }
+
+        if (FLAGS_llm) {
+            // ----------------- 9. Creating infer requests and filling input blobs
+            next_step();
+            LlmBenchmark llm_benchmark(compiledModel);
+
+            // ----------------- 10. Measuring performance
+            std::stringstream ss;
+            ss << "Start LLM generation of " << FLAGS_new_tokens << " tokens, batch sizes " << FLAGS_llm_batch
+               << ", prompt lengths " << FLAGS_prompt_len;
+            next_step(ss.str());
+            const uint64_t repetitions = std::max<uint64_t>(FLAGS_niter, 1);
+            std::vector<LlmGenerationResult> results;
+            for (const auto batch_size : llm_batch_sizes) {
+                for (const auto prompt_length : llm_prompt_lengths) {
+                    if (!FLAGS_no_warmup) {
+                        llm_benchmark.generate(batch_size, prompt_length, std::min<size_t>(FLAGS_new_tokens, 2));
+                    }
+                    for (uint64_t i = 0; i < repetitions; ++i) {
+                        results.push_back(llm_benchmark.generate(batch_size, prompt_length, FLAGS_new_tokens));
+                    }
+                }
+            }
+            LlmGenerationStatistics llm_statistics(results);
+
+            // ----------------- 11. Dumping statistics report
+            next_step();
+            if (statistics) {
+                statistics->add_parameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                           llm_statistics.get_parameters());
+                statistics->add_parameters(StatisticsReport::Category::EXECUTION_RESULTS_GROUPPED,
+                                           llm_statistics.get_groupped_parameters());
+                statistics->dump();
+            }
+            llm_statistics.write_to_slog();
+            return 0;
         }
 
         // ----------------- 9. Creating infer requests and filling input blobs
@@ -1096,6 +1194,12 @@ int main(int argc, char* argv[]) {
                     nireq);
             }
         }
+        if (shape_trace && app_inputs_info.size() != shape_trace->size()) {
+            throw std::logic_error("The inputs are prepared for " + std::to_string(app_inputs_info.size()) +
+                                   " shape configurations, but the shape trace has " +
+                                   std::to_string(shape_trace->size()) +
+                                   " distinct shapes. Check that the input files match the shapes of the trace.");
+        }
         // ----------------- 10. Measuring performance
         // ------------------------------------------------------------------
         size_t iteration = 0;
@@ -1117,6 +1221,9 @@ int main(int argc, char* argv[]) {
             if (!device_ss.str().empty()) {
                 ss << " using " << device_ss.str();
             }
+            if (arrival_process) {
+                ss << ", open-loop " << arrival_process->get_description() << " arrivals";
+            }
         }
         ss << ", limits: ";
         if (duration_seconds > 0) {
@@ -1128,6 +1235,9 @@ int main(int argc, char* argv[]) {
             }
             ss << niter << " iterations";
         }
+        if (duration_seconds == 0 && niter == 0) {
+            ss << "end of arrival times";
+        }
 
         next_step(ss.str());
 
@@ -1222,6 +1332,16 @@ int main(int argc, char* argv[]) {
             slog::info << "Skipping warmup inference due to -no_warmup flag" << slog::endl;
         }
 
+        // the counters of CPU runtime work caused by the shape changes are reported for the measurement loop only
+        std::map<std::string, uint64_t> runtimeStatisticsStart;
+        const bool hasRuntimeStatistics =
+            isDynamicNetwork && std::find(supported_properties.begin(),
+                                          supported_properties.end(),
+                                          ov::intel_cpu::runtime_statistics.name()) != supported_properties.end();
+        if (hasRuntimeStatistics) {
+            runtimeStatisticsStart = compiledModel.get_property(ov::intel_cpu::runtime_statistics);
+        }
+
         size_t processedFramesN = 0;
         auto startTime = Time::now();
         auto execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
@@ -1231,17 +1351,31 @@ int main(int argc, char* argv[]) {
          * executed in the same conditions **/
         while ((niter != 0LL && iteration < niter) ||
                (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds) ||
-               (FLAGS_api == "async" && iteration % nireq != 0)) {
+               (FLAGS_api == "async" && iteration % nireq != 0 && !arrival_process) ||
+               (arrival_process && niter == 0LL && duration_nanoseconds == 0LL)) {
+            Time::time_point arrival_time;
+            if (arrival_process) {
+                // the request waits for an idle infer request after its arrival, this queueing delay is a part of
+                // its latency
+                ns arrival_offset;
+                if (!arrival_process->next(arrival_offset) ||
+                    (duration_nanoseconds != 0LL && (uint64_t)arrival_offset.count() >= duration_nanoseconds)) {
+                    break;
+                }
+                arrival_time = startTime + arrival_offset;
+                std::this_thread::sleep_until(arrival_time);
+            }
             inferRequest = inferRequestsQueue.get_idle_request();
             if (!inferRequest) {
                 OPENVINO_THROW("No idle Infer Requests!");
             }
 
             if (!inferenceOnly) {
-                auto inputs = app_inputs_info[iteration % app_inputs_info.size()];
+                const size_t configId = shape_trace ? shape_trace->next() : iteration % app_inputs_info.size();
+                auto inputs = app_inputs_info[configId];
 
                 if (FLAGS_pcseq) {
-                    inferRequest->set_latency_group_id(iteration % app_inputs_info.size());
+                    inferRequest->set_latency_group_id(configId);
                 }
 
                 if (isDynamicNetwork) {
@@ -1250,7 +1384,11 @@ int main(int argc, char* argv[]) {
 
                 for (auto& item : inputs) {
                     auto inputName = item.first;
-                    const auto& data = inputsData.at(inputName)[iteration % inputsData.at(inputName).size()];
+                    const auto& tensors = inputsData.at(inputName);
+                    // the tensor i is filled for the test configuration i % app_inputs_info.size()
+                    const auto& data =
+                        shape_trace ? tensors[(iteration * app_inputs_info.size() + configId) % tensors.size()]
+                                    : tensors[iteration % tensors.size()];
                     inferRequest->set_tensor(inputName, data);
                 }
 
@@ -1265,6 +1403,8 @@ int main(int argc, char* argv[]) {
 
             if (FLAGS_api == "sync") {
                 inferRequest->infer();
+            } else if (arrival_process) {
+                inferRequest->start_async(arrival_time);
             } else {
                 inferRequest->start_async();
             }
@@ -1301,6 +1441,19 @@ int main(int argc, char* argv[]) {
             }
         }
 
+        std::unique_ptr<RuntimeStatistics> runtimeStatistics;
+        if (hasRuntimeStatistics) {
+            runtimeStatistics = std::make_unique<RuntimeStatistics>(
+                runtimeStatisticsStart,
+                compiledModel.get_property(ov::intel_cpu::runtime_statistics));
+        }
+
+        std::unique_ptr<OpenLoopLatencyStatistics> openLoopLatency;
+        if (arrival_process) {
+            openLoopLatency =
+                std::make_unique<OpenLoopLatencyStatistics>(inferRequestsQueue.get_latencies(), FLAGS_sla);
+        }
+
         double totalDuration = inferRequestsQueue.get_duration_in_milliseconds();
         double fps = 1000.0 * processedFramesN / totalDuration;
 
@@ -1323,6 +1476,15 @@ int main(int argc, char* argv[]) {
                      StatisticsVariant("Min latency (ms)", "latency_min", generalLatency.min),
                      StatisticsVariant("Max latency (ms)", "latency_max", generalLatency.max)});
 
+                if (openLoopLatency) {
+                    statistics->add_parameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                               openLoopLatency->get_parameters());
+                }
+                if (runtimeStatistics) {
+                    statistics->add_parameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                               runtimeStatistics->get_parameters());
+                }
+
                 if (FLAGS_pcseq && app_inputs_info.size() > 1) {
                     for (size_t i = 0; i < groupLatencies.size(); ++i) {
                         statistics->add_parameters(
@@ -1390,6 +1552,10 @@ int main(int argc, char* argv[]) {
         if (device_name.find("MULTI") == std::string::npos) {
             slog::info << "Latency:" << slog::endl;
             generalLatency.write_to_slog();
+            if (openLoopLatency) {
+                slog::info << "Latency from arrival:" << slog::endl;
+                openLoopLatency->write_to_slog();
+            }
 
             if (FLAGS_pcseq && app_inputs_info.size() > 1) {
                 slog::info << "Latency for each data shape group:" << slog::endl;
@@ -1409,6 +1575,11 @@ int main(int argc, char* argv[]) {
             }
         }
 
+        if (runtimeStatistics) {
+            slog::info << "Runtime statistics:" << slog::endl;
+            runtimeStatistics->write_to_slog();
+        }
+
         slog::info << "Throughput:          " << double_to_string(fps) << " FPS" << slog::endl;
 
     } catch (const std::exception& ex) {
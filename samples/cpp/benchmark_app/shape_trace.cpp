@@ -0,0 +1,102 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shape_trace.hpp"
+
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+
+#include "utils.hpp"
+
+ShapeTrace::ShapeTrace(const std::string& file_path, bool sample) : _file_path(file_path), _sample(sample) {
+    std::ifstream file(file_path);
+    if (!file.is_open()) {
+        throw std::logic_error("Can't open the shape trace file " + file_path);
+    }
+    std::map<std::string, size_t> config_ids;
+    std::vector<double> weights;
+    std::string line;
+    while (std::getline(file, line)) {
+        std::istringstream line_stream(line);
+        std::string config;
+        if (!(line_stream >> config) || config.front() == '#') {
+            continue;
+        }
+        size_t count = 1;
+        std::string count_string;
+        if (line_stream >> count_string) {
+            std::string rest;
+            if (count_string.find_first_not_of("0123456789") != std::string::npos || (line_stream >> rest) ||
+                (count = std::stoull(count_string)) == 0) {
+                throw std::logic_error("Can't parse the line \"" + line + "\" of the shape trace file " + file_path);
+            }
+        }
+        const auto inserted = config_ids.emplace(config, _configs.size());
+        if (inserted.second) {
+            _configs.push_back(config);
+            weights.push_back(0);
+        }
+        const auto config_id = inserted.first->second;
+        weights[config_id] += static_cast<double>(count);
+        if (!_runs.empty() && _runs.back().first == config_id) {
+            _runs.back().second += count;
+        } else {
+            _runs.emplace_back(config_id, count);
+        }
+    }
+    if (_configs.empty()) {
+        throw std::logic_error("The shape trace file " + file_path + " is empty");
+    }
+    _distribution = std::discrete_distribution<size_t>(weights.begin(), weights.end());
+}
+
+std::string ShapeTrace::get_data_shapes(const std::vector<ov::Output<const ov::Node>>& input_info) const {
+    // input name -> its shape in each configuration
+    std::map<std::string, std::vector<std::string>> shapes;
+    for (size_t i = 0; i < _configs.size(); ++i) {
+        const auto config_shapes = parse_input_parameters(_configs[i], input_info);
+        if (i > 0 && config_shapes.size() != shapes.size()) {
+            throw std::logic_error("Shape configuration \"" + _configs[i] + "\" of the shape trace " + _file_path +
+                                   " must set the same inputs as \"" + _configs[0] + "\"");
+        }
+        for (const auto& item : config_shapes) {
+            if (item.second.size() != 1 || (i > 0 && !shapes.count(item.first))) {
+                throw std::logic_error("Shape configuration \"" + _configs[i] + "\" of the shape trace " +
+                                       _file_path + " must set one shape for each input of \"" + _configs[0] + "\"");
+            }
+            shapes[item.first].push_back(item.second[0]);
+        }
+    }
+    std::string data_shapes;
+    for (const auto& item : shapes) {
+        if (!data_shapes.empty()) {
+            data_shapes += ",";
+        }
+        data_shapes += item.first;
+        for (const auto& shape : item.second) {
+            data_shapes += "[" + shape + "]";
+        }
+    }
+    return data_shapes;
+}
+
+size_t ShapeTrace::next() {
+    if (_sample) {
+        return _distribution(_generator);
+    }
+    // the trace is replayed in a loop
+    if (_run_position == _runs[_run].second) {
+        _run = (_run + 1) % _runs.size();
+        _run_position = 0;
+    }
+    ++_run_position;
+    return _runs[_run].first;
+}
+
+std::string ShapeTrace::get_description() const {
+    return std::string(_sample ? "sampling" : "replay") + " of " + _file_path + ", " + std::to_string(_configs.size()) +
+           " distinct shapes";
+}
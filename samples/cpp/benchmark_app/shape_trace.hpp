@@ -0,0 +1,50 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "openvino/openvino.hpp"
+
+/// @brief Sequence of the input data shapes recorded from the real traffic. Each line of the trace file is a shape
+/// configuration in -data_shape format, e.g. "input_ids[1,37],attention_mask[1,37]", optionally followed by the number
+/// of its occurrences, so the file may hold either the full trace or the histogram of the shapes
+class ShapeTrace {
+public:
+    using Ptr = std::unique_ptr<ShapeTrace>;
+
+    /// @param sample if true, the configurations are drawn from the histogram, otherwise replayed in the file order
+    ShapeTrace(const std::string& file_path, bool sample);
+
+    /// @brief Returns -data_shape string with the distinct configurations in the order of their first occurrence,
+    /// so the indices returned by next() match the test configurations built from it
+    std::string get_data_shapes(const std::vector<ov::Output<const ov::Node>>& input_info) const;
+
+    /// @brief Returns the index of the configuration of the next inference
+    size_t next();
+
+    /// @brief Returns the number of the distinct configurations
+    size_t size() const {
+        return _configs.size();
+    }
+
+    std::string get_description() const;
+
+private:
+    std::string _file_path;
+    bool _sample;
+    std::vector<std::string> _configs;
+    // configuration index and the number of its consecutive occurrences
+    std::vector<std::pair<size_t, size_t>> _runs;
+    size_t _run = 0;
+    size_t _run_position = 0;
+    // the fixed seed makes the runs reproducible
+    std::mt19937_64 _generator{0};
+    std::discrete_distribution<size_t> _distribution;
+};
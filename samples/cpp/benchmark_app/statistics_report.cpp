@@ -4,6 +4,8 @@
 
 // clang-format off
 #include <algorithm>
+#include <cctype>
+#include <cmath>
 #include <map>
 #include <string>
 #include <utility>
@@ -371,3 +373,92 @@ void StatisticsVariant::write_to_json(nlohmann::json& js) const {
         throw std::invalid_argument("StatisticsVariant:: json conversion : invalid type is provided");
     }
 }
+
+OpenLoopLatencyStatistics::OpenLoopLatencyStatistics(std::vector<double> latencies, double sla_ms)
+    : _sla_ms(sla_ms),
+      _count(latencies.size()) {
+    if (latencies.empty()) {
+        throw std::logic_error("Open-loop latency statistics expects non-empty vector of latencies.");
+    }
+    std::sort(latencies.begin(), latencies.end());
+    const std::vector<std::pair<std::string, double>> percentiles = {{"50", 50.0},
+                                                                     {"90", 90.0},
+                                                                     {"95", 95.0},
+                                                                     {"99", 99.0},
+                                                                     {"99.9", 99.9}};
+    for (const auto& [name, percentile] : percentiles) {
+        // nearest-rank percentile
+        const auto rank = static_cast<size_t>(std::ceil(percentile / 100.0 * latencies.size()));
+        _percentiles.emplace_back(name, latencies[std::max<size_t>(rank, 1) - 1]);
+    }
+    if (_sla_ms > 0) {
+        _sla_violations = latencies.end() - std::upper_bound(latencies.begin(), latencies.end(), _sla_ms);
+    }
+}
+
+StatisticsReport::Parameters OpenLoopLatencyStatistics::get_parameters() const {
+    StatisticsReport::Parameters parameters;
+    for (const auto& [name, latency] : _percentiles) {
+        auto json_name = "latency_p" + name;
+        std::replace(json_name.begin(), json_name.end(), '.', '_');
+        parameters.emplace_back("latency p" + name + " (ms)", json_name, latency);
+    }
+    if (_sla_ms > 0) {
+        parameters.emplace_back("SLA (ms)", "sla", _sla_ms);
+        parameters.emplace_back("SLA violations", "sla_violations", static_cast<unsigned long long>(_sla_violations));
+        parameters.emplace_back("SLA violations (%)", "sla_violations_percent", 100.0 * _sla_violations / _count);
+    }
+    return parameters;
+}
+
+RuntimeStatistics::RuntimeStatistics(const std::map<std::string, uint64_t>& start,
+                                     const std::map<std::string, uint64_t>& end) {
+    for (const auto& [name, value] : end) {
+        const auto it = start.find(name);
+        _counters[name] = it == start.end() ? value : value - it->second;
+    }
+    const auto counter = [&](const std::string& name) -> uint64_t {
+        const auto it = _counters.find(name);
+        return it == _counters.end() ? 0 : it->second;
+    };
+    const auto hits = counter("RUNTIME_CACHE_HITS");
+    const auto lookups = hits + counter("RUNTIME_CACHE_MISSES");
+    if (lookups > 0) {
+        _cache_hit_rate = 100.0 * hits / lookups;
+    }
+}
+
+StatisticsReport::Parameters RuntimeStatistics::get_parameters() const {
+    StatisticsReport::Parameters parameters;
+    for (const auto& [name, value] : _counters) {
+        auto json_name = name;
+        std::transform(json_name.begin(), json_name.end(), json_name.begin(), ::tolower);
+        parameters.emplace_back(name, json_name, static_cast<unsigned long long>(value));
+    }
+    if (_cache_hit_rate >= 0) {
+        parameters.emplace_back("runtime cache hit rate (%)", "runtime_cache_hit_rate", _cache_hit_rate);
+    }
+    return parameters;
+}
+
+void RuntimeStatistics::write_to_slog() const {
+    for (const auto& [name, value] : _counters) {
+        slog::info << "   " << name << ": " << value << slog::endl;
+    }
+    if (_cache_hit_rate >= 0) {
+        slog::info << "   Runtime cache hit rate: " << double_to_string(_cache_hit_rate) << "%" << slog::endl;
+    }
+}
+
+void OpenLoopLatencyStatistics::write_to_slog() const {
+    for (const auto& [name, latency] : _percentiles) {
+        const auto label = "p" + name + ":";
+        slog::info << "   " << label << std::string(18 - label.size(), ' ') << double_to_string(latency) << " ms"
+                   << slog::endl;
+    }
+    if (_sla_ms > 0) {
+        slog::info << "   SLA violations:   " << _sla_violations << " of " << _count << " ("
+                   << double_to_string(100.0 * _sla_violations / _count) << "%) above " << double_to_string(_sla_ms)
+                   << " ms" << slog::endl;
+    }
+}
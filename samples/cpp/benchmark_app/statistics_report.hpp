@@ -157,3 +157,36 @@ private:
         return profiling1.real_time > profiling2.real_time;
     }
 };
+
+/// @brief Latency percentiles and SLA violations of the open-loop benchmarking, the latency of each request is
+/// measured from its arrival, so the queueing delay is included
+class OpenLoopLatencyStatistics {
+public:
+    OpenLoopLatencyStatistics(std::vector<double> latencies, double sla_ms);
+
+    StatisticsReport::Parameters get_parameters() const;
+    void write_to_slog() const;
+
+private:
+    // percentile name, latency (ms)
+    std::vector<std::pair<std::string, double>> _percentiles;
+    double _sla_ms;
+    size_t _sla_violations = 0;
+    size_t _count;
+};
+
+/// @brief Counters of the device runtime work caused by the input shape changes during the benchmarking, they are
+/// provided by CPU device as ov::intel_cpu::runtime_statistics
+class RuntimeStatistics {
+public:
+    /// @param start, end are the counters read before and after the benchmarking
+    RuntimeStatistics(const std::map<std::string, uint64_t>& start, const std::map<std::string, uint64_t>& end);
+
+    StatisticsReport::Parameters get_parameters() const;
+    void write_to_slog() const;
+
+private:
+    std::map<std::string, uint64_t> _counters;
+    // negative if there were no lookups in the runtime cache
+    double _cache_hit_rate = -1;
+};
@@ -81,8 +81,9 @@ std::map<std::string, std::vector<float>> parse_scale_or_mean(const std::string&
 std::pair<std::string, std::vector<std::string>> parse_input_files(const std::string& file_paths_string);
 std::map<std::string, std::vector<std::string>> parse_input_arguments(const std::vector<std::string>& args);
 
-std::map<std::string, std::vector<std::string>> parse_input_parameters(const std::string& parameter_string,
-                                                                       const ov::ParameterVector& input_info);
+std::map<std::string, std::vector<std::string>> parse_input_parameters(
+    const std::string& parameter_string,
+    const std::vector<ov::Output<const ov::Node>>& input_info);
 
 /// <summary>
 /// Parses command line data and data obtained from the function and returns configuration of each input
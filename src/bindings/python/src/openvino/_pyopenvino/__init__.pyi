@@ -5186,6 +5186,16 @@ class VariableState:
     """
     def __repr__(self) -> str:
         ...
+    def offload(self, file_path: typing.Any) -> None:
+        """
+                Moves the state content to a file and releases its memory until the next inference.
+        
+                The state is restored from the file on the next inference and the file is removed after that.
+                The call must not run concurrently with an inference of the request.
+        
+                :param file_path: Path to the file to store the state, the file is overwritten if it exists.
+                :type file_path: typing.Union[str, pathlib.Path]
+        """
     def reset(self) -> None:
         """
                 Reset internal variable state for relevant infer request,
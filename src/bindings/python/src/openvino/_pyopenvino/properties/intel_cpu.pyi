@@ -5,7 +5,7 @@ import typing
 """
 openvino.properties.intel_cpu submodule that simulates ov::intel_cpu
 """
-__all__: list[str] = ['TbbPartitioner', 'denormals_optimization', 'sparse_weights_decompression_rate', 'tbb_partitioner']
+__all__: list[str] = ['TbbPartitioner', 'denormals_optimization', 'kv_cache_memory_size', 'runtime_statistics', 'sparse_weights_decompression_rate', 'tbb_partitioner']
 class TbbPartitioner:
     """
     Members:
@@ -57,6 +57,10 @@ def denormals_optimization() -> str:
 @typing.overload
 def denormals_optimization(arg0: bool) -> tuple[str, openvino._pyopenvino.OVAny]:
     ...
+def kv_cache_memory_size() -> str:
+    ...
+def runtime_statistics() -> str:
+    ...
 @typing.overload
 def sparse_weights_decompression_rate() -> str:
     ...
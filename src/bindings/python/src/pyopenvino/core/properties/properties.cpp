@@ -31,7 +31,10 @@ void regmodule_properties(py::module m) {
     wrap_property_RW(m_properties, ov::cache_dir, "cache_dir");
     wrap_property_RW(m_properties, ov::workload_type, "workload_type");
     wrap_property_RW(m_properties, ov::cache_mode, "cache_mode");
+    wrap_property_RW(m_properties, ov::cache_write_async, "cache_write_async");
     wrap_property_RW(m_properties, ov::auto_batch_timeout, "auto_batch_timeout");
+    wrap_property_RW(m_properties, ov::auto_batch_adaptive, "auto_batch_adaptive");
+    wrap_property_RW(m_properties, ov::auto_batch_latency_target, "auto_batch_latency_target");
     wrap_property_RW(m_properties, ov::num_streams, "num_streams");
     wrap_property_RW(m_properties, ov::inference_num_threads, "inference_num_threads");
     wrap_property_RW(m_properties, ov::compilation_num_threads, "compilation_num_threads");
@@ -118,6 +121,8 @@ void regmodule_properties(py::module m) {
                      ov::intel_cpu::sparse_weights_decompression_rate,
                      "sparse_weights_decompression_rate");
     wrap_property_RW(m_intel_cpu, ov::intel_cpu::tbb_partitioner, "tbb_partitioner");
+    wrap_property_RO(m_intel_cpu, ov::intel_cpu::kv_cache_memory_size, "kv_cache_memory_size");
+    wrap_property_RO(m_intel_cpu, ov::intel_cpu::runtime_statistics, "runtime_statistics");
 
     // Submodule intel_gpu
     py::module m_intel_gpu =
@@ -8,6 +8,7 @@
 
 #include "openvino/runtime/variable_state.hpp"
 #include "pyopenvino/core/common.hpp"
+#include "pyopenvino/utils/utils.hpp"
 
 namespace py = pybind11;
 
@@ -35,6 +36,24 @@ void regclass_VariableState(py::module m) {
         :rtype: str
     )");
 
+    variable_st.def(
+        "offload",
+        [](ov::VariableState& self, const py::object& file_path) {
+            const auto path = Common::utils::convert_path_to_string(file_path);
+            py::gil_scoped_release release;
+            self.offload(path);
+        },
+        py::arg("file_path"),
+        R"(
+        Moves the state content to a file and releases its memory until the next inference.
+
+        The state is restored from the file on the next inference and the file is removed after that.
+        The call must not run concurrently with an inference of the request.
+
+        :param file_path: Path to the file to store the state, the file is overwritten if it exists.
+        :type file_path: typing.Union[str, pathlib.Path]
+    )");
+
     variable_st.def_property("state",
                              &ov::VariableState::get_state,
                              &ov::VariableState::set_state,
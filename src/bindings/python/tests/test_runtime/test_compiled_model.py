@@ -23,6 +23,7 @@ from openvino import ConstOutput
 
 import openvino.properties as props
 import openvino.properties.hint as hints
+import openvino.properties.intel_cpu as intel_cpu
 
 
 def test_get_property(device):
@@ -372,6 +373,22 @@ def test_memory_release(device):
     request.infer({0: input_tensor, 1: input_tensor})
 
 
+@pytest.mark.skipif(
+    os.environ.get("TEST_DEVICE", "CPU") != "CPU",
+    reason=f"Cannot run test on device {os.environ.get('TEST_DEVICE')}, Plugin specific test",
+)
+def test_get_runtime_statistics():
+    compiled_model = generate_relu_compiled_model("CPU", input_shape=[1, 3, 32, 32])
+    request = compiled_model.create_infer_request()
+    request.infer({0: generate_image([1, 3, 32, 32])})
+
+    statistics = compiled_model.get_property(intel_cpu.runtime_statistics)
+    assert isinstance(statistics, dict)
+    for key in ["RUNTIME_CACHE_HITS", "RUNTIME_CACHE_MISSES", "RUNTIME_CACHE_EVICTIONS",
+                "PREPARE_PARAMS", "OUTPUT_REALLOCATIONS"]:
+        assert isinstance(statistics[key], int)
+
+
 def test_set_property_set_type():
     model = get_relu_model([1, 3, 32, 32])
     core = Core()
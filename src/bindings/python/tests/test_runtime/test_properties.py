@@ -195,6 +195,8 @@ def test_conflicting_enum(proxy_enums, expected_values):
         (device.uuid, "DEVICE_UUID"),
         (device.luid, "DEVICE_LUID"),
         (device.capabilities, "OPTIMIZATION_CAPABILITIES"),
+        (intel_cpu.kv_cache_memory_size, "CPU_KV_CACHE_MEMORY_SIZE"),
+        (intel_cpu.runtime_statistics, "CPU_RUNTIME_STATISTICS"),
         (intel_gpu.device_total_mem_size, "GPU_DEVICE_TOTAL_MEM_SIZE"),
         (intel_gpu.device_max_alloc_mem_size, "GPU_DEVICE_MAX_ALLOC_MEM_SIZE"),
         (intel_gpu.uarch_version, "GPU_UARCH_VERSION"),
@@ -251,6 +253,16 @@ def test_properties_ro(ov_property_ro, expected_value):
                 (np.uint32(37), np.uint32(37)),
             ),
         ),
+        (props.cache_write_async, "CACHE_WRITE_ASYNC", ((True, True), (False, False))),
+        (props.auto_batch_adaptive, "AUTO_BATCH_ADAPTIVE", ((True, True), (False, False))),
+        (
+            props.auto_batch_latency_target,
+            "AUTO_BATCH_LATENCY_TARGET",
+            (
+                (20, 20),
+                (np.uint32(40), 40),
+            ),
+        ),
         (
             props.inference_num_threads,
             "INFERENCE_NUM_THREADS",
@@ -6,11 +6,15 @@ import numpy as np
 import os
 import pytest
 
+import openvino.opset13 as ops
 from openvino import (
     Core,
     CompiledModel,
     InferRequest,
+    Model,
+    PartialShape,
     Tensor,
+    Type,
     compile_model,
 )
 
@@ -96,3 +100,67 @@ def test_query_state_write_buffer(device, base_class, input_shape, data_type, mo
         assert np.allclose(
             res[list(res)[0]], expected_res, atol=1e-6
         ), f"Expected values: {expected_res} \n Actual values: {res} \n"
+
+
+def generate_model_with_kv_cache():
+    # q, k, v: [B, H, L, S], the past kv is concatenated along L and fused into SDPA by the CPU plugin
+    shape = PartialShape([-1, 8, -1, 64])
+    q = ops.parameter(shape, Type.f32, name="q")
+    k = ops.parameter(shape, Type.f32, name="k")
+    v = ops.parameter(shape, Type.f32, name="v")
+    init = ops.parameter(shape, Type.f32, name="init")
+    beam_idx = ops.parameter(PartialShape([-1]), Type.i32, name="beam_idx")
+    past_k = ops.gather(ops.read_value(init, "pastk", Type.f32, shape), beam_idx, ops.constant(0, Type.i32))
+    past_v = ops.gather(ops.read_value(init, "pastv", Type.f32, shape), beam_idx, ops.constant(0, Type.i32))
+    concat_k = ops.concat([past_k, k], 2)
+    concat_v = ops.concat([past_v, v], 2)
+    sdpa = ops.scaled_dot_product_attention(q, concat_k, concat_v, causal=False)
+    sinks = [ops.assign(concat_k, "pastk"), ops.assign(concat_v, "pastv")]
+    return Model(results=[ops.result(sdpa)], sinks=sinks, parameters=[q, k, v, init, beam_idx], name="KVCache")
+
+
+@pytest.mark.skipif(
+    os.environ.get("TEST_DEVICE", "CPU") != "CPU",
+    reason=f"Can't run test on device {os.environ.get('TEST_DEVICE', 'CPU')}, "
+    "the state offload is implemented by CPU for the KV cache only",
+)
+def test_variable_state_offload(device, tmp_path):
+    core = Core()
+    compiled_model = core.compile_model(generate_model_with_kv_cache(), device)
+    request = compiled_model.create_infer_request()
+    reference = compiled_model.create_infer_request()
+
+    rng = np.random.default_rng(0)
+    for step, length in enumerate([10, 1, 1]):
+        inputs = [rng.random([1, 8, length, 64], dtype=np.float32) for _ in range(3)]
+        inputs += [np.zeros([1, 8, 0, 64], dtype=np.float32), np.zeros([1], dtype=np.int32)]
+        res = request.infer(inputs)[0]
+        expected = reference.infer(inputs)[0]
+        assert np.allclose(res, expected, atol=1e-6)
+
+        for state in request.query_state():
+            file_path = tmp_path / f"{state.name}_{step}.bin"
+            state.offload(file_path)
+            assert file_path.exists()
+
+    # get_state reads the offloaded content and keeps the state offloaded
+    for state, reference_state in zip(request.query_state(), reference.query_state()):
+        assert np.array_equal(state.state.data, reference_state.state.data)
+        assert (tmp_path / f"{state.name}_2.bin").exists()
+        state.reset()
+        assert not (tmp_path / f"{state.name}_2.bin").exists()
+
+
+@pytest.mark.skipif(
+    os.environ.get("TEST_DEVICE", "CPU") not in ["CPU", "GPU"],
+    reason=f"Can't run test on device {os.environ.get('TEST_DEVICE', 'CPU')}, "
+    "Memory layers fully supported only on CPU and GPU",
+)
+def test_variable_state_offload_not_implemented(device, tmp_path):
+    core = Core()
+    compiled_model = core.compile_model(generate_model_with_memory([10], np.float32), device)
+    request = compiled_model.create_infer_request()
+    request.infer({0: np.ones([10], dtype=np.float32)})
+
+    with pytest.raises(RuntimeError):
+        request.query_state()[0].offload(tmp_path / "state.bin")
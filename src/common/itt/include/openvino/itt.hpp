@@ -37,6 +37,9 @@ typedef struct domain_ {
 typedef struct handle_ {
 }* handle_t;
 
+typedef struct counter_ {
+}* counter_t;
+
 /**
  * @cond
  */
@@ -48,6 +51,8 @@ void taskEnd(domain_t d);
 void threadName(const char* name);
 void regionBegin(domain_t d, handle_t t);
 void regionEnd(domain_t d);
+counter_t counter(const char* name, const char* domainName);
+void counterSet(counter_t c, uint64_t value);
 void shutdown();
 }  // namespace internal
 /**
@@ -99,6 +104,22 @@ handle_t handle(handle_t h) {
     return h;
 }
 
+/**
+ * @brief Creates the counter which value is displayed in Intel VTune along the tasks timeline
+ * @param name [in] The counter name
+ * @param domainName [in] The name of the domain the counter belongs to
+ */
+inline counter_t counter(const char* name, const char* domainName) {
+    return internal::counter(name, domainName);
+}
+
+/**
+ * @brief Sets the current value of the counter
+ */
+inline void counterSet(counter_t c, uint64_t value) {
+    internal::counterSet(c, value);
+}
+
 /**
  * @class ScopedTask
  * @ingroup ov_dev_profiling
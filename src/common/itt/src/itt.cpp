@@ -110,6 +110,20 @@ void regionEnd(domain_t d) {
     current_region_handle = nullptr;
 }
 
+counter_t counter(const char* name, const char* domainName) {
+    if (!is_initialized()) {
+        return nullptr;
+    }
+    return reinterpret_cast<counter_t>(__itt_counter_create_typed(name, domainName, __itt_metadata_u64));
+}
+
+void counterSet(counter_t c, uint64_t value) {
+    if (!is_initialized() || c == nullptr) {
+        return;
+    }
+    __itt_counter_set_value(reinterpret_cast<__itt_counter>(c), &value);
+}
+
 void shutdown() {
     __itt_release_resources();
 }
@@ -134,6 +148,12 @@ void regionBegin(domain_t, handle_t) {}
 
 void regionEnd(domain_t) {}
 
+counter_t counter(const char*, const char*) {
+    return nullptr;
+}
+
+void counterSet(counter_t, uint64_t) {}
+
 void shutdown() {}
 
 #endif  // ENABLE_PROFILING_ITT
@@ -19,6 +19,9 @@ namespace internal {
  * 2. LoRA_input: input to which the Low-Rank adaptation is applied.
  *    The adapted input is combined with `main_flow_input`.
  * 3. LoRA_matrices: 3 Low-Rank adaptation matrices applied to `LoRA_input`.
+ * 4. adapter_indices (optional): index of the adapter per batch row. In this case `LoRA_matrices` are the banks of
+ *    the adapters ([adapters, rank, K], [adapters, 1, rank] and [adapters, N, rank]) and every row of `LoRA_input`
+ *    ([batch, tokens, K]) is adapted with the matrices gathered by its index.
  * The fused subgraph can be optimized in runtime based on LoRA semantic.
  * For instance, `main_flow_input` can be fast-forwarded to output in case of empty `LoRA_matrices`.
  */
@@ -21,5 +21,8 @@ class TRANSFORMATIONS_API LoraSubgraphFusion;
 class ov::pass::LoraSubgraphFusion : public ov::pass::MatcherPass {
 public:
     OPENVINO_MATCHER_PASS_RTTI("LoraSubgraphFusion");
-    LoraSubgraphFusion();
+    /// @param fuse_adapter_banks also fuses the LoRA with the per batch row adapters, whose matrices are gathered
+    /// from the banks held in the states by the indices shared by the 3 gathers. Such LoraSubgraph has the 6th input
+    /// with the indices.
+    explicit LoraSubgraphFusion(bool fuse_adapter_banks = false);
 };
@@ -27,7 +27,9 @@ std::shared_ptr<Node> LoraSubgraph::clone_with_new_inputs(const OutputVector& ne
 
 void LoraSubgraph::validate_and_infer_types() {
     INTERNAL_OP_SCOPE(internal_LoraSubgraph_validate_and_infer_types);
-    OPENVINO_ASSERT(get_input_size() == 5, "LoraSubgraph must have 5 inputs whereas it has ", get_input_size());
+    OPENVINO_ASSERT(get_input_size() == 5 || get_input_size() == 6,
+                    "LoraSubgraph must have 5 or 6 inputs whereas it has ",
+                    get_input_size());
     OPENVINO_ASSERT(get_output_size() == 1, "LoraSubgraph must have 1 output whereas it has ", get_output_size());
     const auto& body = get_function();
     OPENVINO_ASSERT(body, "LoraSubgraph must have initialized body");
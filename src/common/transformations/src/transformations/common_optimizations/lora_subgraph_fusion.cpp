@@ -11,6 +11,7 @@
 #include "openvino/op/add.hpp"
 #include "openvino/op/convert.hpp"
 #include "openvino/op/convolution.hpp"
+#include "openvino/op/gather.hpp"
 #include "openvino/op/matmul.hpp"
 #include "openvino/op/multiply.hpp"
 #include "openvino/op/parameter.hpp"
@@ -25,10 +26,26 @@ namespace v0 = ov::op::v0;
 namespace v1 = ov::op::v1;
 namespace op_util = ov::op::util;
 
+namespace {
+
+// the matrices of the batch rows are gathered from the bank [adapters, ...] by the given per row indices
+bool is_gathered_per_row(const std::shared_ptr<ov::Node>& node, const ov::Output<ov::Node>& indices) {
+    const auto gather = ov::as_type_ptr<op_util::GatherBase>(node);
+    return gather && gather->input_value(1) == indices && gather->get_batch_dims() == 0 &&
+           gather->get_input_partial_shape(0).rank() == 3 && gather->get_axis() == 0;
+}
+
+}  // namespace
+
 namespace ov::pass {
 
-LoraSubgraphFusion::LoraSubgraphFusion() {
+LoraSubgraphFusion::LoraSubgraphFusion(bool fuse_adapter_banks) {
     MATCHER_SCOPE(LoraSubgraphFusion);
+    auto create_gather = [](const std::shared_ptr<ov::Node>& state) {
+        return pattern::optional<op_util::GatherBase>(
+            {state, pattern::any_input(pattern::rank_equals(1)), pattern::wrap_type<v0::Constant>()},
+            pattern::consumers_count(1));
+    };
     auto lora_input_m = pattern::any_input();
     auto transpose_const1_m = pattern::wrap_type<v0::Constant>(pattern::consumers_count(1));
     auto transpose1_m =
@@ -36,15 +53,18 @@ LoraSubgraphFusion::LoraSubgraphFusion() {
 
     auto read_value1_m = pattern::wrap_type<op_util::ReadValueBase>();
     auto convert1_m = pattern::optional<v0::Convert>(read_value1_m, pattern::consumers_count(1));
-    auto matmul1_m = pattern::wrap_type<v0::MatMul>({transpose1_m, convert1_m}, pattern::consumers_count(1));
+    auto gather1_m = create_gather(convert1_m);
+    auto matmul1_m = pattern::wrap_type<v0::MatMul>({transpose1_m, gather1_m}, pattern::consumers_count(1));
 
     auto read_value2_m = pattern::wrap_type<op_util::ReadValueBase>();
     auto convert2_m = pattern::optional<v0::Convert>(read_value2_m, pattern::consumers_count(1));
-    auto multiply_m = pattern::wrap_type<v1::Multiply>({matmul1_m, convert2_m}, pattern::consumers_count(1));
+    auto gather2_m = create_gather(convert2_m);
+    auto multiply_m = pattern::wrap_type<v1::Multiply>({matmul1_m, gather2_m}, pattern::consumers_count(1));
 
     auto read_value3_m = pattern::wrap_type<op_util::ReadValueBase>();
     auto convert3_m = pattern::optional<v0::Convert>(read_value3_m, pattern::consumers_count(1));
-    auto matmul2_m = pattern::wrap_type<v0::MatMul>({multiply_m, convert3_m}, pattern::consumers_count(1));
+    auto gather3_m = create_gather(convert3_m);
+    auto matmul2_m = pattern::wrap_type<v0::MatMul>({multiply_m, gather3_m}, pattern::consumers_count(1));
 
     auto transpose_const2_m = pattern::wrap_type<v0::Constant>(pattern::consumers_count(1));
     auto transpose2_m = pattern::optional<v1::Transpose>({matmul2_m, transpose_const2_m}, pattern::consumers_count(1));
@@ -71,6 +91,31 @@ LoraSubgraphFusion::LoraSubgraphFusion() {
             return false;
         }
 
+        const auto gathers_count =
+            pattern_map.count(gather1_m) + pattern_map.count(gather2_m) + pattern_map.count(gather3_m);
+        const bool adapter_banks = gathers_count != 0;
+        ov::Output<ov::Node> adapter_indices;
+        if (adapter_banks) {
+            if (!fuse_adapter_banks || gathers_count != 3 || pattern_map.count(transpose1_m) ||
+                pattern_map.count(transpose2_m)) {
+                return false;
+            }
+            // [batch, tokens, K] x [batch, rank, K]^T x [batch, 1, rank] x [batch, N, rank]^T
+            const auto mm1 = ov::as_type_ptr<v0::MatMul>(matmul1.get_node_shared_ptr());
+            const auto mm2 = ov::as_type_ptr<v0::MatMul>(matmul2.get_node_shared_ptr());
+            if (mm1->get_transpose_a() || !mm1->get_transpose_b() || mm2->get_transpose_a() ||
+                !mm2->get_transpose_b() || lora_input.get_partial_shape().rank() != 3 ||
+                !ov::is_type<v0::MatMul>(main_flow.get_node())) {
+                return false;
+            }
+            adapter_indices = pattern_map.at(gather1_m).get_node()->input_value(1);
+            for (const auto& gather_m : {gather1_m, gather2_m, gather3_m}) {
+                if (!is_gathered_per_row(pattern_map.at(gather_m).get_node_shared_ptr(), adapter_indices)) {
+                    return false;
+                }
+            }
+        }
+
         auto find_connected_input = [](ov::Node* child, ov::Node* parent) {
             for (size_t i = 0; i < child->get_input_size(); ++i) {
                 auto input = child->input(i);
@@ -80,17 +125,23 @@ LoraSubgraphFusion::LoraSubgraphFusion() {
             OPENVINO_THROW("Ops are not connected");
         };
 
+        // the banks go to the gathers inside the subgraph
+        auto state_input = [&](const ov::Input<ov::Node>& input, const std::shared_ptr<ov::Node>& gather_m) {
+            return adapter_banks ? pattern_map.at(gather_m).get_node()->input(0) : input;
+        };
+        const auto& matrix_2 = adapter_banks ? pattern_map.at(gather2_m) : state_2;
+
         // Note: internal_inputs/external_connections order corresponds to LoraSubgraph semantic
         const std::vector<ov::Input<ov::Node>> internal_inputs{
             // For commutative eltwise ops, input idx may be any, so it must be computed
             find_connected_input(add.get_node(), main_flow.get_node()),
             pattern_map.count(transpose1_m) ? pattern_map.at(transpose1_m).get_node()->input(0)
                                             : matmul1.get_node()->input(0),
-            matmul1.get_node()->input(1),
-            find_connected_input(multiply.get_node(), state_2.get_node()),
-            matmul2.get_node()->input(1),
+            state_input(matmul1.get_node()->input(1), gather1_m),
+            state_input(find_connected_input(multiply.get_node(), matrix_2.get_node()), gather2_m),
+            state_input(matmul2.get_node()->input(1), gather3_m),
         };
-        const ov::OutputVector external_connections{
+        ov::OutputVector external_connections{
             main_flow,
             lora_input,
             state_1,
@@ -105,6 +156,15 @@ LoraSubgraphFusion::LoraSubgraphFusion() {
             subgraph_parameters.push_back(new_parameter);
             in.replace_source_output(new_parameter);
         }
+        if (adapter_banks) {
+            auto indices_parameter =
+                std::make_shared<v0::Parameter>(adapter_indices.get_element_type(), adapter_indices.get_partial_shape());
+            for (const auto& gather_m : {gather1_m, gather2_m, gather3_m}) {
+                pattern_map.at(gather_m).get_node()->input(1).replace_source_output(indices_parameter);
+            }
+            subgraph_parameters.push_back(indices_parameter);
+            external_connections.push_back(adapter_indices);
+        }
         // Note: lora consumers should be taken before lora_subgraph creation,
         // because only original consumers should be replaced with lora's output
         const auto& lora_consumers = add.get_target_inputs();
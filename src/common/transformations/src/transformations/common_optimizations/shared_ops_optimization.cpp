@@ -73,6 +73,10 @@ bool inputs_from_same_source_or_equal_constants(const std::shared_ptr<Node>& lhs
             return false;
         if (lhs_constant->get_shape() != rhs_constant->get_shape())
             return false;
+        // the same bytes of a mapped file are equal without paging them in
+        if (lhs_constant->get_data_ptr() == rhs_constant->get_data_ptr() ||
+            lhs_constant->has_same_mapped_data(*rhs_constant))
+            continue;
         if (memcmp(lhs_constant->get_data_ptr(), rhs_constant->get_data_ptr(), lhs_constant->get_byte_size()) != 0)
             return false;
     }
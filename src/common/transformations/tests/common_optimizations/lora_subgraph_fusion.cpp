@@ -12,6 +12,7 @@
 #include "common_test_utils/ov_test_utils.hpp"
 #include "openvino/core/model.hpp"
 #include "openvino/op/add.hpp"
+#include "openvino/op/gather.hpp"
 #include "openvino/op/matmul.hpp"
 #include "openvino/op/multiply.hpp"
 #include "openvino/op/transpose.hpp"
@@ -24,6 +25,7 @@ using namespace ov;
 namespace v0 = ov::op::v0;
 namespace v1 = ov::op::v1;
 namespace v6 = ov::op::v6;
+namespace v8 = ov::op::v8;
 namespace op_util = ov::op::util;
 static constexpr auto netType = ov::element::f32;
 
@@ -294,3 +296,115 @@ TEST_F(LoraSubgraphFusionConvolutionTests, StandardPattern) {
         model_ref = std::make_shared<Model>(OutputVector{lora, main_conv}, states.second, ParameterVector{param_lora});
     }
 }
+
+ov::OutputVector gather_adapters(const ov::OutputVector& banks, const ov::Output<ov::Node>& indices) {
+    ov::OutputVector matrices;
+    for (const auto& bank : banks) {
+        auto axis = v0::Constant::create(ov::element::i32, ov::Shape{}, {0});
+        matrices.push_back(std::make_shared<v8::Gather>(bank, indices, axis));
+    }
+    return matrices;
+}
+
+class LoraSubgraphFusionAdapterBanksTests : public LoraSubgraphFusionTests {
+public:
+    void SetUp() override {
+        TransformationTestsF::SetUp();
+        manager.register_pass<ov::pass::LoraSubgraphFusion>(true);
+    }
+
+    const ov::Dimension K = 563;
+    const ov::Dimension N = 2048;
+    ov::PartialShape shape_x = {-1, -1, K};
+    ov::PartialShape shape_w = {N, K};
+    ov::PartialShape shape_indices = {-1};
+    ov::PartialShape shape_bank_1 = {-1, -1, K};
+    ov::PartialShape shape_bank_2 = {-1, 1, -1};
+    ov::PartialShape shape_bank_3 = {-1, N, -1};
+};
+
+TEST_F(LoraSubgraphFusionAdapterBanksTests, StandardPattern) {
+    {
+        auto param_lora = std::make_shared<v0::Parameter>(netType, shape_x);
+        auto param_w = std::make_shared<v0::Parameter>(netType, shape_w);
+        auto param_indices = std::make_shared<v0::Parameter>(ov::element::i32, shape_indices);
+        auto main_mm = std::make_shared<v0::MatMul>(param_lora, param_w, false, true);
+        main_mm->set_friendly_name("main_mm");
+        auto states = create_states({shape_bank_1, shape_bank_2, shape_bank_3}, ov::element::f16);
+        auto lora_subgraph =
+            create_lora_subgraph(main_mm, param_lora, gather_adapters(states.first, param_indices), false);
+        lora_subgraph->set_friendly_name("lora_subgraph");
+        model = std::make_shared<Model>(OutputVector{lora_subgraph, main_mm},
+                                        states.second,
+                                        ParameterVector{param_lora, param_w, param_indices});
+    }
+    {
+        auto param_lora = std::make_shared<v0::Parameter>(netType, shape_x);
+        auto param_w = std::make_shared<v0::Parameter>(netType, shape_w);
+        auto param_indices = std::make_shared<v0::Parameter>(ov::element::i32, shape_indices);
+        auto main_mm = std::make_shared<v0::MatMul>(param_lora, param_w, false, true);
+        main_mm->set_friendly_name("main_mm");
+
+        auto inner_param_lora = std::make_shared<v0::Parameter>(netType, shape_x);
+        auto inner_bank_1 = std::make_shared<v0::Parameter>(netType, shape_bank_1);
+        auto inner_bank_2 = std::make_shared<v0::Parameter>(netType, shape_bank_2);
+        auto inner_bank_3 = std::make_shared<v0::Parameter>(netType, shape_bank_3);
+        auto inner_param_mm = std::make_shared<v0::Parameter>(netType, main_mm->get_output_partial_shape(0));
+        auto inner_indices = std::make_shared<v0::Parameter>(ov::element::i32, shape_indices);
+
+        ov::OutputVector banks_outs{inner_bank_1, inner_bank_2, inner_bank_3};
+        auto lora_subgraph = create_lora_subgraph(inner_param_mm,
+                                                  inner_param_lora,
+                                                  gather_adapters(banks_outs, inner_indices),
+                                                  false);
+        lora_subgraph->set_friendly_name("lora_subgraph");
+        ov::ParameterVector inner_params{inner_param_mm,
+                                         inner_param_lora,
+                                         inner_bank_1,
+                                         inner_bank_2,
+                                         inner_bank_3,
+                                         inner_indices};
+        auto inner_model = std::make_shared<Model>(OutputVector{lora_subgraph}, inner_params);
+
+        auto states = create_states({shape_bank_1, shape_bank_2, shape_bank_3}, ov::element::f16);
+        ov::OutputVector lora_inputs{main_mm,
+                                     param_lora,
+                                     states.first[0],
+                                     states.first[1],
+                                     states.first[2],
+                                     param_indices};
+        auto lora = std::make_shared<ov::op::internal::LoraSubgraph>(lora_inputs, inner_model);
+        lora->set_friendly_name("lora_subgraph");
+
+        model_ref = std::make_shared<Model>(OutputVector{lora, main_mm},
+                                            states.second,
+                                            ParameterVector{param_lora, param_w, param_indices});
+    }
+}
+
+TEST_F(LoraSubgraphFusionAdapterBanksTests, DifferentIndices) {
+    auto param_lora = std::make_shared<v0::Parameter>(netType, shape_x);
+    auto param_w = std::make_shared<v0::Parameter>(netType, shape_w);
+    auto param_indices_1 = std::make_shared<v0::Parameter>(ov::element::i32, shape_indices);
+    auto param_indices_2 = std::make_shared<v0::Parameter>(ov::element::i32, shape_indices);
+    auto main_mm = std::make_shared<v0::MatMul>(param_lora, param_w, false, true);
+    auto states = create_states({shape_bank_1, shape_bank_2, shape_bank_3});
+    auto matrices = gather_adapters(states.first, param_indices_1);
+    matrices[2] = gather_adapters({states.first[2]}, param_indices_2)[0];
+    auto lora_subgraph = create_lora_subgraph(main_mm, param_lora, matrices, false);
+    model = std::make_shared<Model>(OutputVector{lora_subgraph, main_mm},
+                                    states.second,
+                                    ParameterVector{param_lora, param_w, param_indices_1, param_indices_2});
+}
+
+TEST_F(LoraSubgraphFusionMatMulTests, AdapterBanksAreNotFusedByDefault) {
+    auto param_lora = std::make_shared<v0::Parameter>(netType, shape_x);
+    auto param_w = std::make_shared<v0::Parameter>(netType, shape_w);
+    auto param_indices = std::make_shared<v0::Parameter>(ov::element::i32, ov::PartialShape{-1});
+    auto main_mm = std::make_shared<v0::MatMul>(param_lora, param_w, false, true);
+    auto states = create_states({{-1, -1, K}, {-1, 1, -1}, {-1, N, -1}});
+    auto lora_subgraph = create_lora_subgraph(main_mm, param_lora, gather_adapters(states.first, param_indices), false);
+    model = std::make_shared<Model>(OutputVector{lora_subgraph, main_mm},
+                                    states.second,
+                                    ParameterVector{param_lora, param_w, param_indices});
+}
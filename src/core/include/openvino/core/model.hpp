@@ -7,6 +7,7 @@
 #include <atomic>
 #include <initializer_list>
 #include <list>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -531,7 +532,11 @@ private:
     // of weak_ptr not to increase node ref counter to prevent the situation when
     // node has no consumers but still exists in a graph.
     mutable std::vector<std::weak_ptr<Node>> m_cached_ordered_ops;
-    mutable std::unordered_set<Node*> m_cached_ops;
+    // The labels of the cached nodes grow in the topological order, the gaps between them allow to insert
+    // the new nodes, so localized changes of the graph update the order instead of the full sort.
+    mutable std::map<uint64_t, std::pair<Node*, std::weak_ptr<Node>>> m_cached_order;
+    mutable std::unordered_map<Node*, uint64_t> m_cached_ops;
+    bool m_update_topological_cache = true;
 
     mutable std::unordered_map<std::string, Output<Node>> m_cached_output_names;
     mutable std::unordered_map<std::string, std::weak_ptr<Node>> m_cached_op_names;
@@ -6,6 +6,7 @@
 
 #include <cmath>
 #include <cstring>
+#include <optional>
 #include <variant>
 
 #include "openvino/core/axis_set.hpp"
@@ -19,6 +20,7 @@
 namespace ov {
 
 class AlignedBuffer;
+class IBufferDescriptor;
 
 namespace op {
 namespace v0 {
@@ -271,6 +273,23 @@ public:
 
     bool get_all_data_elements_bitwise_identical() const;
 
+    /// \brief Gets the fingerprint of the constant data computed from its metadata only, so the data is not read.
+    ///
+    /// It's available for the data shared with a memory mapped file (e.g. the weights read from IR with mmap enabled)
+    /// and combines the file id, the data offset in the file, the byte size, the element type and the shape. The
+    /// constants with the same fingerprint refer to the same bytes of the same file.
+    ///
+    /// \return The fingerprint or std::nullopt if the data isn't mapped from a file.
+    std::optional<uint64_t> get_data_fingerprint() const;
+
+    /// \brief Checks that the constants refer to the same bytes of the same memory mapped file, so their data is equal.
+    ///
+    /// Unlike the fingerprints, the file ids, the data offsets and the byte sizes are compared exactly, as well as the
+    /// element types and the shapes. The data is not read.
+    ///
+    /// \return false if the data isn't mapped from a file or is mapped from another place.
+    bool has_same_mapped_data(const Constant& other) const;
+
     std::string convert_value_to_string(size_t index) const;
 
     /**
@@ -331,6 +350,8 @@ private:
     }
 
     bool are_all_data_elements_bitwise_identical() const;
+    // the descriptor of the data shared with a memory mapped file, nullptr for the other data
+    std::shared_ptr<IBufferDescriptor> get_mapped_descriptor() const;
     // This is 'const' as it updates only mutable data
     void update_identical_flags(bool is_checked, bool identical_value) const;
 
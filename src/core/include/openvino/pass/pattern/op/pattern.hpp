@@ -34,7 +34,9 @@ op::Predicate has_class() {
     auto pred = [gcc_abi_compatibility](std::shared_ptr<Node> node) -> bool {
         return gcc_abi_compatibility && ov::is_type<T>(std::move(node));
     };
-    return op::Predicate(pred, "has_class<" + std::string(typeid(T).name()) + ">()");
+    auto predicate = op::Predicate(pred, "has_class<" + std::string(typeid(T).name()) + ">()");
+    predicate.set_type_hints({T::get_type_info_static()});
+    return predicate;
 }
 template <typename T>
 op::Predicate class_other_than() {
@@ -88,6 +90,10 @@ public:
     std::ostream& write_description(std::ostream& out, uint32_t depth) const override;
     virtual std::ostream& write_type_description(std::ostream& out) const;
 
+    const Predicate& get_predicate() const {
+        return m_predicate;
+    }
+
 protected:
     Predicate m_predicate;
 };
@@ -7,6 +7,7 @@
 #include <memory>
 #include <type_traits>
 #include <unordered_map>
+#include <vector>
 
 #include "openvino/core/any.hpp"
 #include "openvino/core/core_visibility.hpp"
@@ -103,6 +104,16 @@ public:
     bool operator()(const std::shared_ptr<Node>& node) const;
     bool operator()(const Output<Node>& output) const;
 
+    /// \brief Returns the node types the predicate is restricted to, a node of other type never satisfies it.
+    /// Empty if the predicate may accept a node of any type. GraphRewrite uses them to dispatch the matchers by type.
+    const std::vector<DiscreteTypeInfo>& get_type_hints() const {
+        return m_type_hints;
+    }
+
+    void set_type_hints(std::vector<DiscreteTypeInfo> type_hints) {
+        m_type_hints = std::move(type_hints);
+    }
+
     template <typename TPredicate>
     Predicate operator||(const TPredicate& other) const {
         return *this || Predicate(other);
@@ -120,6 +131,11 @@ public:
             },
             m_name + " || " + other.m_name);
         result.m_requires_map = m_requires_map || other.m_requires_map;
+        // a node satisfies either of the predicates, so the types are only known when both have the hints
+        if (!m_type_hints.empty() && !other.m_type_hints.empty()) {
+            result.m_type_hints = m_type_hints;
+            result.m_type_hints.insert(result.m_type_hints.end(), other.m_type_hints.begin(), other.m_type_hints.end());
+        }
         return result;
     }
 
@@ -130,12 +146,15 @@ public:
             },
             m_name + " && " + other.m_name);
         result.m_requires_map = m_requires_map || other.m_requires_map;
+        // a node satisfies both of the predicates, so the hints of either of them are valid
+        result.m_type_hints = m_type_hints.empty() ? other.m_type_hints : m_type_hints;
         return result;
     }
 
 private:
     bool m_requires_map = false;
     std::string m_name = "no_name";
+    std::vector<DiscreteTypeInfo> m_type_hints;
 
     std::function<bool(PatternSymbolMap&, const Output<Node>&)> m_pred;
 };
@@ -12,6 +12,7 @@
 #include "openvino/op/util/attr_types.hpp"
 #include "openvino/reference/utils/coordinate_index.hpp"
 #include "openvino/reference/utils/coordinate_transform.hpp"
+#include "openvino/reference/utils/parallel.hpp"
 
 namespace ov {
 namespace reference {
@@ -71,6 +72,14 @@ inline size_t calculate_fixed_axis(size_t axis, const size_t* strides) {
         --axis;
     return axis;
 }
+
+template <typename T, typename U, class Functor>
+void numpy_broadcast_binop_chunk(const T* arg0,
+                                 const T* arg1,
+                                 U* out,
+                                 const Shape& arg0_shape,
+                                 const Shape& arg1_shape,
+                                 Functor f);
 }  // namespace internal
 
 /**
@@ -84,9 +93,11 @@ inline size_t calculate_fixed_axis(size_t axis, const size_t* strides) {
  */
 template <typename T, typename U, class Functor>
 void no_broadcast_binop(const T* arg0, const T* arg1, U* out, const size_t count, Functor f) {
-    for (auto last = arg0 + count; arg0 != last; ++arg0, ++arg1, ++out) {
-        *out = f(*arg0, *arg1);
-    }
+    parallel::for_each_block(count, [&](const size_t begin, const size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            out[i] = f(arg0[i], arg1[i]);
+        }
+    });
 }
 
 /**
@@ -106,6 +117,61 @@ void numpy_broadcast_binop(const T* arg0,
                            const Shape& arg0_shape,
                            const Shape& arg1_shape,
                            Functor f) {
+    // The outermost non-unit dimension of the output is split into the chunks broadcast independently.
+    const auto rank = std::max(arg0_shape.size(), arg1_shape.size());
+    Shape shape0(rank - arg0_shape.size(), 1);
+    shape0.insert(shape0.end(), arg0_shape.begin(), arg0_shape.end());
+    Shape shape1(rank - arg1_shape.size(), 1);
+    shape1.insert(shape1.end(), arg1_shape.begin(), arg1_shape.end());
+
+    size_t axis = 0;
+    while (axis < rank && shape0[axis] == 1 && shape1[axis] == 1) {
+        ++axis;
+    }
+    if (axis == rank) {
+        internal::numpy_broadcast_binop_chunk(arg0, arg1, out, arg0_shape, arg1_shape, f);
+        return;
+    }
+
+    const auto inner0 = shape_size(shape0.begin() + axis + 1, shape0.end());
+    const auto inner1 = shape_size(shape1.begin() + axis + 1, shape1.end());
+    size_t inner_out = 1;
+    for (size_t i = axis + 1; i < rank; ++i) {
+        inner_out *= std::max(shape0[i], shape1[i]);
+    }
+    const auto step0 = shape0[axis] == 1 ? 0 : inner0;
+    const auto step1 = shape1[axis] == 1 ? 0 : inner1;
+    const Shape chunk0(shape0.begin() + axis, shape0.end());
+    const Shape chunk1(shape1.begin() + axis, shape1.end());
+
+    parallel::for_each_chunk(std::max(shape0[axis], shape1[axis]),
+                             inner_out,
+                             [&](const size_t begin, const size_t end) {
+                                 auto chunk_shape0 = chunk0;
+                                 auto chunk_shape1 = chunk1;
+                                 if (chunk_shape0[0] != 1) {
+                                     chunk_shape0[0] = end - begin;
+                                 }
+                                 if (chunk_shape1[0] != 1) {
+                                     chunk_shape1[0] = end - begin;
+                                 }
+                                 internal::numpy_broadcast_binop_chunk(arg0 + begin * step0,
+                                                                       arg1 + begin * step1,
+                                                                       out + begin * inner_out,
+                                                                       chunk_shape0,
+                                                                       chunk_shape1,
+                                                                       f);
+                             });
+}
+
+namespace internal {
+template <typename T, typename U, class Functor>
+void numpy_broadcast_binop_chunk(const T* arg0,
+                                 const T* arg1,
+                                 U* out,
+                                 const Shape& arg0_shape,
+                                 const Shape& arg1_shape,
+                                 Functor f) {
     // We'll be using CoordinateTransformBasic to handle the broadcasting. The general procedure is as follows:
     //
     // (1) Left pad the shorter of the two shapes with ones.
@@ -203,6 +269,7 @@ void numpy_broadcast_binop(const T* arg0,
                                                   strides0[axis],
                                                   f);
 }
+}  // namespace internal
 
 /**
  * @brief Apply elementwise function for 2 inputs and apply PDPP broadcasting.
@@ -12,6 +12,7 @@
 #include "openvino/core/type/element_type.hpp"
 #include "openvino/core/type/float16.hpp"
 #include "openvino/core/type/nf4.hpp"
+#include "openvino/reference/utils/parallel.hpp"
 
 #if !defined(OS_CHROMEOS) && (defined(OPENVINO_ARCH_X86) || defined(OPENVINO_ARCH_X86_64))
 #    define OV_CORE_USE_XBYAK_JIT
@@ -56,12 +57,16 @@ void convert(InputIt arg, OutputIt out, const size_t count) {
     using To =
         typename std::conditional<is_nf4_iterator<OutputIt>() && !std::is_integral<IN_T>::value, float, OUT_T>::type;
 
-    std::transform(arg, arg + count, out, detail::convert<From, To>);
+    parallel::for_each_block(count, [&](const size_t begin, const size_t end) {
+        std::transform(arg + begin, arg + end, out + begin, detail::convert<From, To>);
+    });
 }
 
 template <typename TI, typename TO>
 void convert(const TI* arg, TO* out, const size_t count) {
-    std::transform(arg, arg + count, out, detail::convert<TI, TO>);
+    parallel::for_each_block(count, [&](const size_t begin, const size_t end) {
+        std::transform(arg + begin, arg + end, out + begin, detail::convert<TI, TO>);
+    });
 }
 
 template <>
@@ -7,6 +7,7 @@
 #include <numeric>
 
 #include "openvino/core/shape.hpp"
+#include "openvino/reference/utils/parallel.hpp"
 #include "utils/span.hpp"
 
 namespace ov {
@@ -30,27 +31,30 @@ void gather(const T* const data,
     int64_t batch_out_mul = shape_size(span(out_shape).subspan(batch_dims));
 
     int64_t axis_size = data_shape[axis];
-    int64_t data_offset, out_offset, idx;
-    // for out of bound indices is filled with zeros
-    std::fill(out, out + shape_size(out_shape), T{0});
-
-    for (int64_t batch = 0; batch < batch_size; batch++)
-        for (int64_t outer_idx = 0; outer_idx < outer_size; outer_idx++) {
-            data_offset = batch_data_mul * batch + inner_size * axis_size * outer_idx;
-            out_offset = batch_out_mul * batch + indices_size * inner_size * outer_idx;
+    // the (batch, outer) pairs are split into the chunks, the outputs of out of bound indices are filled with zeros
+    parallel::for_each_chunk(batch_size * outer_size, indices_size * inner_size, [&](size_t begin, size_t end) {
+        for (auto work = static_cast<int64_t>(begin); work < static_cast<int64_t>(end); work++) {
+            const int64_t batch = work / outer_size;
+            const int64_t outer_idx = work % outer_size;
+            const int64_t data_offset = batch_data_mul * batch + inner_size * axis_size * outer_idx;
+            const int64_t out_offset = batch_out_mul * batch + indices_size * inner_size * outer_idx;
             for (int64_t i = 0; i < indices_size; i++) {
-                idx = indices[i + indices_size * batch];
+                int64_t idx = indices[i + indices_size * batch];
                 if (idx < 0)
                     idx += axis_size;
+
+                const auto out_ptr = std::next(out, out_offset + inner_size * i);
                 // for out of bound values have to be filled with zeros
-                if (idx >= axis_size || idx < 0)
+                if (idx >= axis_size || idx < 0) {
+                    std::fill_n(out_ptr, inner_size, T{0});
                     continue;
+                }
 
                 const auto src_begin = std::next(data, data_offset + inner_size * idx);
-                const auto out_ptr = std::next(out, out_offset + inner_size * i);
                 std::copy_n(src_begin, inner_size, out_ptr);
             }
         }
+    });
 }
 
 }  // namespace reference
@@ -11,6 +11,7 @@
 #include "openvino/core/shape_util.hpp"
 #include "openvino/reference/utils/coordinate_index.hpp"
 #include "openvino/reference/utils/coordinate_transform.hpp"
+#include "openvino/reference/utils/parallel.hpp"
 
 namespace ov {
 namespace reference {
@@ -27,20 +28,26 @@ void reduce_min(const T* in, T* out, const Shape& in_shape, const AxisSet& reduc
     constexpr auto max_value =
         std::numeric_limits<T>::has_infinity ? std::numeric_limits<T>::infinity() : std::numeric_limits<T>::max();
 
-    const auto out_shape = util::reduce(in_shape, reduction_axes);
-    std::fill(out, out + shape_size(out_shape), max_value);
+    const auto reduce_chunk = [&](const size_t in_offset, const size_t out_offset, const Shape& shape) {
+        const auto in_chunk = in + in_offset;
+        const auto out_chunk = out + out_offset;
 
-    const auto in_strides = row_major_strides(in_shape);
-    const auto out_strides = row_major_strides(out_shape);
+        const auto out_shape = util::reduce(shape, reduction_axes);
+        std::fill(out_chunk, out_chunk + shape_size(out_shape), max_value);
 
-    CoordinateTransformBasic input_transform(in_shape);
-    for (const auto& in_coord : input_transform) {
-        const auto out_coord = util::reduce(in_coord, reduction_axes);
-        const auto in_idx = coordinate_offset(in_coord, in_strides);
-        const auto out_idx = coordinate_offset(out_coord, out_strides);
+        const auto in_strides = row_major_strides(shape);
+        const auto out_strides = row_major_strides(out_shape);
 
-        out[out_idx] = std::min(out[out_idx], in[in_idx]);
-    }
+        CoordinateTransformBasic input_transform(shape);
+        for (const auto& in_coord : input_transform) {
+            const auto out_coord = util::reduce(in_coord, reduction_axes);
+            const auto in_idx = coordinate_offset(in_coord, in_strides);
+            const auto out_idx = coordinate_offset(out_coord, out_strides);
+
+            out_chunk[out_idx] = std::min(out_chunk[out_idx], in_chunk[in_idx]);
+        }
+    };
+    parallel::for_each_reduction_chunk(in_shape, reduction_axes, reduce_chunk);
 }
 }  // namespace reference
 }  // namespace ov
@@ -10,6 +10,7 @@
 #include "openvino/core/shape_util.hpp"
 #include "openvino/reference/utils/coordinate_index.hpp"
 #include "openvino/reference/utils/coordinate_transform.hpp"
+#include "openvino/reference/utils/parallel.hpp"
 
 namespace ov {
 namespace reference {
@@ -23,20 +24,26 @@ namespace reference {
  */
 template <typename T>
 void reduce_prod(const T* arg, T* out, const Shape& in_shape, const AxisSet& reduction_axes) {
-    const auto out_shape = util::reduce(in_shape, reduction_axes);
-    std::fill(out, out + shape_size(out_shape), T(1));
+    const auto reduce_chunk = [&](const size_t in_offset, const size_t out_offset, const Shape& shape) {
+        const auto arg_chunk = arg + in_offset;
+        const auto out_chunk = out + out_offset;
 
-    const auto in_strides = row_major_strides(in_shape);
-    const auto out_strides = row_major_strides(out_shape);
+        const auto out_shape = util::reduce(shape, reduction_axes);
+        std::fill(out_chunk, out_chunk + shape_size(out_shape), T(1));
 
-    CoordinateTransformBasic input_transform(in_shape);
-    for (const auto& in_coord : input_transform) {
-        const auto out_coord = util::reduce(in_coord, reduction_axes);
-        const auto in_idx = coordinate_offset(in_coord, in_strides);
-        const auto out_idx = coordinate_offset(out_coord, out_strides);
+        const auto in_strides = row_major_strides(shape);
+        const auto out_strides = row_major_strides(out_shape);
 
-        out[out_idx] *= arg[in_idx];
-    }
+        CoordinateTransformBasic input_transform(shape);
+        for (const auto& in_coord : input_transform) {
+            const auto out_coord = util::reduce(in_coord, reduction_axes);
+            const auto in_idx = coordinate_offset(in_coord, in_strides);
+            const auto out_idx = coordinate_offset(out_coord, out_strides);
+
+            out_chunk[out_idx] *= arg_chunk[in_idx];
+        }
+    };
+    parallel::for_each_reduction_chunk(in_shape, reduction_axes, reduce_chunk);
 }
 }  // namespace reference
 }  // namespace ov
@@ -12,6 +12,7 @@
 #include "openvino/core/type/float16.hpp"
 #include "openvino/reference/utils/coordinate_index.hpp"
 #include "openvino/reference/utils/coordinate_transform.hpp"
+#include "openvino/reference/utils/parallel.hpp"
 #include "openvino/reference/utils/type_util.hpp"
 
 namespace ov {
@@ -72,23 +73,29 @@ T kahan_summation(const T in, const T prev_sum, T& compensation) {
  */
 template <typename T>
 void reduce_sum(const T* in, T* out, const Shape& in_shape, const AxisSet& reduction_axes) {
-    const auto out_shape = util::reduce(in_shape, reduction_axes);
+    const auto reduce_chunk = [&](const size_t in_offset, const size_t out_offset, const Shape& shape) {
+        const auto in_chunk = in + in_offset;
+        const auto out_chunk = out + out_offset;
 
-    const auto out_size = shape_size(out_shape);
-    std::vector<T> cs(out_size, T{0});
-    std::fill(out, std::next(out, out_size), T{0});
+        const auto out_shape = util::reduce(shape, reduction_axes);
 
-    const auto in_strides = row_major_strides(in_shape);
-    const auto out_strides = row_major_strides(out_shape);
+        const auto out_size = shape_size(out_shape);
+        std::vector<T> cs(out_size, T{0});
+        std::fill(out_chunk, std::next(out_chunk, out_size), T{0});
 
-    CoordinateTransformBasic input_transform(in_shape);
-    for (const auto& in_coord : input_transform) {
-        const auto out_coord = util::reduce(in_coord, reduction_axes);
-        const auto in_idx = coordinate_offset(in_coord, in_strides);
-        const auto out_idx = coordinate_offset(out_coord, out_strides);
+        const auto in_strides = row_major_strides(shape);
+        const auto out_strides = row_major_strides(out_shape);
 
-        out[out_idx] = details::kahan_summation(in[in_idx], out[out_idx], cs[out_idx]);
-    }
+        CoordinateTransformBasic input_transform(shape);
+        for (const auto& in_coord : input_transform) {
+            const auto out_coord = util::reduce(in_coord, reduction_axes);
+            const auto in_idx = coordinate_offset(in_coord, in_strides);
+            const auto out_idx = coordinate_offset(out_coord, out_strides);
+
+            out_chunk[out_idx] = details::kahan_summation(in_chunk[in_idx], out_chunk[out_idx], cs[out_idx]);
+        }
+    };
+    parallel::for_each_reduction_chunk(in_shape, reduction_axes, reduce_chunk);
 }
 }  // namespace reference
 }  // namespace ov
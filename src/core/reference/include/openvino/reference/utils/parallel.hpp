@@ -0,0 +1,127 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+#include "openvino/core/axis_set.hpp"
+#include "openvino/core/shape.hpp"
+
+namespace ov {
+namespace reference {
+namespace parallel {
+
+/**
+ * @brief Executes the body over the chunks of [0, work_amount), the chunks may run concurrently.
+ *
+ * @param work_amount  Number of the work items.
+ * @param grain        The chunk boundaries are multiples of the grain (except the end of the last chunk).
+ * @param body         Function processing the work items [begin, end).
+ */
+using Backend = void (*)(size_t work_amount, size_t grain, const std::function<void(size_t, size_t)>& body);
+
+/// @brief Minimal number of elements processed by a kernel to be worth running it in parallel.
+constexpr size_t min_parallel_size = 1 << 16;
+
+/// @brief Number of elements processed together, keeps sub-byte element types of the chunks on separate bytes.
+constexpr size_t block_size = 64;
+
+/**
+ * @brief Backend used by the kernels called from the current thread.
+ *
+ * The backend is not set by default, so the kernels run sequentially. The caller which can afford the threading
+ * (e.g. the constant folding) enables it with BackendScope.
+ */
+inline Backend& backend() {
+    thread_local Backend current = nullptr;
+    return current;
+}
+
+/// @brief Sets the backend of the kernels called from the current thread until the end of the scope.
+class BackendScope {
+public:
+    explicit BackendScope(Backend backend) : m_previous(parallel::backend()) {
+        parallel::backend() = backend;
+    }
+
+    ~BackendScope() {
+        parallel::backend() = m_previous;
+    }
+
+    BackendScope(const BackendScope&) = delete;
+    BackendScope& operator=(const BackendScope&) = delete;
+
+private:
+    Backend m_previous;
+};
+
+/**
+ * @brief Runs the body over the chunks of [0, work_amount) with the backend of the current thread.
+ *
+ * The body is called once for the whole range if the backend is not set or the work is too small.
+ *
+ * @param work_amount  Number of the work items.
+ * @param item_size    Number of elements processed per work item.
+ * @param body         Function processing the work items [begin, end).
+ * @param grain        The chunk boundaries are multiples of the grain.
+ */
+template <class F>
+void for_each_chunk(const size_t work_amount, const size_t item_size, F&& body, const size_t grain = 1) {
+    const auto run = backend();
+    if (run == nullptr || work_amount <= grain || work_amount * item_size < min_parallel_size) {
+        body(size_t{0}, work_amount);
+        return;
+    }
+    run(work_amount, grain, std::function<void(size_t, size_t)>(std::ref(body)));
+}
+
+/**
+ * @brief Runs the body over the blocks of the elements [0, count) with the backend of the current thread.
+ *
+ * @param count  Number of the elements.
+ * @param body   Function processing the elements [begin, end).
+ */
+template <class F>
+void for_each_block(const size_t count, F&& body) {
+    for_each_chunk(count, 1, std::forward<F>(body), block_size);
+}
+
+/**
+ * @brief Runs the reduction over the chunks of the outermost input dimension with the backend of the current thread.
+ *
+ * The input is split only if its outermost non-unit dimension is not reduced, so each chunk writes its own outputs.
+ *
+ * @param in_shape        Input shape.
+ * @param reduction_axes  Axes on which reduction is applied.
+ * @param body            Function reducing the chunk, called with the input offset, output offset and chunk shape.
+ */
+template <class F>
+void for_each_reduction_chunk(const Shape& in_shape, const AxisSet& reduction_axes, F&& body) {
+    size_t axis = 0;
+    while (axis < in_shape.size() && in_shape[axis] == 1) {
+        ++axis;
+    }
+    if (axis == in_shape.size() || reduction_axes.count(axis)) {
+        body(size_t{0}, size_t{0}, in_shape);
+        return;
+    }
+
+    const auto in_inner = shape_size(in_shape.begin() + axis + 1, in_shape.end());
+    size_t out_inner = 1;
+    for (size_t i = axis + 1; i < in_shape.size(); ++i) {
+        if (!reduction_axes.count(i)) {
+            out_inner *= in_shape[i];
+        }
+    }
+    for_each_chunk(in_shape[axis], in_inner, [&](const size_t begin, const size_t end) {
+        auto chunk_shape = in_shape;
+        chunk_shape[axis] = end - begin;
+        body(begin * in_inner, begin * out_inner, chunk_shape);
+    });
+}
+}  // namespace parallel
+}  // namespace reference
+}  // namespace ov
@@ -483,13 +483,17 @@ void convert_impl(const TI* arg, TO* out, size_t count) {
 #ifdef OV_CORE_USE_XBYAK_JIT
     if (util::may_i_use_dynamic_code()) {
         if (auto converter = jit_convert_array::get<TI, TO, Clamp::enabled>()) {
-            jit_convert_array::args_t args = {arg, out, count};
-            converter(&args);
+            parallel::for_each_block(count, [&](const size_t begin, const size_t end) {
+                jit_convert_array::args_t args = {arg + begin, out + begin, end - begin};
+                converter(&args);
+            });
             return;
         }
     }
 #endif  // OV_CORE_USE_XBYAK_JIT
-    Converter<TI, TO>::template apply<Clamp>(arg, out, count);
+    parallel::for_each_block(count, [&](const size_t begin, const size_t end) {
+        Converter<TI, TO>::template apply<Clamp>(arg + begin, out + begin, end - begin);
+    });
 }
 }  // namespace
 
@@ -43,17 +43,22 @@ void ov::descriptor::Input::replace_output(Output& new_output) {
         }
         m_output->remove_input(this);
     }
+    auto old_src_node = std::move(m_src_node);
     new_output.add_input(this);
     m_output = &new_output;
     m_src_node = std::shared_ptr<ov::Node>(new_output.get_node());
 
-    // Output replacement may change the topological order of nodes,
-    // so we have to reset cache by setting a flag into shared node info.
-    for_each(m_node->m_shared_rt_info.cbegin(),
-             m_node->m_shared_rt_info.cend(),
-             [](const std::shared_ptr<SharedRTInfo>& info) {
-                 info->set_use_topological_cache(false);
-             });
+    // Output replacement may change the topological order of nodes, so the node and the previous source are
+    // recorded into shared node info to update the cache around them.
+    if (!m_node->m_shared_rt_info.empty()) {
+        const auto node = m_node->shared_from_this();
+        for (const auto& info : m_node->m_shared_rt_info) {
+            info->add_changed_node(node);
+            if (old_src_node) {
+                info->add_changed_node(old_src_node);
+            }
+        }
+    }
 }
 
 void ov::descriptor::Input::replace_output(const std::shared_ptr<ov::Node>& node, size_t i) {
@@ -3,10 +3,13 @@
 //
 
 #include <algorithm>
+#include <functional>
 #include <list>
+#include <map>
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 
 #include "evaluator.hpp"
 #include "itt.hpp"
@@ -125,6 +128,297 @@ std::map<ov::Output<ov::Node>, ov::PartialShape> tensor_names_shapes_to_node_sha
     return const_pshape;
 }
 
+constexpr uint64_t order_label_step = 1 << 16;
+
+// More changes make the update of the cached order slower than the full sort
+size_t max_changed_nodes(size_t nodes_count) {
+    return std::max<size_t>(256, nodes_count / 8);
+}
+
+template <typename F>
+void for_each_producer(ov::Node* node, F&& f) {
+    for (size_t i = 0; i < node->get_input_size(); ++i) {
+        f(node->get_input_node_ptr(i));
+    }
+    for (const auto& dependency : node->get_control_dependencies()) {
+        f(dependency.get());
+    }
+}
+
+template <typename F>
+void for_each_consumer(ov::Node* node, F&& f) {
+    for (const auto& output : node->outputs()) {
+        for (const auto& input : output.get_target_inputs()) {
+            f(input.get_node());
+        }
+    }
+    for (const auto& dependent : node->get_control_dependents()) {
+        f(dependent);
+    }
+}
+
+// Updates the cached topological order after the localized changes of the graph:
+//  * the new nodes reached from the changed ones are inserted right before their first consumer,
+//  * the nodes which have no consumers in the model anymore are dropped,
+//  * the edges going backward in the order are fixed by Pearce-Kelly algorithm, which moves only the nodes between
+//    the ends of such edge.
+class TopologicalOrderUpdater {
+public:
+    using Order = std::map<uint64_t, std::pair<ov::Node*, std::weak_ptr<ov::Node>>>;
+    using Labels = std::unordered_map<ov::Node*, uint64_t>;
+
+    TopologicalOrderUpdater(Order& order, Labels& labels, std::function<bool(ov::Node*)> is_root)
+        : m_order(order),
+          m_labels(labels),
+          m_is_root(std::move(is_root)) {}
+
+    // Returns false if the order can't be updated and must be recomputed, e.g. the graph has a loop
+    bool update(const std::vector<std::weak_ptr<ov::Node>>& changed_nodes, ov::NodeVector& new_nodes) {
+        // keeps the changed nodes alive until the order is updated
+        ov::NodeVector changed;
+        for (const auto& changed_node : changed_nodes) {
+            if (auto node = changed_node.lock(); node && has_label(node.get())) {
+                changed.push_back(std::move(node));
+            }
+        }
+
+        std::unordered_set<ov::Node*> new_set;
+        ov::NodeVector new_list;
+        std::vector<ov::Node*> nodes_to_do;
+        for (const auto& node : changed) {
+            nodes_to_do.push_back(node.get());
+        }
+        while (!nodes_to_do.empty()) {
+            auto node = nodes_to_do.back();
+            nodes_to_do.pop_back();
+            for_each_producer(node, [&](ov::Node* producer) {
+                if (!has_label(producer) && new_set.insert(producer).second) {
+                    new_list.push_back(producer->shared_from_this());
+                    nodes_to_do.push_back(producer);
+                }
+            });
+        }
+
+        // the node stays in the model while any of its consumers is there
+        std::unordered_set<ov::Node*> removed;
+        const auto in_model = [&](ov::Node* node) {
+            return (new_set.count(node) || has_label(node)) && !removed.count(node);
+        };
+        for (const auto& node : changed) {
+            nodes_to_do.push_back(node.get());
+        }
+        for (const auto& node : new_list) {
+            nodes_to_do.push_back(node.get());
+        }
+        while (!nodes_to_do.empty()) {
+            auto node = nodes_to_do.back();
+            nodes_to_do.pop_back();
+            if (removed.count(node) || m_is_root(node)) {
+                continue;
+            }
+            bool has_consumers = false;
+            for_each_consumer(node, [&](ov::Node* consumer) {
+                has_consumers = has_consumers || in_model(consumer);
+            });
+            if (!has_consumers) {
+                removed.insert(node);
+                for_each_producer(node, [&](ov::Node* producer) {
+                    if (in_model(producer)) {
+                        nodes_to_do.push_back(producer);
+                    }
+                });
+            }
+        }
+        for (auto node : removed) {
+            if (!new_set.count(node)) {
+                m_order.erase(m_labels.at(node));
+                m_labels.erase(node);
+            }
+        }
+
+        // the new nodes in the topological order among themselves
+        ov::NodeVector new_ordered;
+        std::unordered_map<ov::Node*, bool /*is_done*/> new_visited;
+        for (const auto& root : new_list) {
+            if (removed.count(root.get()) || new_visited.count(root.get())) {
+                continue;
+            }
+            std::vector<std::pair<ov::Node*, bool /*producers_done*/>> stack{{root.get(), false}};
+            while (!stack.empty()) {
+                auto [node, producers_done] = stack.back();
+                stack.pop_back();
+                if (producers_done) {
+                    new_visited[node] = true;
+                    new_ordered.push_back(node->shared_from_this());
+                    continue;
+                }
+                if (new_visited.count(node)) {
+                    if (!new_visited[node]) {
+                        return false;
+                    }
+                    continue;
+                }
+                new_visited[node] = false;
+                stack.emplace_back(node, true);
+                bool has_loop = false;
+                for_each_producer(node, [&](ov::Node* producer) {
+                    if (new_set.count(producer) && !removed.count(producer)) {
+                        auto visited = new_visited.find(producer);
+                        if (visited == new_visited.end()) {
+                            stack.emplace_back(producer, false);
+                        } else if (!visited->second) {
+                            has_loop = true;
+                        }
+                    }
+                });
+                if (has_loop) {
+                    return false;
+                }
+            }
+        }
+
+        // the consumers of the new node are placed already, so it goes right before the first of them
+        for (auto it = new_ordered.rbegin(); it != new_ordered.rend(); ++it) {
+            ov::Node* first_consumer = nullptr;
+            for_each_consumer(it->get(), [&](ov::Node* consumer) {
+                if (has_label(consumer) && (!first_consumer || m_labels.at(consumer) < m_labels.at(first_consumer))) {
+                    first_consumer = consumer;
+                }
+            });
+            if (!first_consumer) {
+                return false;
+            }
+            insert_before(*it, first_consumer);
+        }
+
+        // only the inputs of the changed and the new nodes may go backward in the order
+        std::vector<std::pair<ov::Node*, ov::Node*>> edges;
+        const auto collect_edges = [&](ov::Node* node) {
+            for_each_producer(node, [&](ov::Node* producer) {
+                if (has_label(producer) && m_labels.at(producer) > m_labels.at(node)) {
+                    edges.emplace_back(producer, node);
+                }
+            });
+        };
+        for (const auto& node : changed) {
+            if (!removed.count(node.get())) {
+                collect_edges(node.get());
+            }
+        }
+        for (const auto& node : new_ordered) {
+            collect_edges(node.get());
+        }
+        for (const auto& [producer, consumer] : edges) {
+            if (m_labels.at(producer) > m_labels.at(consumer) && !reorder(producer, consumer)) {
+                return false;
+            }
+        }
+        new_nodes = std::move(new_ordered);
+        return true;
+    }
+
+private:
+    bool has_label(ov::Node* node) const {
+        const auto label = m_labels.find(node);
+        // the address of the destroyed node may be reused by a new one
+        return label != m_labels.end() && m_order.at(label->second).second.lock().get() == node;
+    }
+
+    void insert_before(const std::shared_ptr<ov::Node>& node, ov::Node* next) {
+        const auto next_it = m_order.find(m_labels.at(next));
+        const auto prev_label = next_it == m_order.begin() ? 0 : std::prev(next_it)->first;
+        if (next_it->first - prev_label < 2) {
+            relabel();
+            insert_before(node, next);
+            return;
+        }
+        const auto label = prev_label + (next_it->first - prev_label) / 2;
+        m_order.emplace_hint(next_it, label, std::make_pair(node.get(), std::weak_ptr<ov::Node>(node)));
+        m_labels[node.get()] = label;
+    }
+
+    void relabel() {
+        Order order;
+        uint64_t label = 0;
+        for (const auto& [old_label, node] : m_order) {
+            if (node.second.expired()) {
+                const auto found = m_labels.find(node.first);
+                if (found != m_labels.end() && found->second == old_label) {
+                    m_labels.erase(found);
+                }
+                continue;
+            }
+            label += order_label_step;
+            order.emplace_hint(order.end(), label, node);
+            m_labels[node.first] = label;
+        }
+        m_order = std::move(order);
+    }
+
+    // Pearce-Kelly: the consumer and the nodes depending on it which are placed before the producer are moved after
+    // the producer and the nodes it depends on, the set of the labels of the moved nodes stays the same
+    bool reorder(ov::Node* producer, ov::Node* consumer) {
+        const auto lower = m_labels.at(consumer);
+        const auto upper = m_labels.at(producer);
+
+        std::vector<ov::Node*> forward{consumer};
+        std::unordered_set<ov::Node*> visited{consumer};
+        for (size_t i = 0; i < forward.size(); ++i) {
+            const auto label = m_labels.at(forward[i]);
+            bool has_loop = false;
+            for_each_consumer(forward[i], [&](ov::Node* node) {
+                if (node == producer) {
+                    has_loop = true;
+                } else if (has_label(node) && m_labels.at(node) > label && m_labels.at(node) < upper &&
+                           visited.insert(node).second) {
+                    forward.push_back(node);
+                }
+            });
+            if (has_loop) {
+                return false;
+            }
+        }
+
+        std::vector<ov::Node*> backward{producer};
+        visited.insert(producer);
+        for (size_t i = 0; i < backward.size(); ++i) {
+            const auto label = m_labels.at(backward[i]);
+            for_each_producer(backward[i], [&](ov::Node* node) {
+                if (has_label(node) && m_labels.at(node) < label && m_labels.at(node) > lower &&
+                    visited.insert(node).second) {
+                    backward.push_back(node);
+                }
+            });
+        }
+
+        const auto by_label = [&](ov::Node* lhs, ov::Node* rhs) {
+            return m_labels.at(lhs) < m_labels.at(rhs);
+        };
+        std::sort(forward.begin(), forward.end(), by_label);
+        std::sort(backward.begin(), backward.end(), by_label);
+        std::vector<uint64_t> labels;
+        std::vector<std::pair<ov::Node*, std::weak_ptr<ov::Node>>> nodes;
+        for (auto nodes_to_move : {&backward, &forward}) {
+            for (auto node : *nodes_to_move) {
+                const auto label = m_order.find(m_labels.at(node));
+                labels.push_back(label->first);
+                nodes.push_back(std::move(label->second));
+                m_order.erase(label);
+            }
+        }
+        std::sort(labels.begin(), labels.end());
+        for (size_t i = 0; i < labels.size(); ++i) {
+            m_labels[nodes[i].first] = labels[i];
+            m_order.emplace(labels[i], std::move(nodes[i]));
+        }
+        return true;
+    }
+
+    Order& m_order;
+    Labels& m_labels;
+    std::function<bool(ov::Node*)> m_is_root;
+};
+
 }  // namespace
 
 ov::Model::Model(const ResultVector& results, const ov::ParameterVector& parameters, const std::string& name)
@@ -295,6 +589,48 @@ std::vector<shared_ptr<ov::Node>> ov::Model::get_ordered_ops() const {
         return nodes;
     }
 
+    if (m_update_topological_cache && m_shared_rt_info->can_update_topological_cache()) {
+        const auto is_root = [this](Node* node) {
+            const auto is_node = [node](const std::shared_ptr<Node>& root) {
+                return root.get() == node;
+            };
+            if (ov::op::util::is_output(node)) {
+                return std::any_of(m_results.begin(), m_results.end(), is_node);
+            } else if (ov::op::util::is_parameter(node)) {
+                return std::any_of(m_parameters.begin(), m_parameters.end(), is_node);
+            } else if (ov::op::util::is_sink(node)) {
+                return std::any_of(m_sinks.begin(), m_sinks.end(), is_node);
+            }
+            return false;
+        };
+        NodeVector new_nodes;
+        TopologicalOrderUpdater updater(m_cached_order, m_cached_ops, is_root);
+        if (updater.update(m_shared_rt_info->get_changed_nodes(), new_nodes)) {
+            for (const auto& node : new_nodes) {
+                node->insert_info(m_shared_rt_info);
+            }
+            m_cached_ordered_ops.clear();
+            for (auto it = m_cached_order.begin(); it != m_cached_order.end();) {
+                if (auto node = it->second.second.lock()) {
+                    m_cached_ordered_ops.push_back(node);
+                    *node_inserter = std::move(node);
+                    ++it;
+                } else {
+                    const auto label = m_cached_ops.find(it->second.first);
+                    if (label != m_cached_ops.end() && label->second == it->first) {
+                        m_cached_ops.erase(label);
+                    }
+                    it = m_cached_order.erase(it);
+                }
+            }
+            m_cached_output_names.clear();
+            m_cached_op_names.clear();
+            m_shared_rt_info->set_use_topological_cache(true);
+            m_shared_rt_info->set_max_changed_nodes(max_changed_nodes(nodes.size()));
+            return nodes;
+        }
+    }
+
     for (const auto& r : get_results()) {
         *node_inserter = r;
     }
@@ -310,14 +646,20 @@ std::vector<shared_ptr<ov::Node>> ov::Model::get_ordered_ops() const {
     // Update nodes cache and update all nodes to have shared rt info
     // which belongs to the current Model.
     m_cached_ordered_ops.clear();
-    for_each(order.cbegin(), order.cend(), [this](const shared_ptr<Node>& node) {
+    m_cached_order.clear();
+    m_cached_ops.clear();
+    uint64_t label = 0;
+    for_each(order.cbegin(), order.cend(), [&](const shared_ptr<Node>& node) {
+        label += order_label_step;
         m_cached_ordered_ops.push_back(node);
-        m_cached_ops.insert(node.get());
+        m_cached_order.emplace_hint(m_cached_order.end(), label, std::make_pair(node.get(), std::weak_ptr<Node>(node)));
+        m_cached_ops.emplace(node.get(), label);
         node->insert_info(m_shared_rt_info);
     });
     m_cached_output_names.clear();
     m_cached_op_names.clear();
     m_shared_rt_info->set_use_topological_cache(true);
+    m_shared_rt_info->set_max_changed_nodes(max_changed_nodes(order.size()));
 
     return order;
 }
@@ -447,6 +789,8 @@ void ov::Model::replace_parameter(size_t parameter_index, const shared_ptr<ov::o
 
 void ov::Model::set_topological_sort(topological_sort_t sorter) {
     m_topological_sorter = std::move(sorter);
+    // the order given by the custom sorter can't be updated incrementally
+    m_update_topological_cache = false;
     // reset topological nodes order cache as new sorter can have different behaviour
     m_shared_rt_info->set_use_topological_cache(false);
 }
@@ -935,8 +1279,10 @@ ov::Output<ov::Node> ov::Model::add_output(const ov::Output<ov::Node>& port) {
     if (m_shared_rt_info->get_use_topological_cache()) {
         if (cache_valid()) {
             // Full update of topological cache is not needed, 'result' can be just inserted to the end
+            const auto label = (m_cached_order.empty() ? 0 : m_cached_order.rbegin()->first) + order_label_step;
             m_cached_ordered_ops.push_back(result);
-            m_cached_ops.insert(result.get());
+            m_cached_order.emplace_hint(m_cached_order.end(), label, std::make_pair(result.get(), result));
+            m_cached_ops.emplace(result.get(), label);
             result->insert_info(m_shared_rt_info);  // Just for consistency, not required for Result nodes
         } else {
             m_shared_rt_info->set_use_topological_cache(false);
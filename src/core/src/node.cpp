@@ -107,10 +107,14 @@ ov::Node::Node(const OutputVector& arguments, size_t output_size) : Node() {
 
 ov::Node::~Node() {
     try {
-        // raise a flag to reset nodes cache
-        for_each(m_shared_rt_info.cbegin(), m_shared_rt_info.cend(), [](const std::shared_ptr<SharedRTInfo>& info) {
-            info->set_use_topological_cache(false);
-        });
+        // the sources of the node may lose their last consumer, so they are recorded to update nodes cache
+        for (const auto& info : m_shared_rt_info) {
+            for (descriptor::Input& input : m_inputs) {
+                if (input.has_output()) {
+                    info->add_changed_node(input.get_output().get_node());
+                }
+            }
+        }
 
         for (descriptor::Input& input : m_inputs) {
             if (input.has_output()) {
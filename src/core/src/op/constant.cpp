@@ -7,6 +7,7 @@
 #include <cmath>
 #include <cstdio>
 #include <cstring>
+#include <limits>
 #include <sstream>
 
 #include "compare.hpp"
@@ -23,6 +24,7 @@
 #include "openvino/runtime/shared_buffer.hpp"
 #include "openvino/runtime/string_aligned_buffer.hpp"
 #include "openvino/runtime/tensor.hpp"
+#include "openvino/util/common_util.hpp"
 #include "openvino/util/variant_visitor.hpp"
 
 namespace ov::op {
@@ -579,6 +581,39 @@ bool Constant::get_all_data_elements_bitwise_identical() const {
     return m_all_elements_bitwise_identical;
 }
 
+std::shared_ptr<IBufferDescriptor> Constant::get_mapped_descriptor() const {
+    const auto descriptor = m_data ? m_data->get_descriptor() : nullptr;
+    // the id is unknown for the memory mapped from a file handle
+    if (!descriptor || descriptor->get_id() == std::numeric_limits<size_t>::max() || !descriptor->get_source_buffer()) {
+        return nullptr;
+    }
+    return descriptor;
+}
+
+std::optional<uint64_t> Constant::get_data_fingerprint() const {
+    const auto descriptor = get_mapped_descriptor();
+    if (!descriptor) {
+        return std::nullopt;
+    }
+    auto seed = util::u64_hash_combine(descriptor->get_id(), descriptor->get_offset());
+    seed = util::u64_hash_combine(seed, m_data->size());
+    seed = util::u64_hash_combine(seed, m_element_type.hash());
+    for (const auto dim : m_shape) {
+        seed = util::u64_hash_combine(seed, dim);
+    }
+    return seed;
+}
+
+bool Constant::has_same_mapped_data(const Constant& other) const {
+    if (m_element_type != other.m_element_type || m_shape != other.m_shape) {
+        return false;
+    }
+    const auto descriptor = get_mapped_descriptor();
+    const auto other_descriptor = other.get_mapped_descriptor();
+    return descriptor && other_descriptor && descriptor->get_id() == other_descriptor->get_id() &&
+           descriptor->get_offset() == other_descriptor->get_offset() && m_data->size() == other.m_data->size();
+}
+
 void Constant::alloc_buffer_on_visit_attributes(bool val) {
     m_alloc_buffer_on_visit_attributes = val;
 }
@@ -4,8 +4,12 @@
 
 #include "openvino/pass/constant_folding.hpp"
 
+#include <algorithm>
+#include <functional>
+
 #include "openvino/cc/pass/itt.hpp"
 #include "openvino/core/constant_fold_utils.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/core/rt_info.hpp"
 #include "openvino/core/rt_info/weightless_caching_attributes.hpp"
 #include "openvino/op/constant.hpp"
@@ -14,6 +18,7 @@
 #include "openvino/op/util/read_value_base.hpp"
 #include "openvino/op/util/shape_of_base.hpp"
 #include "openvino/op/util/sub_graph_base.hpp"
+#include "openvino/reference/utils/parallel.hpp"
 #include "transformations/rt_info/decompression.hpp"
 #include "transformations/rt_info/dequantization_node.hpp"
 
@@ -101,9 +106,28 @@ static void remove_requires_precision_conversion_attribute(const std::shared_ptr
     }
 }
 
+/**
+ * \brief Backend of the reference kernels evaluated by the constant folding, splits the work between the threads.
+ */
+static void fold_in_parallel(size_t work_amount, size_t grain, const std::function<void(size_t, size_t)>& body) {
+    const auto num_blocks = (work_amount + grain - 1) / grain;
+    ov::parallel_nt(0, [&](const int ithr, const int nthr) {
+        // the kernels called by the chunk run sequentially
+        ov::reference::parallel::BackendScope sequential(nullptr);
+        size_t start = 0, end = 0;
+        ov::splitter(num_blocks, nthr, ithr, start, end);
+        if (start < end) {
+            body(start * grain, std::min(end * grain, work_amount));
+        }
+    });
+}
+
 bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& model) {
     RUN_ON_MODEL_SCOPE(ConstantFolding);
 
+    // large constants (e.g. decompressed weights) are folded on all the cores
+    ov::reference::parallel::BackendScope parallel_kernels(fold_in_parallel);
+
     bool rewritten = pre_calculated_values_folding(model);
 
     // Creating a local vector and moving each element to reduce memory peak.
@@ -5,7 +5,9 @@
 #include "openvino/pass/graph_rewrite.hpp"
 
 #include <algorithm>
+#include <chrono>
 #include <deque>
+#include <fstream>
 #include <iostream>
 #include <regex>
 #include <string>
@@ -16,7 +18,15 @@
 #include "openvino/core/log_util.hpp"
 #include "openvino/op/util/multi_subgraph_base.hpp"
 #include "openvino/pass/backward_graph_rewrite.hpp"
+#include "openvino/pass/pattern/op/any.hpp"
+#include "openvino/pass/pattern/op/any_of.hpp"
+#include "openvino/pass/pattern/op/any_output.hpp"
+#include "openvino/pass/pattern/op/label.hpp"
+#include "openvino/pass/pattern/op/optional.hpp"
+#include "openvino/pass/pattern/op/or.hpp"
 #include "openvino/pass/pattern/op/wrap_type.hpp"
+#include "openvino/util/common_util.hpp"
+#include "openvino/util/env_util.hpp"
 #include "openvino/util/log.hpp"
 #include "perf_counters.hpp"
 
@@ -66,6 +76,58 @@ PerfCounters& perf_counters_graph_rewrite() {
 }  // namespace ov
 
 #endif  // ENABLE_PROFILING_ITT_FULL
+
+namespace {
+// Collects the node types the pattern root may match. Returns false if the root may match a node of any type.
+bool collect_root_types(const std::shared_ptr<ov::Node>& root, std::vector<ov::NodeTypeInfo>& types) {
+    using namespace ov::pass::pattern::op;
+    const auto pattern = ov::as_type_ptr<Pattern>(root);
+    if (!pattern) {
+        types.push_back(root->get_type_info());
+        return true;
+    }
+    if (ov::is_type<AnyOutput>(pattern)) {
+        return collect_root_types(pattern->get_input_node_shared_ptr(0), types);
+    }
+    if (const auto wrap_type = ov::as_type_ptr<WrapType>(pattern)) {
+        const auto& wrapped_types = wrap_type->get_wrapped_types();
+        types.insert(types.end(), wrapped_types.begin(), wrapped_types.end());
+        return true;
+    }
+    if (ov::is_type<Or>(pattern)) {
+        for (const auto& input : pattern->input_values()) {
+            if (!collect_root_types(input.get_node_shared_ptr(), types)) {
+                return false;
+            }
+        }
+        return true;
+    }
+    if (const auto optional = ov::as_type_ptr<Optional>(pattern)) {
+        // either the optional node itself or its first input
+        const auto optional_types = optional->get_optional_types();
+        types.insert(types.end(), optional_types.begin(), optional_types.end());
+        return optional->get_input_size() == 0 || collect_root_types(optional->get_input_node_shared_ptr(0), types);
+    }
+    const auto& type_hints = pattern->get_predicate().get_type_hints();
+    const bool checks_predicate =
+        ov::is_type<Label>(pattern) || ov::is_type<Any>(pattern) || ov::is_type<AnyOf>(pattern);
+    if (checks_predicate && !type_hints.empty()) {
+        types.insert(types.end(), type_hints.begin(), type_hints.end());
+        return true;
+    }
+    if (ov::is_type<Label>(pattern)) {
+        // the label also matches its input
+        return collect_root_types(pattern->get_input_node_shared_ptr(0), types);
+    }
+    return false;
+}
+
+const std::string& profile_pass_env() {
+    static const std::string value = ov::util::getenv_string("OV_ENABLE_PROFILE_PASS");
+    return value;
+}
+}  // namespace
+
 std::shared_ptr<ov::pass::MatcherPass> ov::pass::GraphRewrite::add_matcher(
     const std::shared_ptr<ov::pass::MatcherPass>& pass) {
     auto pass_config = get_pass_config();
@@ -101,46 +163,52 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
     bool rewritten = false;
     const auto& pass_config = get_pass_config();
 
-    // Check that all Matchers in MatcherPasses has type bases root node
-    bool all_roots_has_type = true;
+    // The matchers are indexed by the node types their roots may match. The matchers with a root that may match a
+    // node of any type (e.g. a predicate without type hints) are kept in the generic list and run for every node.
     std::unordered_map<NodeTypeInfo, std::vector<size_t>> type_to_matcher;
+    std::vector<size_t> generic_matchers;
+    std::vector<NodeTypeInfo> root_types;
     for (size_t matcher_index = 0; matcher_index < m_matchers.size(); ++matcher_index) {
         // Skip passes that are disabled
         if (pass_config->is_disabled(m_matchers[matcher_index]->get_type_info()))
             continue;
 
         auto matcher = m_matchers[matcher_index]->get_matcher();
-        if (!matcher) {
-            all_roots_has_type = false;
-            break;
+        root_types.clear();
+        if (matcher && collect_root_types(matcher->get_pattern_value().get_node_shared_ptr(), root_types)) {
+            for (const auto& root_type_info : root_types) {
+                type_to_matcher[root_type_info].push_back(matcher_index);
+            }
+        } else {
+            generic_matchers.push_back(matcher_index);
         }
+    }
 
-        auto root = matcher->get_pattern_value().get_node_shared_ptr();
-        // pattern::op::AnyOutput operation automatically appends for multi output operations inside
-        // Matcher and to gen actual root node we need to take it's parent.
-        if (auto any_type = ov::as_type_ptr<pattern::op::AnyOutput>(root)) {
-            root = any_type->input_value(0).get_node_shared_ptr();
+    // The matchers for a node type also include the ones registered for its parent types. The list is built once
+    // per type and runs in the order of the registration.
+    std::unordered_map<const DiscreteTypeInfo*, std::vector<size_t>> node_type_to_matchers;
+    auto get_matchers = [&](const DiscreteTypeInfo& node_type) -> const std::vector<size_t>& {
+        auto found = node_type_to_matchers.find(&node_type);
+        if (found != node_type_to_matchers.end()) {
+            return found->second;
         }
-
-        // if root is an operation from opset or has pattern::op::WrapType type then we can extract
-        // it's type
-        // and use it in unordered_map as key for fast MatcherPass search. Otherwise type is unknown
-        // and default algorithm is used.
-        if (auto p = std::dynamic_pointer_cast<pattern::op::Pattern>(root)) {
-            if (auto any_type = ov::as_type_ptr<ov::pass::pattern::op::WrapType>(p)) {
-                for (const auto& root_type_info : any_type->get_wrapped_types()) {
-                    type_to_matcher[root_type_info].push_back(matcher_index);
-                }
-            } else {
-                all_roots_has_type = false;
-                break;
+        auto& matchers = node_type_to_matchers[&node_type];
+        matchers = generic_matchers;
+        for (auto node_type_info = &node_type; node_type_info; node_type_info = node_type_info->parent) {
+            auto type_matchers = type_to_matcher.find(*node_type_info);
+            if (type_matchers != type_to_matcher.end()) {
+                matchers.insert(matchers.end(), type_matchers->second.begin(), type_matchers->second.end());
             }
-        } else {
-            type_to_matcher[root->get_type_info()].push_back(matcher_index);
         }
+        std::sort(matchers.begin(), matchers.end());
+        // a root with several types may be registered for both a type and its parent
+        matchers.erase(std::unique(matchers.begin(), matchers.end()), matchers.end());
+        return matchers;
+    };
 
-        // TODO: traverse parents for root_type_info in order to register complete list of matchers
-        // including ones triggered by parent type info.
+    std::unique_ptr<MatcherPerfCounters> matcher_counters;
+    if (!profile_pass_env().empty()) {
+        matcher_counters = std::make_unique<MatcherPerfCounters>();
     }
 
     // This lambda preforms execution of particular MatcherPass on given node.
@@ -159,7 +227,14 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
 
         // Apply MatcherPass. In case if it returns true no other MatcherPasses will apply
         // to this node
-        bool status = m_pass->apply(std::move(node));
+        bool status = false;
+        if (matcher_counters) {
+            const auto start = std::chrono::steady_clock::now();
+            status = m_pass->apply(std::move(node));
+            matcher_counters->add(m_pass->get_name(), std::chrono::steady_clock::now() - start, status);
+        } else {
+            status = m_pass->apply(std::move(node));
+        }
 
         // In case if MatcherPass registered nodes they will be added to the beginning of execution
         // queue
@@ -175,9 +250,6 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
         return status;
     };
 
-    // list of matchers to run for a node; define here to keep memory allocated
-    std::vector<size_t> matcher_passes_to_run;
-
     while (!nodes_to_run.empty()) {
         auto weak_node = nodes_to_run.front();
         nodes_to_run.pop_front();
@@ -200,47 +272,23 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
         if (m_enable_shape_inference) {
             node->revalidate_and_infer_types();
         }
-        // If all Matchers in MatcherPasses has type based root node then we apply efficient
-        // algorithm for finding matchers
-        if (all_roots_has_type) {
-            const DiscreteTypeInfo* node_type_info = &node->get_type_info();
-            matcher_passes_to_run.clear();
-            while (node_type_info) {
-                auto matchers = type_to_matcher.find(*node_type_info);
-                if (matchers != type_to_matcher.end()) {
-                    // do not run found matchers immediately, need to collect all matchers for
-                    // parents
-                    // and sort them in order of the registration
-                    matcher_passes_to_run.insert(matcher_passes_to_run.end(),
-                                                 matchers->second.begin(),
-                                                 matchers->second.end());
-                }
-                node_type_info = node_type_info->parent;
-            }
-
-            std::sort(matcher_passes_to_run.begin(), matcher_passes_to_run.end());
-
-            // TODO: type_to_matcher with just collected list of matchers to enable
-            // fast processing at the next time when node with the same type will be processed
-
-            for (size_t matcher_index : matcher_passes_to_run) {
-                if (run_matcher_pass(m_matchers[matcher_index], node)) {
-                    rewritten = true;
-                    break;
-                }
+        for (size_t matcher_index : get_matchers(node->get_type_info())) {
+            if (run_matcher_pass(m_matchers[matcher_index], node)) {
+                rewritten = true;
+                break;
             }
         }
-        // Otherwise we use default algorithm that iterates over all registered matcher passes
-        else {
-            for (auto& m_pass : m_matchers) {
-                // Skip passes that are disabled
-                if (pass_config->is_disabled(m_pass->get_type_info()))
-                    continue;
+    }
 
-                if (run_matcher_pass(m_pass, node)) {
-                    rewritten = true;
-                    break;
-                }
+    if (matcher_counters) {
+        const auto& profile_pass = profile_pass_env();
+        const auto& profile_pass_lower = ov::util::to_lower(profile_pass);
+        if (profile_pass_lower == "1" || profile_pass_lower == "true" || profile_pass_lower == "on") {
+            matcher_counters->dump(std::cout, get_name(), false);
+        } else if (profile_pass_lower != "0" && profile_pass_lower != "false" && profile_pass_lower != "off") {
+            std::ofstream file(profile_pass, std::ios_base::app);
+            if (file.is_open()) {
+                matcher_counters->dump(file, get_name(), true);
             }
         }
     }
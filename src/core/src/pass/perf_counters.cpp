@@ -3,6 +3,10 @@
 //
 #include "perf_counters.hpp"
 
+#include <algorithm>
+#include <iomanip>
+#include <vector>
+
 namespace ov {
 namespace pass {
 openvino::itt::handle_t PerfCounters::operator[](const ov::Node::type_info_t& type_inf) {
@@ -12,5 +16,29 @@ openvino::itt::handle_t PerfCounters::operator[](const ov::Node::type_info_t& ty
         return it->second;
     return m_counters[&type_inf] = openvino::itt::handle(type_inf.name);
 }
+
+void MatcherPerfCounters::add(const std::string& matcher_name, std::chrono::nanoseconds time, bool applied) {
+    auto& counter = m_counters[matcher_name];
+    counter.calls++;
+    counter.applied += applied ? 1 : 0;
+    counter.time += time;
+}
+
+void MatcherPerfCounters::dump(std::ostream& out, const std::string& graph_rewrite_name, bool as_records) const {
+    std::vector<std::pair<std::string, Counter>> counters(m_counters.begin(), m_counters.end());
+    std::sort(counters.begin(), counters.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs.second.time > rhs.second.time;
+    });
+    for (const auto& [name, counter] : counters) {
+        if (as_records) {
+            out << "mt;" << name << ";" << graph_rewrite_name << ";" << counter.time.count() << ";" << counter.calls
+                << ";" << counter.applied << std::endl;
+        } else {
+            out << "    " << std::setw(58) << std::left << name << std::setw(8) << std::right
+                << std::chrono::duration_cast<std::chrono::microseconds>(counter.time).count() << "us " << counter.applied
+                << "/" << counter.calls << std::endl;
+        }
+    }
+}
 }  // namespace pass
 }  // namespace ov
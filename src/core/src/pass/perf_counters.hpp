@@ -3,8 +3,11 @@
 //
 #pragma once
 
+#include <chrono>
 #include <itt.hpp>
 #include <mutex>
+#include <ostream>
+#include <string>
 #include <unordered_map>
 
 #include "openvino/core/node.hpp"
@@ -28,5 +31,23 @@ private:
     std::mutex m_mutex;
     counters_map m_counters;
 };
+
+// Execution time of the matcher passes inside one GraphRewrite run
+class MatcherPerfCounters {
+public:
+    void add(const std::string& matcher_name, std::chrono::nanoseconds time, bool applied);
+
+    // prints the matchers by time in descending order, as a table or as the `mt;` records of the profiling file
+    void dump(std::ostream& out, const std::string& graph_rewrite_name, bool as_records) const;
+
+private:
+    struct Counter {
+        size_t calls = 0;
+        size_t applied = 0;
+        std::chrono::nanoseconds time{0};
+    };
+
+    std::unordered_map<std::string, Counter> m_counters;
+};
 }  // namespace pass
 }  // namespace ov
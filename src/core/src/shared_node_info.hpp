@@ -7,21 +7,55 @@
 #include <memory>
 #include <openvino/core/except.hpp>
 #include <openvino/core/node.hpp>
+#include <vector>
 
 namespace ov {
 class SharedRTInfo {
 public:
-    SharedRTInfo() : m_use_topological_cache(false) {}
+    SharedRTInfo() : m_use_topological_cache(false), m_can_update_topological_cache(false) {}
 
+    // Any change which is not recorded by add_changed_node() requires the full topological sort
     void set_use_topological_cache(bool status) {
         m_use_topological_cache = status;
+        m_can_update_topological_cache = status;
+        m_changed_nodes.clear();
     }
 
     bool get_use_topological_cache() const {
         return m_use_topological_cache;
     }
 
+    // Records the node which inputs or consumers were changed, so the cached order can be updated around it.
+    // Too many changes make the update more expensive than the sort, then the order is recomputed.
+    void add_changed_node(const std::shared_ptr<Node>& node) {
+        m_use_topological_cache = false;
+        if (!m_can_update_topological_cache) {
+            return;
+        }
+        if (m_changed_nodes.size() >= m_max_changed_nodes) {
+            m_can_update_topological_cache = false;
+            m_changed_nodes.clear();
+            return;
+        }
+        m_changed_nodes.emplace_back(node);
+    }
+
+    bool can_update_topological_cache() const {
+        return m_can_update_topological_cache;
+    }
+
+    const std::vector<std::weak_ptr<Node>>& get_changed_nodes() const {
+        return m_changed_nodes;
+    }
+
+    void set_max_changed_nodes(size_t max_changed_nodes) {
+        m_max_changed_nodes = max_changed_nodes;
+    }
+
 private:
     bool m_use_topological_cache;
+    bool m_can_update_topological_cache;
+    size_t m_max_changed_nodes = 0;
+    std::vector<std::weak_ptr<Node>> m_changed_nodes;
 };
 }  // namespace ov
@@ -6,13 +6,17 @@
 
 #include <gtest/gtest.h>
 
+#include <filesystem>
+#include <fstream>
 #include <memory>
 
+#include "common_test_utils/common_utils.hpp"
 #include "common_test_utils/test_assertions.hpp"
 #include "common_test_utils/type_prop.hpp"
 #include "openvino/core/except.hpp"
 #include "openvino/runtime/aligned_buffer.hpp"
 #include "openvino/runtime/shared_buffer.hpp"
+#include "openvino/util/mmap_object.hpp"
 
 namespace ov {
 namespace test {
@@ -2933,6 +2937,81 @@ TEST(constant, dynamic_type_cast_vector_throws) {
     EXPECT_THROW(c.cast_vector<int64_t>(), ov::Exception);
 }
 
+TEST(constant, data_fingerprint_of_mapped_data) {
+    const std::filesystem::path file_path = ov::test::utils::generateTestFilePrefix() + "_weights.bin";
+    {
+        std::ofstream os(file_path, std::ios::binary);
+        const std::vector<char> data(16, 1);
+        os.write(data.data(), data.size());
+    }
+    {
+        auto mapped_memory = ov::load_mmap_object(file_path);
+        auto mapped_buffer = std::make_shared<ov::SharedBuffer<std::shared_ptr<ov::MappedMemory>>>(
+            mapped_memory->data(),
+            mapped_memory->size(),
+            mapped_memory);
+        const auto view = [&](size_t offset, size_t size) {
+            return std::make_shared<ov::SharedBuffer<std::shared_ptr<ov::AlignedBuffer>>>(
+                mapped_memory->data() + offset,
+                size,
+                mapped_buffer);
+        };
+
+        const auto fingerprint = op::v0::Constant(element::u8, Shape{8}, view(0, 8)).get_data_fingerprint();
+        ASSERT_TRUE(fingerprint.has_value());
+        EXPECT_EQ(fingerprint, op::v0::Constant(element::u8, Shape{8}, view(0, 8)).get_data_fingerprint());
+        // the same data, but another offset, type or shape
+        EXPECT_NE(fingerprint, op::v0::Constant(element::u8, Shape{8}, view(8, 8)).get_data_fingerprint());
+        EXPECT_NE(fingerprint, op::v0::Constant(element::i8, Shape{8}, view(0, 8)).get_data_fingerprint());
+        EXPECT_NE(fingerprint, op::v0::Constant(element::u8, Shape{2, 4}, view(0, 8)).get_data_fingerprint());
+    }
+    std::filesystem::remove(file_path);
+}
+
+TEST(constant, same_mapped_data) {
+    const std::filesystem::path file_path = ov::test::utils::generateTestFilePrefix() + "_weights.bin";
+    {
+        std::ofstream os(file_path, std::ios::binary);
+        const std::vector<char> data(16, 1);
+        os.write(data.data(), data.size());
+    }
+    {
+        auto mapped_memory = ov::load_mmap_object(file_path);
+        auto mapped_buffer = std::make_shared<ov::SharedBuffer<std::shared_ptr<ov::MappedMemory>>>(
+            mapped_memory->data(),
+            mapped_memory->size(),
+            mapped_memory);
+        const auto view = [&](size_t offset, size_t size) {
+            return std::make_shared<ov::SharedBuffer<std::shared_ptr<ov::AlignedBuffer>>>(
+                mapped_memory->data() + offset,
+                size,
+                mapped_buffer);
+        };
+
+        const op::v0::Constant constant(element::u8, Shape{8}, view(0, 8));
+        EXPECT_TRUE(constant.has_same_mapped_data(op::v0::Constant(element::u8, Shape{8}, view(0, 8))));
+        // the same data, but another offset, size, type or shape
+        EXPECT_FALSE(constant.has_same_mapped_data(op::v0::Constant(element::u8, Shape{8}, view(8, 8))));
+        EXPECT_FALSE(constant.has_same_mapped_data(op::v0::Constant(element::u8, Shape{4}, view(0, 4))));
+        EXPECT_FALSE(constant.has_same_mapped_data(op::v0::Constant(element::i8, Shape{8}, view(0, 8))));
+        EXPECT_FALSE(constant.has_same_mapped_data(op::v0::Constant(element::u8, Shape{2, 4}, view(0, 8))));
+        // the data which isn't mapped is never the same
+        EXPECT_FALSE(constant.has_same_mapped_data(*op::v0::Constant::create(element::u8, Shape{8}, {1})));
+        EXPECT_FALSE(op::v0::Constant::create(element::u8, Shape{8}, {1})->has_same_mapped_data(constant));
+    }
+    std::filesystem::remove(file_path);
+}
+
+TEST(constant, no_data_fingerprint_of_not_mapped_data) {
+    EXPECT_FALSE(op::v0::Constant::create(element::u8, Shape{8}, {1})->get_data_fingerprint().has_value());
+    EXPECT_FALSE(op::v0::Constant(element::u8, Shape{8}).get_data_fingerprint().has_value());
+
+    auto buffer = std::make_shared<ov::AlignedBuffer>(8);
+    auto shared_buffer =
+        std::make_shared<ov::SharedBuffer<std::shared_ptr<ov::AlignedBuffer>>>(buffer->get_ptr<char>(), 8, buffer);
+    EXPECT_FALSE(op::v0::Constant(element::u8, Shape{8}, shared_buffer).get_data_fingerprint().has_value());
+}
+
 }  // namespace test
 }  // namespace ov
 
@@ -4,6 +4,8 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+
 #include "common_test_utils/ov_test_utils.hpp"
 #include "openvino/core/graph_util.hpp"
 #include "openvino/core/rtti.hpp"
@@ -16,6 +18,9 @@
 #include "openvino/pass/backward_graph_rewrite.hpp"
 #include "openvino/pass/manager.hpp"
 #include "openvino/pass/pattern/op/label.hpp"
+#include "openvino/pass/pattern/op/optional.hpp"
+#include "openvino/pass/pattern/op/or.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
 
 using namespace ::testing;
 using namespace std;
@@ -269,6 +274,254 @@ TEST(GraphRewriteTest, TypeBasedMatcherPassOrder2) {
     ASSERT_EQ(count_ops_of_type<op::v0::Tanh>(f), 1);
 }
 
+class OrBasedTestPass : public ov::pass::MatcherPass {
+public:
+    OPENVINO_MATCHER_PASS_RTTI("OrBasedTestPass");
+    OrBasedTestPass() : MatcherPass() {
+        auto tanh = ov::pass::pattern::wrap_type<ov::op::v0::Tanh>();
+        auto divide = ov::pass::pattern::wrap_type<ov::op::v1::Divide>();
+        auto root = std::make_shared<ov::pass::pattern::op::Or>(OutputVector{tanh, divide});
+        ov::graph_rewrite_callback callback = [this](pattern::Matcher& m) {
+            if (transformation_callback(m.get_match_root())) {
+                auto relu = std::make_shared<ov::op::v0::Relu>(m.get_match_root()->input_value(0));
+                ov::replace_node(m.get_match_root(), relu);
+                return true;
+            }
+            return false;
+        };
+
+        auto m = std::make_shared<ov::pass::pattern::Matcher>(root, "TestMatcher");
+        this->register_matcher(m, callback);
+    }
+};
+
+TEST(GraphRewriteTest, OrBasedMatcherPassCallback) {
+    auto f = get_model();
+
+    Anchor anchor;
+    anchor.add_matcher<OrBasedTestPass>()->set_callback(get_callback());
+    anchor.run_on_model(f);
+
+    ASSERT_EQ(count_ops_of_type<op::v0::Relu>(f), 1);
+}
+
+TEST(GraphRewriteTest, OrBasedMatcherPassCallbackDerived) {
+    auto f = get_derived_model();
+
+    Anchor anchor;
+    anchor.add_matcher<OrBasedTestPass>()->set_callback(get_callback());
+    anchor.run_on_model(f);
+
+    ASSERT_EQ(count_ops_of_type<op::v0::Relu>(f), 1);
+}
+
+TEST(GraphRewriteTest, TypeBasedAndGenericMatcherPasses) {
+    auto f = get_model();
+    const auto ordered_ops = f->get_ordered_ops();
+
+    // the generic matcher runs before the typed one for each node
+    NodeVector order;
+    Anchor anchor;
+    anchor.add_matcher<GatherNodesPass>(order);
+    anchor.add_matcher<TestPass>()->set_callback(get_callback());
+    anchor.run_on_model(f);
+
+    ASSERT_EQ(count_ops_of_type<op::v0::Relu>(f), 1);
+    ASSERT_EQ(order, ordered_ops);
+}
+
+TEST(GraphRewriteTest, TypeBasedAndGenericMatcherPassesOrder) {
+    auto f = get_model();
+    const auto ordered_ops = f->get_ordered_ops();
+
+    // the typed matcher replaces the divide, so the generic one doesn't see it
+    NodeVector order;
+    Anchor anchor;
+    anchor.add_matcher<OrBasedTestPass>()->set_callback(get_callback());
+    anchor.add_matcher<GatherNodesPass>(order);
+    anchor.run_on_model(f);
+
+    ASSERT_EQ(count_ops_of_type<op::v0::Relu>(f), 1);
+    ASSERT_EQ(order.size(), ordered_ops.size() - 1);
+    ASSERT_EQ(std::count_if(order.begin(),
+                            order.end(),
+                            [](const std::shared_ptr<Node>& node) {
+                                return ov::is_type<ov::op::v1::Divide>(node);
+                            }),
+              0);
+}
+
+// Counts the matches of the given root, the predicates of the root record the nodes the matcher is applied to
+class PredicateRootTestPass : public ov::pass::MatcherPass {
+public:
+    OPENVINO_MATCHER_PASS_RTTI("PredicateRootTestPass");
+    PredicateRootTestPass(const std::shared_ptr<Node>& root, size_t& matched) : MatcherPass() {
+        ov::matcher_pass_callback callback = [&matched](pattern::Matcher& m) {
+            matched++;
+            return false;
+        };
+
+        auto m = std::make_shared<ov::pass::pattern::Matcher>(root, "PredicateRootTestPass");
+        this->register_matcher(m, callback);
+    }
+};
+
+inline pattern::op::Predicate recording_predicate(NodeVector& checked) {
+    return pattern::op::Predicate(
+        [&checked](const Output<Node>& output) {
+            checked.push_back(output.get_node_shared_ptr());
+            return true;
+        },
+        "recording");
+}
+
+inline bool only_divides(const NodeVector& nodes) {
+    return !nodes.empty() && std::all_of(nodes.begin(), nodes.end(), [](const std::shared_ptr<Node>& node) {
+        return ov::is_type<ov::op::v1::Divide>(node);
+    });
+}
+
+inline bool covers_all_ops(const NodeVector& nodes, const std::shared_ptr<Model>& model) {
+    const auto ops = model->get_ordered_ops();
+    return std::all_of(ops.begin(), ops.end(), [&nodes](const std::shared_ptr<Node>& op) {
+        return std::find(nodes.begin(), nodes.end(), op) != nodes.end();
+    });
+}
+
+TEST(GraphRewriteTest, PredicateTypeHints) {
+    const auto any_node = pattern::op::Predicate(
+        [](const Output<Node>&) {
+            return true;
+        },
+        "any_node");
+    const auto divide = pattern::has_class<op::v1::Divide>();
+    const auto tanh = pattern::has_class<op::v0::Tanh>();
+
+    ASSERT_EQ(divide.get_type_hints(), std::vector<DiscreteTypeInfo>{op::v1::Divide::get_type_info_static()});
+    ASSERT_TRUE(any_node.get_type_hints().empty());
+
+    // a node satisfying the union has either of the types
+    ASSERT_EQ((divide || tanh).get_type_hints(),
+              (std::vector<DiscreteTypeInfo>{op::v1::Divide::get_type_info_static(),
+                                             op::v0::Tanh::get_type_info_static()}));
+    ASSERT_TRUE((divide || any_node).get_type_hints().empty());
+    ASSERT_TRUE((any_node || divide).get_type_hints().empty());
+
+    // a node satisfying the intersection has the type of either side
+    ASSERT_EQ((divide && any_node).get_type_hints(),
+              std::vector<DiscreteTypeInfo>{op::v1::Divide::get_type_info_static()});
+    ASSERT_EQ((any_node && divide).get_type_hints(),
+              std::vector<DiscreteTypeInfo>{op::v1::Divide::get_type_info_static()});
+    ASSERT_TRUE((any_node && any_node).get_type_hints().empty());
+}
+
+TEST(GraphRewriteTest, HasClassRootedAnyInputIsTypeBased) {
+    auto f = get_model();
+
+    NodeVector checked;
+    size_t matched = 0;
+    Anchor anchor;
+    anchor.add_matcher<PredicateRootTestPass>(
+        pattern::any_input(recording_predicate(checked) && pattern::has_class<op::v1::Divide>()),
+        matched);
+    anchor.run_on_model(f);
+
+    ASSERT_EQ(matched, 1);
+    ASSERT_TRUE(only_divides(checked));
+}
+
+TEST(GraphRewriteTest, OrOfHintedPredicatesIsTypeBased) {
+    auto f = get_model();
+
+    NodeVector checked;
+    size_t matched = 0;
+    Anchor anchor;
+    anchor.add_matcher<PredicateRootTestPass>(
+        pattern::any_input(recording_predicate(checked) &&
+                           (pattern::has_class<op::v1::Divide>() || pattern::has_class<op::v0::Tanh>())),
+        matched);
+    anchor.run_on_model(f);
+
+    ASSERT_EQ(matched, 1);
+    ASSERT_TRUE(only_divides(checked));
+}
+
+TEST(GraphRewriteTest, OrWithNotHintedPredicateIsGeneric) {
+    auto f = get_model();
+
+    NodeVector checked;
+    size_t matched = 0;
+    const auto divide_input = pattern::op::Predicate(
+        [](const Output<Node>& output) {
+            const auto& inputs = output.get_target_inputs();
+            return std::any_of(inputs.begin(), inputs.end(), [](const Input<Node>& input) {
+                return ov::is_type<op::v1::Divide>(input.get_node());
+            });
+        },
+        "divide_input");
+    Anchor anchor;
+    anchor.add_matcher<PredicateRootTestPass>(
+        pattern::any_input(recording_predicate(checked) && (pattern::has_class<op::v1::Divide>() || divide_input)),
+        matched);
+    anchor.run_on_model(f);
+
+    // the divide and both of its inputs
+    ASSERT_EQ(matched, 3);
+    ASSERT_TRUE(covers_all_ops(checked, f));
+}
+
+TEST(GraphRewriteTest, AndWithHintedPredicateIsTypeBased) {
+    auto f = get_model();
+
+    NodeVector checked;
+    size_t matched = 0;
+    const auto constant_input = pattern::op::Predicate(
+        [](const Output<Node>& output) {
+            const auto node = output.get_node();
+            return node->get_input_size() == 2 && ov::is_type<op::v0::Constant>(node->get_input_node_ptr(1));
+        },
+        "constant_input");
+    Anchor anchor;
+    anchor.add_matcher<PredicateRootTestPass>(
+        pattern::any_input(recording_predicate(checked) && (constant_input && pattern::has_class<op::v1::Divide>())),
+        matched);
+    anchor.run_on_model(f);
+
+    ASSERT_EQ(matched, 1);
+    ASSERT_TRUE(only_divides(checked));
+}
+
+TEST(GraphRewriteTest, OptionalRootIsTypeBased) {
+    auto f = get_model();
+
+    NodeVector checked;
+    size_t matched = 0;
+    Anchor anchor;
+    anchor.add_matcher<PredicateRootTestPass>(
+        pattern::optional<op::v0::Tanh>(
+            pattern::any_input(recording_predicate(checked) && pattern::has_class<op::v1::Divide>())),
+        matched);
+    anchor.run_on_model(f);
+
+    ASSERT_EQ(matched, 1);
+    ASSERT_TRUE(only_divides(checked));
+}
+
+TEST(GraphRewriteTest, OptionalRootOfGenericInputIsGeneric) {
+    auto f = get_model();
+
+    NodeVector checked;
+    size_t matched = 0;
+    Anchor anchor;
+    anchor.add_matcher<PredicateRootTestPass>(
+        pattern::optional<op::v0::Tanh>(pattern::any_input(recording_predicate(checked))),
+        matched);
+    anchor.run_on_model(f);
+
+    ASSERT_EQ(matched, f->get_ordered_ops().size());
+    ASSERT_TRUE(covers_all_ops(checked, f));
+}
+
 TEST(PassConfigTest, Test1) {
     {
         auto f = get_model();
@@ -6,7 +6,11 @@
 
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <iostream>
 #include <memory>
+#include <set>
+#include <unordered_map>
 
 #include "common_test_utils/graph_comparator.hpp"
 #include "common_test_utils/test_common.hpp"
@@ -1832,6 +1836,151 @@ TEST(model, topological_sort_caching_shared_nodes) {
     ASSERT_FALSE(f2_shared_info->get_use_topological_cache());
 }
 
+namespace {
+// the order has the same nodes as the full sort and each node goes after its inputs
+void check_ordered_ops(const std::shared_ptr<ov::Model>& f) {
+    const auto ordered_ops = f->get_ordered_ops();
+    ov::NodeVector roots(f->get_results().begin(), f->get_results().end());
+    roots.insert(roots.end(), f->get_sinks().begin(), f->get_sinks().end());
+    roots.insert(roots.end(), f->get_parameters().begin(), f->get_parameters().end());
+    const auto ref_ops = ov::topological_sort(roots);
+    ASSERT_EQ(std::set<std::shared_ptr<ov::Node>>(ordered_ops.begin(), ordered_ops.end()),
+              std::set<std::shared_ptr<ov::Node>>(ref_ops.begin(), ref_ops.end()));
+    ASSERT_EQ(ordered_ops.size(), ref_ops.size());
+
+    std::unordered_map<ov::Node*, size_t> positions;
+    for (size_t i = 0; i < ordered_ops.size(); ++i) {
+        positions[ordered_ops[i].get()] = i;
+    }
+    for (const auto& op : ordered_ops) {
+        for (const auto& input : op->input_values()) {
+            ASSERT_LT(positions.at(input.get_node()), positions.at(op.get())) << op;
+        }
+    }
+}
+}  // namespace
+
+TEST(model, topological_sort_caching_update_insert_node) {
+    auto arg0 = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{1});
+    auto relu1 = std::make_shared<ov::op::v0::Relu>(arg0);
+    auto relu2 = std::make_shared<ov::op::v0::Relu>(relu1);
+    auto result = std::make_shared<ov::op::v0::Result>(relu2);
+    auto f = std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{arg0});
+
+    auto shared_info = ov::ModelAccessor(f).get_shared_info();
+    ASSERT_TRUE(shared_info->get_use_topological_cache());
+
+    auto abs = std::make_shared<ov::op::v0::Abs>(relu1);
+    auto abs2 = std::make_shared<ov::op::v0::Abs>(abs);
+    relu2->input(0).replace_source_output(abs2);
+
+    // the cached order is updated around the changed nodes
+    ASSERT_FALSE(shared_info->get_use_topological_cache());
+    ASSERT_TRUE(shared_info->can_update_topological_cache());
+    const auto ordered_ops = f->get_ordered_ops();
+    ASSERT_EQ(ordered_ops, (ov::NodeVector{arg0, relu1, abs, abs2, relu2, result}));
+    ASSERT_TRUE(shared_info->get_use_topological_cache());
+    ASSERT_TRUE(all_ops_have_same_info(f));
+}
+
+TEST(model, topological_sort_caching_update_reorder) {
+    auto arg0 = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{1});
+    auto relu = std::make_shared<ov::op::v0::Relu>(arg0);
+    auto relu_consumer = std::make_shared<ov::op::v0::Relu>(relu);
+    auto abs = std::make_shared<ov::op::v0::Abs>(arg0);
+    auto add = std::make_shared<ov::op::v1::Add>(relu_consumer, abs);
+    auto result = std::make_shared<ov::op::v0::Result>(add);
+    auto f = std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{arg0});
+    ASSERT_EQ(f->get_ordered_ops(), (ov::NodeVector{arg0, relu, relu_consumer, abs, add, result}));
+
+    // abs goes before relu now
+    relu->input(0).replace_source_output(abs);
+
+    auto shared_info = ov::ModelAccessor(f).get_shared_info();
+    ASSERT_TRUE(shared_info->can_update_topological_cache());
+    check_ordered_ops(f);
+    ASSERT_TRUE(shared_info->get_use_topological_cache());
+}
+
+TEST(model, topological_sort_caching_update_remove_nodes) {
+    auto arg0 = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{1});
+    auto relu1 = std::make_shared<ov::op::v0::Relu>(arg0);
+    auto relu2 = std::make_shared<ov::op::v0::Relu>(relu1);
+    auto abs = std::make_shared<ov::op::v0::Abs>(relu2);
+    auto result = std::make_shared<ov::op::v0::Result>(abs);
+    auto f = std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{arg0});
+
+    // relu1 and relu2 are alive, but they are not in the model anymore
+    abs->input(0).replace_source_output(arg0);
+    auto shared_info = ov::ModelAccessor(f).get_shared_info();
+    ASSERT_TRUE(shared_info->can_update_topological_cache());
+    ASSERT_EQ(f->get_ordered_ops(), (ov::NodeVector{arg0, abs, result}));
+
+    // the dropped nodes come back
+    abs->input(0).replace_source_output(relu2);
+    ASSERT_EQ(f->get_ordered_ops(), (ov::NodeVector{arg0, relu1, relu2, abs, result}));
+}
+
+TEST(model, topological_sort_caching_update_loop_throws) {
+    auto arg0 = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{1});
+    auto relu1 = std::make_shared<ov::op::v0::Relu>(arg0);
+    auto relu2 = std::make_shared<ov::op::v0::Relu>(relu1);
+    auto result = std::make_shared<ov::op::v0::Result>(relu2);
+    auto f = std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{arg0});
+
+    // Loop relu1->relu2->relu1
+    relu1->input(0).replace_source_output(relu2);
+    ASSERT_THROW(f->get_ordered_ops(), ov::Exception);
+    relu1->input(0).replace_source_output(arg0);
+}
+
+// a benchmark of the incremental order update against the full sort, not run by default since it measures time
+TEST(model, DISABLED_topological_sort_caching_update_performance) {
+    using namespace std::chrono;
+    // the ladder of the blocks with the residual connections, every pass inserts a few nodes into the blocks
+    auto run = [](size_t blocks, size_t passes, bool full_sort) {
+        auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{1, 16});
+        std::vector<std::shared_ptr<ov::Node>> block_outputs;
+        ov::Output<ov::Node> output = param;
+        for (size_t i = 0; i < blocks; ++i) {
+            auto relu = std::make_shared<ov::op::v0::Relu>(output);
+            auto abs = std::make_shared<ov::op::v0::Abs>(relu);
+            auto add = std::make_shared<ov::op::v1::Add>(abs, output);
+            block_outputs.push_back(relu);
+            output = add;
+        }
+        auto result = std::make_shared<ov::op::v0::Result>(output);
+        auto model = std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{param});
+        if (full_sort) {
+            model->set_topological_sort(ov::topological_sort<std::vector<std::shared_ptr<ov::Node>>>);
+        }
+
+        const auto start = steady_clock::now();
+        for (size_t pass = 0; pass < passes; ++pass) {
+            for (size_t i = pass; i < block_outputs.size(); i += block_outputs.size() / 4) {
+                const auto& relu = block_outputs[i];
+                const auto consumers = relu->output(0).get_target_inputs();
+                auto new_relu = std::make_shared<ov::op::v0::Relu>(relu);
+                for (auto consumer : consumers) {
+                    consumer.replace_source_output(new_relu);
+                }
+                block_outputs[i] = new_relu;
+            }
+            std::ignore = model->get_ordered_ops();
+        }
+        const auto time = duration_cast<microseconds>(steady_clock::now() - start).count();
+        check_ordered_ops(model);
+        return time;
+    };
+    constexpr size_t blocks = 30000;
+    constexpr size_t passes = 50;
+    const auto full_sort_time = run(blocks, passes, true);
+    const auto update_time = run(blocks, passes, false);
+    std::cout << "get_ordered_ops over " << blocks * 3 << " nodes after " << passes
+              << " localized changes: full sort " << full_sort_time << " us, incremental update " << update_time
+              << " us" << std::endl;
+}
+
 namespace bs_utils {
 static std::shared_ptr<ov::Model> create_n_inputs(ov::element::Type type,
                                                   const std::vector<ov::PartialShape>& shapes,
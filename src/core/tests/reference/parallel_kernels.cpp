@@ -0,0 +1,117 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+#include "openvino/reference/convert.hpp"
+#include "openvino/reference/gather.hpp"
+#include "openvino/reference/multiply.hpp"
+#include "openvino/reference/reduce_max.hpp"
+#include "openvino/reference/reduce_sum.hpp"
+#include "openvino/reference/utils/parallel.hpp"
+
+namespace parallel_kernels_test {
+using ov::reference::parallel::BackendScope;
+
+std::atomic<size_t> num_parallel_runs{0};
+
+void run_on_threads(size_t work_amount, size_t grain, const std::function<void(size_t, size_t)>& body) {
+    constexpr size_t num_threads = 4;
+    const auto num_blocks = (work_amount + grain - 1) / grain;
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < num_threads; ++i) {
+        const auto begin = num_blocks * i / num_threads * grain;
+        const auto end = std::min(num_blocks * (i + 1) / num_threads * grain, work_amount);
+        if (begin < end) {
+            threads.emplace_back(body, begin, end);
+        }
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    num_parallel_runs++;
+}
+
+template <class T>
+std::vector<T> make_data(size_t size) {
+    std::vector<T> data(size);
+    for (size_t i = 0; i < size; ++i) {
+        data[i] = static_cast<T>(i % 251) - T{100};
+    }
+    return data;
+}
+
+// runs the kernel sequentially and with the backend, the results must be the same
+template <class T, class Kernel>
+void check_parallel(size_t out_size, Kernel&& kernel) {
+    std::vector<T> expected(out_size), actual(out_size);
+    kernel(expected.data());
+
+    const auto runs = num_parallel_runs.load();
+    {
+        BackendScope scope(run_on_threads);
+        kernel(actual.data());
+    }
+    EXPECT_GT(num_parallel_runs.load(), runs);
+    EXPECT_EQ(expected, actual);
+}
+
+TEST(ParallelReferenceKernels, Multiply) {
+    const ov::Shape shape{2, 300, 256};
+    const auto arg0 = make_data<float>(ov::shape_size(shape));
+    const auto arg1 = make_data<float>(ov::shape_size(shape));
+    check_parallel<float>(ov::shape_size(shape), [&](float* out) {
+        ov::reference::multiply(arg0.data(), arg1.data(), out, shape, shape, ov::op::AutoBroadcastType::NONE);
+    });
+
+    // per-channel scales of the weights
+    const ov::Shape scales_shape{300, 1};
+    const auto scales = make_data<float>(ov::shape_size(scales_shape));
+    check_parallel<float>(ov::shape_size(shape), [&](float* out) {
+        ov::reference::multiply(arg0.data(), scales.data(), out, shape, scales_shape, ov::op::AutoBroadcastType::NUMPY);
+    });
+}
+
+TEST(ParallelReferenceKernels, Convert) {
+    constexpr size_t count = 100003;
+    const auto arg = make_data<float>(count);
+    check_parallel<ov::float16>(count, [&](ov::float16* out) {
+        ov::reference::convert(arg.data(), out, count);
+    });
+    const auto int_arg = make_data<int32_t>(count);
+    check_parallel<float>(count, [&](float* out) {
+        ov::reference::convert(int_arg.data(), out, count);
+    });
+}
+
+TEST(ParallelReferenceKernels, Gather) {
+    const ov::Shape data_shape{4, 256, 128, 16};
+    const ov::Shape indices_shape{4, 6};
+    const ov::Shape out_shape{4, 256, 6, 16};
+    const auto data = make_data<float>(ov::shape_size(data_shape));
+    // including negative and out of bound indices
+    std::vector<int64_t> indices(ov::shape_size(indices_shape));
+    std::iota(indices.begin(), indices.end(), -12);
+    indices[5] = 128;
+    check_parallel<float>(ov::shape_size(out_shape), [&](float* out) {
+        ov::reference::gather(data.data(), indices.data(), out, data_shape, indices_shape, out_shape, 2, 1);
+    });
+}
+
+TEST(ParallelReferenceKernels, Reduce) {
+    const ov::Shape shape{1, 128, 1024};
+    const auto arg = make_data<float>(ov::shape_size(shape));
+    check_parallel<float>(128, [&](float* out) {
+        ov::reference::reduce_sum(arg.data(), out, shape, ov::AxisSet{2});
+    });
+    check_parallel<float>(128, [&](float* out) {
+        ov::reference::reduce_max(arg.data(), out, shape, ov::AxisSet{0, 2});
+    });
+}
+}  // namespace parallel_kernels_test
@@ -65,6 +65,17 @@ public:
 
     void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<std::string>>& adapter) override;
 
+    /// \brief Parses the next layer of the net into the document, returns false when there are no more layers.
+    using LayerReader = std::function<bool(pugi::xml_document& layer)>;
+
+    /// \brief Creates the model of the net which layers are read one by one, so the xml of the whole net is never kept
+    /// in memory. A layer is created as soon as the layers of its inputs are created, only the layers which come before
+    /// their inputs are kept until the inputs are read.
+    /// \param root the net element, its layers section is ignored
+    /// \param next_layer reads the layers of the net
+    /// \return the model of the net
+    std::shared_ptr<ov::Model> parse_function(const pugi::xml_node& root, const LayerReader& next_layer);
+
 protected:
     virtual ov::Any parse_weightless_cache_attribute(const pugi::xml_node& node) const;
     virtual void set_constant_num_buffer(ov::AttributeAdapter<std::shared_ptr<ov::AlignedBuffer>>& adapter);
@@ -80,6 +91,7 @@ private:
         NodeIdToIoIndex inputs;
         NodeIdToIoIndex outputs;
     };
+    struct FunctionNodes;
 
     /// \brief Traverses port_map in order to create vector of InputDescription shared_ptrs.
     /// Shall be used only for ops which have port_map attribute.
@@ -108,6 +120,14 @@ private:
     /// with value of purpuse attribute
     ov::op::v5::Loop::SpecialBodyPorts parse_purpose_attribute(const pugi::xml_node& node);
 
+    /// \brief Registers the created node of the layer as a parameter, result or sink of the function.
+    void add_function_node(FunctionNodes& func_nodes,
+                           size_t layer_id,
+                           const std::shared_ptr<ov::Node>& node,
+                           const pugi::xml_node& xml);
+    /// \brief Creates the function of the nodes and reads its meta data from the root.
+    std::shared_ptr<ov::Model> make_function(const pugi::xml_node& root, const FunctionNodes& func_nodes);
+
     GenericLayerParams parse_generic_params(const pugi::xml_node& node);
 
     std::shared_ptr<ov::Node> create_node(const ov::OutputVector& inputs,
@@ -4,6 +4,7 @@
 
 #include "openvino/xml_util/xml_deserialize_util.hpp"
 
+#include <algorithm>
 #include <regex>
 #include <stack>
 #include <string_view>
@@ -930,20 +931,57 @@ void XmlDeserializer::set_constant_num_buffer(ov::AttributeAdapter<std::shared_p
     }
 }
 
+namespace {
+struct Edge {
+    size_t fromLayerId, fromPortId, toPortId;
+};
+
+using Edges = std::map<size_t /*to-layer-id*/, std::vector<Edge>>;
+
+Edges read_edges(const pugi::xml_node& root) {
+    Edges edges;
+    FOREACH_CHILD (_ec, root.child("edges"), "edge") {
+        size_t fromLayer = static_cast<size_t>(pugixml::get_uint64_attr(_ec, "from-layer"));
+        size_t fromPort = static_cast<size_t>(pugixml::get_uint64_attr(_ec, "from-port"));
+        size_t toLayer = static_cast<size_t>(pugixml::get_uint64_attr(_ec, "to-layer"));
+        size_t toPort = static_cast<size_t>(pugixml::get_uint64_attr(_ec, "to-port"));
+        edges[toLayer].push_back({fromLayer, fromPort, toPort});
+    }
+    return edges;
+}
+
+ov::OutputVector get_inputs(const GenericLayerParams& layer,
+                            const std::vector<Edge>& layer_edges,
+                            const std::map<size_t, std::shared_ptr<ov::Node>>& id_to_node,
+                            const std::function<const GenericLayerParams&(size_t)>& get_params) {
+    ov::OutputVector inputs(layer_edges.size());
+    for (auto& e : layer_edges) {
+        const auto input_node = id_to_node.find(e.fromLayerId);
+        if (input_node == id_to_node.end() || !input_node->second) {
+            OPENVINO_THROW("Attempt to access node ", e.fromLayerId, " that not in graph.");
+        }
+        const auto& p_output = get_params(e.fromLayerId);
+        const size_t realInputPortId = layer.get_real_input_port_id(e.toPortId);
+        if (realInputPortId >= inputs.size())
+            OPENVINO_THROW(layer.type, " layer ", layer.name, " with id: ", layer.layerId, " is inconsistent!");
+        inputs[realInputPortId] = input_node->second->output(p_output.get_real_output_port_id(e.fromPortId));
+    }
+    return inputs;
+}
+}  // namespace
+
+struct XmlDeserializer::FunctionNodes {
+    ov::ParameterVector parameters;
+    ov::ResultVector results;
+    ov::NodeVector all;
+    ov::SinkVector sinks;
+    std::map<std::string, std::shared_ptr<ov::Node>> variable_id_to_read_value;
+};
+
 std::shared_ptr<ov::Model> XmlDeserializer::parse_function(const pugi::xml_node& root,
                                                            const std::shared_ptr<ov::AlignedBuffer>& weights) {
     // OV_ITT_SCOPE_CHAIN(FIRST_INFERENCE, taskChain, itt::domains::V10Reader_RT, "V10Parser", "Parse");
 
-    struct FunctionNodes {
-        ov::ParameterVector parameters;
-        ov::OutputVector results;
-        ov::NodeVector all;
-        ov::SinkVector sinks;
-    };
-
-    struct Edge {
-        size_t fromLayerId, fromPortId, toPortId;
-    };
     struct NodeParams {
         pugi::xml_node xml;
         GenericLayerParams params;
@@ -955,7 +993,8 @@ std::shared_ptr<ov::Model> XmlDeserializer::parse_function(const pugi::xml_node&
 
     std::vector<size_t> order;
     std::set<size_t> dfs_used_nodes;
-    std::map<size_t /*to-layer-id*/, std::vector<Edge>> edges;
+    // Read all edges and store them for further usage
+    Edges edges = read_edges(root);
     // Read all layers and store their parameters in params map
     FOREACH_CHILD (node, root.child("layers"), "layer") {
         auto node_param = parse_generic_params(node);
@@ -972,15 +1011,6 @@ std::shared_ptr<ov::Model> XmlDeserializer::parse_function(const pugi::xml_node&
         }
     }
 
-    // Read all edges and store them for further usage
-    FOREACH_CHILD (_ec, root.child("edges"), "edge") {
-        size_t fromLayer = static_cast<size_t>(pugixml::get_uint64_attr(_ec, "from-layer"));
-        size_t fromPort = static_cast<size_t>(pugixml::get_uint64_attr(_ec, "from-port"));
-        size_t toLayer = static_cast<size_t>(pugixml::get_uint64_attr(_ec, "to-layer"));
-        size_t toPort = static_cast<size_t>(pugixml::get_uint64_attr(_ec, "to-port"));
-        edges[toLayer].push_back({fromLayer, fromPort, toPort});
-    }
-
     // Run DFS starting from outputs to get nodes topological order
     const std::function<void(size_t)> dfs = [&edges, &order, &dfs_used_nodes](const size_t start_id) {
         std::stack<size_t> stack;
@@ -1011,7 +1041,9 @@ std::shared_ptr<ov::Model> XmlDeserializer::parse_function(const pugi::xml_node&
 
     FunctionNodes func_nodes;
     std::map<size_t, std::shared_ptr<ov::Node>> id_to_node;
-    std::map<std::string, std::shared_ptr<ov::Node>> variable_id_to_read_value;
+    const auto get_params = [&params](size_t layer_id) -> const GenericLayerParams& {
+        return params[layer_id].params;
+    };
 
     //  Following topological order create OpenVINO operations
     for (auto& layer_id : order) {
@@ -1019,66 +1051,153 @@ std::shared_ptr<ov::Model> XmlDeserializer::parse_function(const pugi::xml_node&
         const auto& edgeIt = edges.find(layer_id);
         if (edgeIt == edges.end())
             continue;
-        ov::OutputVector inputs(edgeIt->second.size());
-        for (auto& e : edgeIt->second) {
-            auto input_node = id_to_node[e.fromLayerId];
-            if (!input_node) {
-                OPENVINO_THROW("Attempt to access node ", e.fromLayerId, " that not in graph.");
-            }
-            auto& p_output = params[e.fromLayerId].params;
-            const size_t realInputPortId = p.params.get_real_input_port_id(e.toPortId);
-            if (realInputPortId >= inputs.size())
-                OPENVINO_THROW(p.params.type,
-                               " layer ",
-                               p.params.name,
-                               " with id: ",
-                               p.params.layerId,
-                               " is inconsistent!");
-            inputs[realInputPortId] = input_node->output(p_output.get_real_output_port_id(e.fromPortId));
-        }
+        const auto inputs = get_inputs(p.params, edgeIt->second, id_to_node, get_params);
 
         auto node = create_node(inputs, p.xml, weights, p.params);
         id_to_node[layer_id] = node;
+        add_function_node(func_nodes, layer_id, node, p.xml);
+    }
 
-        if (const auto& parameter_node = ov::as_type_ptr<ov::op::v0::Parameter>(node)) {
-            OPENVINO_ASSERT(!p.xml.child("data").empty(), "Layer data must be defined for: ", parameter_node);
-            io_map.inputs.insert({layer_id, func_nodes.parameters.size()});
-            func_nodes.parameters.emplace_back(parameter_node);
-        }
+    return make_function(root, func_nodes);
+}
 
-        if (const auto& result_node = ov::as_type_ptr<ov::op::v0::Result>(node)) {
-            io_map.outputs.insert({layer_id, func_nodes.results.size()});
-            func_nodes.results.emplace_back(result_node);
+std::shared_ptr<ov::Model> XmlDeserializer::parse_function(const pugi::xml_node& root, const LayerReader& next_layer) {
+    io_map = {};
+    const Edges edges = read_edges(root);
+    std::map<size_t /*from-layer-id*/, std::vector<size_t /*to-layer-id*/>> consumers;
+    for (const auto& layer_edges : edges) {
+        for (const auto& edge : layer_edges.second) {
+            consumers[edge.fromLayerId].push_back(layer_edges.first);
         }
+    }
 
-        if (const auto& sink = ov::as_type_ptr<ov::op::Sink>(node)) {
-            auto subgraph_op = ov::as_type_ptr<ov::op::util::MultiSubGraphOp>(node);
-            if (subgraph_op) {
-                for (const auto& body_model : subgraph_op->get_functions()) {
-                    if (body_model->get_sinks().size()) {
-                        func_nodes.sinks.emplace_back(sink);
-                        break;
-                    }
+    // The port ids of all the layers are kept to connect their consumers, the xml of a layer is kept only while it
+    // waits for its inputs
+    std::map<size_t /*layer-id*/, GenericLayerParams> params;
+    std::map<size_t /*layer-id*/, std::shared_ptr<pugi::xml_document>> waiting;
+    std::map<size_t /*layer-id*/, size_t /*xml position*/> result_positions;
+    std::map<size_t, std::shared_ptr<ov::Node>> id_to_node;
+    FunctionNodes func_nodes;
+    const auto get_params = [&params](size_t layer_id) -> const GenericLayerParams& {
+        return params.at(layer_id);
+    };
+    const auto is_ready = [&edges, &id_to_node](size_t layer_id) {
+        const auto edgeIt = edges.find(layer_id);
+        return edgeIt == edges.end() || std::all_of(edgeIt->second.begin(), edgeIt->second.end(), [&](const Edge& e) {
+                   return id_to_node.count(e.fromLayerId) != 0;
+               });
+    };
+    const auto create = [&](size_t layer_id, const pugi::xml_node& xml) {
+        const auto& p = params.at(layer_id);
+        const auto edgeIt = edges.find(layer_id);
+        const auto inputs =
+            edgeIt == edges.end() ? ov::OutputVector{} : get_inputs(p, edgeIt->second, id_to_node, get_params);
+        auto node = create_node(inputs, xml, m_weights, p);
+        id_to_node[layer_id] = node;
+        add_function_node(func_nodes, layer_id, node, xml);
+    };
+
+    for (size_t position = 0;; position++) {
+        auto layer = std::make_shared<pugi::xml_document>();
+        if (!next_layer(*layer)) {
+            break;
+        }
+        const auto xml = layer->document_element();
+        const auto layer_params = parse_generic_params(xml);
+        const auto layer_id = layer_params.layerId;
+        params[layer_id] = layer_params;
+        if (layer_params.type == "Result") {
+            result_positions[layer_id] = position;
+        }
+        if (!is_ready(layer_id)) {
+            waiting.emplace(layer_id, std::move(layer));
+            continue;
+        }
+        create(layer_id, xml);
+
+        // Create the waiting layers which inputs are created now
+        std::vector<size_t> created{layer_id};
+        while (!created.empty() && !waiting.empty()) {
+            const auto producer = created.back();
+            created.pop_back();
+            const auto consumersIt = consumers.find(producer);
+            if (consumersIt == consumers.end()) {
+                continue;
+            }
+            for (const auto consumer : consumersIt->second) {
+                const auto waitingIt = waiting.find(consumer);
+                if (waitingIt == waiting.end() || !is_ready(consumer)) {
+                    continue;
                 }
-            } else {
-                func_nodes.sinks.emplace_back(sink);
+                create(consumer, waitingIt->second->document_element());
+                waiting.erase(waitingIt);
+                created.push_back(consumer);
             }
         }
+    }
+    if (!waiting.empty()) {
+        const auto& p = params.at(waiting.begin()->first);
+        OPENVINO_THROW(p.type, " layer ", p.name, " with id: ", p.layerId, " has inputs that not in graph.");
+    }
+
+    // The results are ordered as in the xml, the same as if the layers were read at once
+    std::map<size_t /*xml position*/, std::shared_ptr<ov::op::v0::Result>> results;
+    for (const auto& output : io_map.outputs) {
+        results.emplace(result_positions.at(output.first), func_nodes.results[output.second]);
+    }
+    func_nodes.results.clear();
+    for (const auto& result : results) {
+        func_nodes.results.push_back(result.second);
+    }
+
+    return make_function(root, func_nodes);
+}
+
+void XmlDeserializer::add_function_node(FunctionNodes& func_nodes,
+                                        size_t layer_id,
+                                        const std::shared_ptr<ov::Node>& node,
+                                        const pugi::xml_node& xml) {
+    if (const auto& parameter_node = ov::as_type_ptr<ov::op::v0::Parameter>(node)) {
+        OPENVINO_ASSERT(!xml.child("data").empty(), "Layer data must be defined for: ", parameter_node);
+        io_map.inputs.insert({layer_id, func_nodes.parameters.size()});
+        func_nodes.parameters.emplace_back(parameter_node);
+    }
 
-        if (const auto& read_value = ov::as_type_ptr<ov::op::util::ReadValueBase>(node)) {
-            variable_id_to_read_value[read_value->get_variable_id()] = read_value;
+    if (const auto& result_node = ov::as_type_ptr<ov::op::v0::Result>(node)) {
+        io_map.outputs.insert({layer_id, func_nodes.results.size()});
+        func_nodes.results.emplace_back(result_node);
+    }
+
+    if (const auto& sink = ov::as_type_ptr<ov::op::Sink>(node)) {
+        auto subgraph_op = ov::as_type_ptr<ov::op::util::MultiSubGraphOp>(node);
+        if (subgraph_op) {
+            for (const auto& body_model : subgraph_op->get_functions()) {
+                if (body_model->get_sinks().size()) {
+                    func_nodes.sinks.emplace_back(sink);
+                    break;
+                }
+            }
+        } else {
+            func_nodes.sinks.emplace_back(sink);
         }
+    }
 
-        func_nodes.all.emplace_back(node);
+    if (const auto& read_value = ov::as_type_ptr<ov::op::util::ReadValueBase>(node)) {
+        func_nodes.variable_id_to_read_value[read_value->get_variable_id()] = read_value;
     }
 
+    func_nodes.all.emplace_back(node);
+}
+
+std::shared_ptr<ov::Model> XmlDeserializer::make_function(const pugi::xml_node& root,
+                                                          const FunctionNodes& func_nodes) {
     auto function = std::make_shared<ov::Model>(func_nodes.results,
                                                 func_nodes.sinks,
                                                 func_nodes.parameters,
                                                 pugixml::get_str_attr(root, "name", ""));
     for (const auto& sink : func_nodes.sinks) {
         if (const auto& assign = ov::as_type_ptr<ov::op::util::AssignBase>(sink)) {
-            assign->add_control_dependency(variable_id_to_read_value.at(assign->get_variable_id()));
+            assign->add_control_dependency(func_nodes.variable_id_to_read_value.at(assign->get_variable_id()));
         }
     }
 
@@ -5,10 +5,12 @@
 #include "openvino/frontend/ir/frontend.hpp"
 
 #include <array>
+#include <future>
 #include <pugixml.hpp>
 #include <vector>
 
 #include "input_model.hpp"
+#include "itt.hpp"
 #include "openvino/core/any.hpp"
 #include "openvino/core/so_extension.hpp"
 #include "openvino/runtime/aligned_buffer.hpp"
@@ -91,6 +93,42 @@ size_t get_ir_version(std::istream& model) {
     return ir_version;
 }
 
+template <class Path>
+std::shared_ptr<ov::AlignedBuffer> load_file(const Path& path, bool enable_mmap, const char* kind) {
+    if (enable_mmap) {
+        auto mapped_memory = ov::load_mmap_object(ov::util::make_path(path));
+        return std::make_shared<ov::SharedBuffer<std::shared_ptr<MappedMemory>>>(mapped_memory->data(),
+                                                                                mapped_memory->size(),
+                                                                                mapped_memory);
+    }
+    std::ifstream stream;
+    stream.open(path.c_str(), std::ios::binary);
+    if (!stream.is_open())
+#if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
+        OPENVINO_THROW(kind, " file ", ov::util::wstring_to_string(path), " cannot be opened!");
+#else
+        OPENVINO_THROW(kind, " file ", path, " cannot be opened!");
+#endif
+
+    stream.seekg(0, std::ios::end);
+    size_t file_size = stream.tellg();
+    stream.seekg(0, std::ios::beg);
+
+    auto aligned_buffer = std::make_shared<ov::AlignedBuffer>(file_size);
+    stream.read(aligned_buffer->get_ptr<char>(), aligned_buffer->size());
+    stream.close();
+
+    return std::make_shared<ov::SharedBuffer<std::shared_ptr<ov::AlignedBuffer>>>(aligned_buffer->get_ptr<char>(),
+                                                                                  aligned_buffer->size(),
+                                                                                  aligned_buffer);
+}
+
+template <class Path>
+std::shared_ptr<ov::AlignedBuffer> load_weights(const Path& weights_path, bool enable_mmap) {
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::ir_frontend, "FrontEnd::load_weights");
+    return load_file(weights_path, enable_mmap, "Weights");
+}
+
 }  // namespace
 
 bool FrontEnd::supported_impl(const std::vector<ov::Any>& variants) const {
@@ -159,6 +197,7 @@ InputModel::Ptr FrontEnd::load_impl(const std::vector<ov::Any>& variants) const
     std::istream* provided_model_stream = nullptr;
     std::shared_ptr<ov::AlignedBuffer> model_buf;
     std::shared_ptr<ov::AlignedBuffer> weights;
+    std::shared_future<std::shared_ptr<ov::AlignedBuffer>> weights_future;
 
     auto create_extensions_map = [&]() -> std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr> {
         std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr> exts;
@@ -172,18 +211,14 @@ InputModel::Ptr FrontEnd::load_impl(const std::vector<ov::Any>& variants) const
     auto create_input_model = [&](std::string weights_path) -> std::shared_ptr<InputModel> {
         if (provided_model_stream) {
             return std::make_shared<InputModel>(*provided_model_stream,
-                                                weights,
+                                                weights_future,
                                                 create_extensions_map(),
                                                 std::move(weights_path));
-        } else if (local_model_stream.is_open()) {
-            auto input_model = std::make_shared<InputModel>(local_model_stream,
-                                                            weights,
-                                                            create_extensions_map(),
-                                                            std::move(weights_path));
-            local_model_stream.close();
-            return input_model;
         } else if (model_buf) {
-            return std::make_shared<InputModel>(model_buf, weights, create_extensions_map(), std::move(weights_path));
+            return std::make_shared<InputModel>(model_buf,
+                                                weights_future,
+                                                create_extensions_map(),
+                                                std::move(weights_path));
         }
         return nullptr;
     };
@@ -254,35 +289,20 @@ InputModel::Ptr FrontEnd::load_impl(const std::vector<ov::Any>& variants) const
             weights_path.clear();
         }
     }
+    // the weights are mapped or read in parallel with the xml parsing
     if (!weights_path.empty()) {
-        if (enable_mmap) {
-            auto mapped_memory = ov::load_mmap_object(ov::util::make_path(weights_path));
-            weights = std::make_shared<ov::SharedBuffer<std::shared_ptr<MappedMemory>>>(mapped_memory->data(),
-                                                                                        mapped_memory->size(),
-                                                                                        mapped_memory);
-        } else {
-            std::ifstream bin_stream;
-            bin_stream.open(weights_path.c_str(), std::ios::binary);
-            if (!bin_stream.is_open())
-#if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
-                OPENVINO_THROW("Weights file ", ov::util::wstring_to_string(weights_path), " cannot be opened!");
-#else
-                OPENVINO_THROW("Weights file ", weights_path, " cannot be opened!");
-#endif
-
-            bin_stream.seekg(0, std::ios::end);
-            size_t file_size = bin_stream.tellg();
-            bin_stream.seekg(0, std::ios::beg);
-
-            auto aligned_weights_buffer = std::make_shared<ov::AlignedBuffer>(file_size);
-            bin_stream.read(aligned_weights_buffer->get_ptr<char>(), aligned_weights_buffer->size());
-            bin_stream.close();
+        weights_future =
+            std::async(std::launch::async, load_weights<decltype(weights_path)>, weights_path, enable_mmap).share();
+    } else {
+        std::promise<std::shared_ptr<ov::AlignedBuffer>> provided_weights;
+        provided_weights.set_value(weights);
+        weights_future = provided_weights.get_future().share();
+    }
 
-            weights = std::make_shared<ov::SharedBuffer<std::shared_ptr<ov::AlignedBuffer>>>(
-                aligned_weights_buffer->get_ptr<char>(),
-                aligned_weights_buffer->size(),
-                aligned_weights_buffer);
-        }
+    // the layers are parsed one by one from the text of the model file, so the file is mapped or read at once
+    if (local_model_stream.is_open()) {
+        local_model_stream.close();
+        model_buf = load_file(model_path, enable_mmap, "Model");
     }
 
     return create_input_model(ov::util::path_to_string(weights_path));
@@ -4,6 +4,8 @@
 
 #include "input_model.hpp"
 
+#include <chrono>
+#include <functional>
 #include <pugixml.hpp>
 
 #include "openvino/core/except.hpp"
@@ -14,10 +16,14 @@
 #include "openvino/op/util/framework_node.hpp"
 #include "openvino/op/util/variable.hpp"
 #include "openvino/opsets/opset.hpp"
+#include "openvino/runtime/aligned_buffer.hpp"
+#include "openvino/runtime/string_aligned_buffer.hpp"
 #include "openvino/util/common_util.hpp"
 #include "openvino/util/xml_parse_utils.hpp"
+#include "itt.hpp"
 #include "openvino/xml_util/xml_deserialize_util.hpp"
 #include "utils.hpp"
+#include "xml_layer_reader.hpp"
 
 namespace {
 void parse_pre_process(pugi::xml_node& root,
@@ -196,48 +202,147 @@ void parse_pre_process(pugi::xml_node& root,
         }
     }
 }
+
+void report_peak_rss() {
+    static const auto peak_rss = openvino::itt::counter("Peak RSS, KB", "ov::frontend::ir");
+    openvino::itt::counterSet(peak_rss, ov::frontend::ir::get_peak_rss_kb());
+}
+
+void report_parse_time(const std::chrono::steady_clock::duration& duration) {
+    static const auto parse_time = openvino::itt::counter("XML parse time, us", "ov::frontend::ir");
+    const auto us = std::chrono::duration_cast<std::chrono::microseconds>(duration);
+    openvino::itt::counterSet(parse_time, static_cast<uint64_t>(us.count()));
+    report_peak_rss();
+}
 }  // namespace
 
 namespace ov {
 namespace frontend {
 namespace ir {
 
+namespace {
+// Waits for the weights right before the first constant reads them, so the weights are loaded in parallel with the
+// creation of the nodes coming before it
+class XmlDeserializer : public ov::util::XmlDeserializer {
+public:
+    XmlDeserializer(const pugi::xml_node& node,
+                    const std::shared_ptr<ov::AlignedBuffer>& weights,
+                    const std::unordered_map<std::string, ov::OpSet>& opsets,
+                    const std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>& extensions,
+                    std::unordered_map<std::string, std::shared_ptr<ov::op::util::Variable>>& variables,
+                    size_t version,
+                    std::function<void()> wait_weights)
+        : ov::util::XmlDeserializer(node, weights, opsets, extensions, variables, version),
+          m_wait_weights(std::move(wait_weights)) {}
+
+    using ov::util::XmlDeserializer::on_adapter;
+
+    void on_adapter(const std::string& name, ov::ValueAccessor<void>& adapter) override {
+        if (ov::is_type<ov::AttributeAdapter<std::shared_ptr<ov::AlignedBuffer>>>(&adapter) ||
+            ov::is_type<ov::AttributeAdapter<std::shared_ptr<ov::StringAlignedBuffer>>>(&adapter)) {
+            m_wait_weights();
+        }
+        ov::util::XmlDeserializer::on_adapter(name, adapter);
+    }
+
+private:
+    std::unique_ptr<ov::util::XmlDeserializer> make_visitor(
+        const pugi::xml_node& node,
+        const std::shared_ptr<ov::AlignedBuffer>& weights,
+        const std::unordered_map<std::string, ov::OpSet>& opsets,
+        const std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>& extensions,
+        std::unordered_map<std::string, std::shared_ptr<ov::op::util::Variable>>& variables,
+        size_t version) const override {
+        return std::make_unique<XmlDeserializer>(node,
+                                                 weights,
+                                                 opsets,
+                                                 extensions,
+                                                 variables,
+                                                 version,
+                                                 m_wait_weights);
+    }
+
+    std::function<void()> m_wait_weights;
+};
+}  // namespace
+
 class InputModel::InputModelIRImpl {
+    // The deserializer refers to the weights, they are set once the weights future is ready
     std::shared_ptr<ov::AlignedBuffer> m_weights;
+    std::shared_future<std::shared_ptr<ov::AlignedBuffer>> m_weights_future;
     std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr> m_extensions;
     std::unordered_map<std::string, ov::OpSet> m_opsets;
     pugi::xml_node m_root;
     pugi::xml_document m_xml_doc;
     std::string m_weights_path;
+    // The layers are parsed one by one in convert, so the text of the xml is kept until then
+    std::shared_ptr<ov::AlignedBuffer> m_xml_buffer;
+    std::unique_ptr<XmlLayerReader> m_layer_reader;
+    std::chrono::steady_clock::duration m_parse_time{};
 
 public:
     InputModelIRImpl(std::istream& model,
-                     const std::shared_ptr<ov::AlignedBuffer>& weights,
+                     const std::shared_future<std::shared_ptr<ov::AlignedBuffer>>& weights,
                      const std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>& extensions,
                      std::string weights_path)
-        : m_weights(weights),
+        : m_weights_future(weights),
           m_extensions(extensions),
           m_weights_path(std::move(weights_path)) {
-        pugi::xml_parse_result res = m_xml_doc.load(model);
-        OPENVINO_ASSERT(res.status == pugi::status_ok, res.description(), " at offset ", res.offset);
+        parse_xml(model);
         init_opset();
     }
 
     InputModelIRImpl(const std::shared_ptr<ov::AlignedBuffer>& model,
-                     const std::shared_ptr<ov::AlignedBuffer>& weights,
+                     const std::shared_future<std::shared_ptr<ov::AlignedBuffer>>& weights,
                      const std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>& extensions,
                      std::string weights_path)
-        : m_weights(weights),
+        : m_weights_future(weights),
           m_extensions(extensions),
-          m_weights_path(std::move(weights_path)) {
-        auto res = m_xml_doc.load_buffer(model->get_ptr(), model->size(), pugi::parse_default, pugi::encoding_utf8);
-        OPENVINO_ASSERT(res.status == pugi::status_ok, res.description(), " at offset ", res.offset);
+          m_weights_path(std::move(weights_path)),
+          m_xml_buffer(model) {
+        parse_xml(model->get_ptr<char>(), model->size());
         init_opset();
     }
 
     std::shared_ptr<ov::Model> convert();
 
 private:
+    // Parses the net without its layers, the whole document is parsed if its layers can't be found
+    void parse_xml(const char* xml, size_t size) {
+        OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::ir_frontend, "InputModel::parse_xml");
+        const auto start = std::chrono::steady_clock::now();
+        m_layer_reader = std::make_unique<XmlLayerReader>(xml, size);
+        if (!m_layer_reader->is_valid() || m_layer_reader->parse_net(m_xml_doc).status != pugi::status_ok) {
+            m_layer_reader.reset();
+            auto res = m_xml_doc.load_buffer(xml, size, pugi::parse_default, pugi::encoding_utf8);
+            OPENVINO_ASSERT(res.status == pugi::status_ok, res.description(), " at offset ", res.offset);
+            // the document keeps its own copy of the text
+            m_xml_buffer.reset();
+        }
+        m_parse_time = std::chrono::steady_clock::now() - start;
+        report_parse_time(m_parse_time);
+    }
+
+    // The layers are split only in the text kept in memory, so the document is parsed from the stream at once
+    void parse_xml(std::istream& xml) {
+        OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::ir_frontend, "InputModel::parse_xml");
+        const auto start = std::chrono::steady_clock::now();
+        auto res = m_xml_doc.load(xml);
+        OPENVINO_ASSERT(res.status == pugi::status_ok, res.description(), " at offset ", res.offset);
+        m_parse_time = std::chrono::steady_clock::now() - start;
+        report_parse_time(m_parse_time);
+    }
+
+    void wait_weights() {
+        if (!m_weights_future.valid()) {
+            return;
+        }
+        OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::ir_frontend, "InputModel::wait_weights");
+        // rethrows the error of the weights loading
+        m_weights = m_weights_future.get();
+        m_weights_future = {};
+    }
+
     void init_opset() {
         m_root = m_xml_doc.document_element();
         for (const auto& it : ov::get_available_opsets()) {
@@ -247,14 +352,14 @@ private:
 };
 
 InputModel::InputModel(std::istream& model,
-                       const std::shared_ptr<ov::AlignedBuffer>& weights,
+                       const std::shared_future<std::shared_ptr<ov::AlignedBuffer>>& weights,
                        const std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>& extensions,
                        std::string weights_path) {
     _impl = std::make_shared<InputModelIRImpl>(model, weights, extensions, std::move(weights_path));
 }
 
 InputModel::InputModel(const std::shared_ptr<ov::AlignedBuffer>& model,
-                       const std::shared_ptr<ov::AlignedBuffer>& weights,
+                       const std::shared_future<std::shared_ptr<ov::AlignedBuffer>>& weights,
                        const std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>& extensions,
                        std::string weights_path) {
     _impl = std::make_shared<InputModelIRImpl>(model, weights, extensions, std::move(weights_path));
@@ -265,17 +370,40 @@ std::shared_ptr<ov::Model> InputModel::convert() {
 }
 
 std::shared_ptr<ov::Model> InputModel::InputModelIRImpl::convert() {
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::ir_frontend, "InputModel::convert");
     std::unordered_map<std::string, std::shared_ptr<ov::op::util::Variable>> variables;
 
     // Load default opsets
     size_t version = static_cast<size_t>(ov::util::pugixml::get_uint64_attr(m_root, "version", 0));
-    ov::util::XmlDeserializer visitor(m_root, m_weights, m_opsets, m_extensions, variables, version);
+    XmlDeserializer visitor(m_root, m_weights, m_opsets, m_extensions, variables, version, [this] {
+        wait_weights();
+    });
     std::shared_ptr<ov::Model> model;
-    visitor.on_attribute("net", model);
+    if (m_layer_reader) {
+        // the nodes are created as the layers are parsed, so only the xml of the layers which wait for their inputs
+        // is kept in memory
+        auto parse_time = m_parse_time;
+        size_t next_layer = 0;
+        model = visitor.parse_function(m_root, [&](pugi::xml_document& layer) {
+            if (next_layer == m_layer_reader->get_layers_count()) {
+                return false;
+            }
+            const auto start = std::chrono::steady_clock::now();
+            m_layer_reader->parse_layer(next_layer++, layer);
+            parse_time += std::chrono::steady_clock::now() - start;
+            return true;
+        });
+        report_parse_time(parse_time);
+    } else {
+        visitor.on_attribute("net", model);
+    }
+    // the model may have no constants, the weights are still awaited to report the error of their loading
+    wait_weights();
     model->get_rt_info()["version"] = int64_t(version);
     if (!m_weights_path.empty())
         model->get_rt_info()["__weights_path"] = m_weights_path;
     parse_pre_process(m_root, m_weights, model);
+    report_peak_rss();
 
     return model;
 }
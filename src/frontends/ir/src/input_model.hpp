@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <future>
 #include <istream>
 #include <memory>
 
@@ -20,13 +21,15 @@ class InputModel : public ov::frontend::InputModel {
     std::shared_ptr<InputModelIRImpl> _impl;
 
 public:
+    // The weights are awaited by convert when the first constant needs them, so they are loaded in parallel with the
+    // parsing of the xml and the creation of the nodes coming before
     InputModel(std::istream& stream,
-               const std::shared_ptr<ov::AlignedBuffer>& weights,
+               const std::shared_future<std::shared_ptr<ov::AlignedBuffer>>& weights,
                const std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>& extensions,
                std::string weights_path = {});
 
     InputModel(const std::shared_ptr<ov::AlignedBuffer>& model_buf,
-               const std::shared_ptr<ov::AlignedBuffer>& weights,
+               const std::shared_future<std::shared_ptr<ov::AlignedBuffer>>& weights,
                const std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>& extensions,
                std::string weights_path = {});
 
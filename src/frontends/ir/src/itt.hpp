@@ -0,0 +1,24 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief Defines openvino IR frontend domains for tracing
+ * @file itt.hpp
+ */
+
+#pragma once
+
+#include "openvino/itt.hpp"
+
+namespace ov {
+namespace frontend {
+namespace ir {
+namespace itt {
+namespace domains {
+OV_ITT_DOMAIN(ir_frontend, "ov::frontend::ir");
+}  // namespace domains
+}  // namespace itt
+}  // namespace ir
+}  // namespace frontend
+}  // namespace ov
@@ -4,6 +4,18 @@
 
 #include "utils.hpp"
 
+// clang-format off
+#ifdef _WIN32
+#    ifndef NOMINMAX
+#        define NOMINMAX
+#    endif
+#    include <windows.h>
+#    include <psapi.h>
+#else
+#    include <sys/resource.h>
+#endif
+// clang-format on
+
 #include "openvino/core/type/element_type.hpp"
 #include "openvino/util/common_util.hpp"
 
@@ -13,4 +25,31 @@ void operator>>(const std::stringstream& in, ov::element::Type& type) {
     type = ov::element::Type(ov::util::trim(in.str()));
 }
 
+namespace frontend {
+namespace ir {
+
+uint64_t get_peak_rss_kb() {
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS counters;
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+        return 0;
+    }
+    return static_cast<uint64_t>(counters.PeakWorkingSetSize / 1024);
+#else
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return 0;
+    }
+#    ifdef __APPLE__
+    // in bytes
+    return static_cast<uint64_t>(usage.ru_maxrss) / 1024;
+#    else
+    return static_cast<uint64_t>(usage.ru_maxrss);
+#    endif
+#endif
+}
+
+}  // namespace ir
+}  // namespace frontend
+
 }  // namespace ov
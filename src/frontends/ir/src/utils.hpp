@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <pugixml.hpp>
 
@@ -12,4 +13,11 @@
 
 namespace ov {
 void operator>>(const std::stringstream& in, ov::element::Type& type);
+
+namespace frontend {
+namespace ir {
+/// \brief Returns the peak resident set size of the process in KB, 0 if it's unknown
+uint64_t get_peak_rss_kb();
+}  // namespace ir
+}  // namespace frontend
 }  // namespace ov
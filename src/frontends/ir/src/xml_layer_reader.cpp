@@ -0,0 +1,136 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "xml_layer_reader.hpp"
+
+#include <cstring>
+#include <string>
+#include <string_view>
+
+#include "openvino/core/except.hpp"
+
+namespace ov {
+namespace frontend {
+namespace ir {
+namespace {
+
+constexpr size_t npos = std::string_view::npos;
+
+// returns the position after the terminator, npos if it isn't found
+size_t skip_to(std::string_view xml, size_t pos, std::string_view terminator) {
+    const auto found = xml.find(terminator, pos);
+    return found == npos ? npos : found + terminator.size();
+}
+
+// returns the position of '>' which ends the tag started at pos, npos if the tag isn't terminated
+size_t find_tag_end(std::string_view xml, size_t pos) {
+    char quote = 0;
+    for (; pos < xml.size(); pos++) {
+        const char c = xml[pos];
+        if (quote) {
+            if (c == quote) {
+                quote = 0;
+            }
+        } else if (c == '"' || c == '\'') {
+            quote = c;
+        } else if (c == '>') {
+            return pos;
+        }
+    }
+    return npos;
+}
+
+std::string_view tag_name(std::string_view xml, size_t pos) {
+    const auto end = xml.find_first_of(" \t\r\n/>", pos);
+    return xml.substr(pos, end == npos ? npos : end - pos);
+}
+
+}  // namespace
+
+XmlLayerReader::XmlLayerReader(const char* xml, size_t size) : m_xml(xml), m_size(size) {
+    const std::string_view text(xml, size);
+    // depth of the elements: the net is 0, its layers section is 1 and the layers are 2
+    size_t depth = 0;
+    bool in_layers = false;
+    size_t layer_begin = 0;
+    size_t pos = 0;
+    while ((pos = text.find('<', pos)) != npos) {
+        if (text.compare(pos, 4, "<!--") == 0) {
+            pos = skip_to(text, pos + 4, "-->");
+        } else if (text.compare(pos, 9, "<![CDATA[") == 0) {
+            pos = skip_to(text, pos + 9, "]]>");
+        } else if (text.compare(pos, 2, "<?") == 0) {
+            pos = skip_to(text, pos + 2, "?>");
+        } else if (text.compare(pos, 2, "<!") == 0) {
+            pos = skip_to(text, pos + 2, ">");
+        } else {
+            const auto tag_end = find_tag_end(text, pos + 1);
+            if (tag_end == npos) {
+                return;
+            }
+            if (text[pos + 1] == '/') {
+                if (depth == 0) {
+                    return;
+                }
+                depth--;
+                const auto name = tag_name(text, pos + 2);
+                if (in_layers && depth == 2 && name == "layer") {
+                    m_layers.emplace_back(layer_begin, tag_end + 1);
+                } else if (in_layers && depth == 1 && name == "layers") {
+                    m_layers_end = pos;
+                    m_valid = true;
+                    return;
+                }
+            } else {
+                const bool self_closing = text[tag_end - 1] == '/';
+                const auto name = tag_name(text, pos + 1);
+                if (depth == 1 && name == "layers") {
+                    if (self_closing) {
+                        m_layers_begin = m_layers_end = pos;
+                        m_valid = true;
+                        return;
+                    }
+                    in_layers = true;
+                    m_layers_begin = tag_end + 1;
+                } else if (in_layers && depth == 2 && name == "layer") {
+                    if (self_closing) {
+                        m_layers.emplace_back(pos, tag_end + 1);
+                    } else {
+                        layer_begin = pos;
+                    }
+                }
+                if (!self_closing) {
+                    depth++;
+                }
+            }
+            pos = tag_end + 1;
+        }
+        if (pos == npos) {
+            return;
+        }
+    }
+}
+
+pugi::xml_parse_result XmlLayerReader::parse_net(pugi::xml_document& net) const {
+    OPENVINO_ASSERT(m_valid, "The layers of the IR are not found");
+    std::string text;
+    text.reserve(m_size - (m_layers_end - m_layers_begin));
+    text.append(m_xml, m_layers_begin);
+    text.append(m_xml + m_layers_end, m_size - m_layers_end);
+    return net.load_buffer(text.data(), text.size(), pugi::parse_default, pugi::encoding_utf8);
+}
+
+void XmlLayerReader::parse_layer(size_t index, pugi::xml_document& layer) const {
+    const auto& span = m_layers.at(index);
+    const auto res =
+        layer.load_buffer(m_xml + span.first, span.second - span.first, pugi::parse_default, pugi::encoding_utf8);
+    OPENVINO_ASSERT(res.status == pugi::status_ok,
+                    res.description(),
+                    " at offset ",
+                    static_cast<size_t>(res.offset) + span.first);
+}
+
+}  // namespace ir
+}  // namespace frontend
+}  // namespace ov
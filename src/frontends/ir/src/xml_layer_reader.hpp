@@ -0,0 +1,65 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <pugixml.hpp>
+#include <utility>
+#include <vector>
+
+namespace ov {
+namespace frontend {
+namespace ir {
+
+/**
+ * @brief Splits the text of the IR xml into the net without its layers and the layers of the net, so the layers may be
+ * parsed and converted one by one instead of building the DOM of the whole document.
+ *
+ * Only the tags are scanned: the comments, CDATA sections, processing instructions and quoted attribute values are
+ * skipped. The layers of the subgraph bodies stay in the xml of their layer.
+ */
+class XmlLayerReader {
+public:
+    /**
+     * @param xml the text of the xml, it must outlive the reader
+     * @param size the size of the text
+     */
+    XmlLayerReader(const char* xml, size_t size);
+
+    /**
+     * @brief Returns false if the layers section of the net isn't found, the document has to be parsed at once then.
+     */
+    bool is_valid() const {
+        return m_valid;
+    }
+
+    /**
+     * @brief Parses the net with an empty layers section.
+     */
+    pugi::xml_parse_result parse_net(pugi::xml_document& net) const;
+
+    size_t get_layers_count() const {
+        return m_layers.size();
+    }
+
+    /**
+     * @brief Parses the layer of the net into the document, throws if it isn't a valid xml.
+     */
+    void parse_layer(size_t index, pugi::xml_document& layer) const;
+
+private:
+    const char* m_xml;
+    size_t m_size;
+    bool m_valid = false;
+    // the content of the layers section
+    size_t m_layers_begin = 0;
+    size_t m_layers_end = 0;
+    // the beginning and the end of each layer
+    std::vector<std::pair<size_t, size_t>> m_layers;
+};
+
+}  // namespace ir
+}  // namespace frontend
+}  // namespace ov
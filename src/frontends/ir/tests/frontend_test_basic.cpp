@@ -92,6 +92,116 @@ TEST_F(IRFrontendTests, elementary_model_reading_v11) {
     EXPECT_TRUE(res.valid) << res.message;
 }
 
+TEST_F(IRFrontendTests, model_reading_layers_before_their_inputs) {
+    // the layers are converted as they are parsed, so the ones listed before their inputs have to wait for them
+    std::string testModel = R"V0G0N(
+<net name="Network" version="11">
+    <layers>
+        <layer name="output1" type="Result" id="1" version="opset1">
+            <input>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                </port>
+            </input>
+        </layer>
+        <!-- </layers> <layer id="5"/> -->
+        <layer name="input" type="Parameter" id="0" version="opset1">
+            <data element_type="f32" shape="1,3"/>
+            <output>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="output2" type="Result" id="3" version="opset1">
+            <input>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                </port>
+            </input>
+        </layer>
+        <layer name="relu" type="ReLU" id="2" version="opset1">
+            <input>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                </port>
+            </input>
+            <output>
+                <port id="1" precision="FP32">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="2" to-port="0"/>
+        <edge from-layer="2" from-port="1" to-layer="1" to-port="0"/>
+        <edge from-layer="0" from-port="0" to-layer="3" to-port="0"/>
+    </edges>
+</net>
+)V0G0N";
+
+    std::shared_ptr<ov::Model> model;
+    OV_ASSERT_NO_THROW(model = getWithIRFrontend(testModel));
+    ASSERT_TRUE(!!model);
+
+    std::shared_ptr<ov::Model> modelRef;
+    {
+        auto parameter = std::make_shared<ov::opset1::Parameter>(ov::element::f32, ov::Shape{1, 3});
+        parameter->set_friendly_name("input");
+        auto relu = std::make_shared<ov::opset1::Relu>(parameter);
+        relu->set_friendly_name("relu");
+        auto result1 = std::make_shared<ov::opset1::Result>(relu);
+        result1->set_friendly_name("output1");
+        auto result2 = std::make_shared<ov::opset1::Result>(parameter);
+        result2->set_friendly_name("output2");
+        modelRef = std::make_shared<ov::Model>(ov::OutputVector{result1, result2}, ov::ParameterVector{parameter});
+    }
+
+    const auto fc = FunctionsComparator::with_default()
+                        .enable(FunctionsComparator::ATTRIBUTES)
+                        .enable(FunctionsComparator::PRECISIONS)
+                        .enable(FunctionsComparator::NAMES);
+    const auto res = fc.compare(model, modelRef);
+    EXPECT_TRUE(res.valid) << res.message;
+}
+
+TEST_F(IRFrontendTests, model_reading_layer_with_missing_input) {
+    std::string testModel = R"V0G0N(
+<net name="Network" version="11">
+    <layers>
+        <layer name="input" type="Parameter" id="0" version="opset1">
+            <data element_type="f32" shape="1,3"/>
+            <output>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="output" type="Result" id="1" version="opset1">
+            <input>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                </port>
+            </input>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="2" from-port="0" to-layer="1" to-port="0"/>
+    </edges>
+</net>
+)V0G0N";
+
+    ASSERT_THROW(getWithIRFrontend(testModel), ov::Exception);
+}
+
 TEST_F(IRFrontendTests, elementary_model_reading_v11_undefined_precisoin) {
     std::string testModelV11 = R"V0G0N(
 <net name="Network" version="11">
@@ -852,6 +962,46 @@ TEST_F(IRFrontendTests, model_with_missing_weights_from_disk) {
     ASSERT_THROW(core.read_model(xmlFileName, binFileName), ov::Exception);
 }
 
+TEST_F(IRFrontendTests, model_with_missing_weights_from_disk_throws_on_convert) {
+    std::string xmlModel = R"V0G0N(
+<?xml version="1.0" ?>
+<net name="Network" version="11">
+    <layers>
+        <layer id="0" name="value1" type="Const" version="opset1">
+            <data element_type="i64" shape="4" offset="0" size="32" />
+            <output>
+                <port id="0" precision="I64">
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="output" type="Result" id="1" version="opset1">
+            <input>
+                <port id="0" precision="I64">
+                    <dim>4</dim>
+                </port>
+            </input>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="0"/>
+    </edges>
+</net>
+)V0G0N";
+
+    createTemporalModelFile(xmlModel);
+
+    // the weights are loaded in parallel with the conversion, the error is reported when the constant needs them
+    for (const auto enable_mmap : {true, false}) {
+        ov::AnyVector params{xmlFileName, binFileName, enable_mmap};
+        auto FE = manager.load_by_model(params);
+        ASSERT_NE(nullptr, FE);
+        ov::frontend::InputModel::Ptr input_model;
+        ASSERT_NO_THROW(input_model = FE->load(params));
+        EXPECT_THROW(FE->convert(input_model), ov::Exception);
+    }
+}
+
 TEST_F(IRFrontendTests, missing_layer_data) {
     std::string model = R"V0G0N(
 <net name="Network" version="11">
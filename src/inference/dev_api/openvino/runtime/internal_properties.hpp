@@ -57,6 +57,19 @@ static constexpr Property<std::string, PropertyMutability::WO> config_device_id{
  */
 static constexpr Property<int32_t, PropertyMutability::RW> threads_per_stream{"THREADS_PER_STREAM"};
 
+/**
+ * @brief Defines how the streams of the CPU streams executor pick up the tasks
+ * @ingroup ov_dev_api_plugin_api
+ */
+static constexpr Property<ov::threading::IStreamsExecutor::Config::TaskScheduling, PropertyMutability::RW>
+    task_scheduling{"TASK_SCHEDULING"};
+
+/**
+ * @brief The NUMA node the compiled model runs on, -1 (default) selects the node of the thread compiling the model
+ * @ingroup ov_dev_api_plugin_api
+ */
+static constexpr Property<int32_t, PropertyMutability::RW> numa_node_id{"NUMA_NODE_ID"};
+
 /**
  * @brief It contains compiled_model_runtime_properties information to make plugin runtime can check whether it is
  * compatible with the cached compiled model, the result is returned by get_property() calling.
@@ -51,6 +51,13 @@ public:
      */
     virtual ov::SoPtr<ov::ITensor> get_state() const;
 
+    /**
+     * @brief Moves the state content to a file and releases its memory, the state is restored on the next inference.
+     * Not thread-safe, the caller serializes it with the inference and the other calls to the state
+     * @param file_path Path to the file to store the state
+     */
+    virtual void offload(const std::string& file_path);
+
 protected:
     /**
      * @brief A default dtor
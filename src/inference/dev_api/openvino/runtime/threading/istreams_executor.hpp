@@ -9,7 +9,9 @@
 
 #pragma once
 
+#include <istream>
 #include <memory>
+#include <ostream>
 #include <string>
 #include <vector>
 #include <mutex>
@@ -76,6 +78,16 @@ public:
             THROUGHPUT,              //!< throughput mode
         };
 
+        /**
+         * @enum       TaskScheduling
+         * @brief      This enum contains definition of the ways the streams pick up the tasks.
+         */
+        enum class TaskScheduling {
+            SHARED_QUEUE,   //!< All the streams pop the tasks from a single queue guarded by a mutex
+            WORK_STEALING,  //!< Each stream has its own lock-free queue and steals from the other streams when idle,
+                            //!< NUMA-local streams first
+        };
+
     private:
         std::string _name;             //!< Used by `ITT` to name executor threads
         int _streams = 1;              //!< Number of streams.
@@ -99,6 +111,7 @@ public:
         int _sub_streams = 0;
         std::vector<int> _rank = {};
         bool _add_lock = true;
+        TaskScheduling _task_scheduling = TaskScheduling::SHARED_QUEUE;
 
         /**
          * @brief Get and reserve cpu ids based on configuration and hardware information,
@@ -213,6 +226,9 @@ public:
         std::vector<int> get_rank() const {
             return _rank;
         }
+        TaskScheduling get_task_scheduling() const {
+            return _task_scheduling;
+        }
         StreamsMode get_sub_stream_mode() const {
             const auto proc_type_table = get_proc_type_table();
             int sockets = proc_type_table.size() > 1 ? static_cast<int>(proc_type_table.size()) - 1 : 1;
@@ -222,8 +238,8 @@ public:
         bool operator==(const Config& config) {
             if (_name == config._name && _streams == config._streams &&
                 _threads_per_stream == config._threads_per_stream &&
-                _thread_preferred_core_type == config._thread_preferred_core_type &&
-                _rank == config._rank) {
+                _thread_preferred_core_type == config._thread_preferred_core_type && _rank == config._rank &&
+                _task_scheduling == config._task_scheduling) {
                 return true;
             } else {
                 return false;
@@ -291,6 +307,32 @@ public:
     virtual void execute(Task task) = 0;
 };
 
+/** @cond INTERNAL */
+inline std::ostream& operator<<(std::ostream& os, const IStreamsExecutor::Config::TaskScheduling& mode) {
+    switch (mode) {
+    case IStreamsExecutor::Config::TaskScheduling::SHARED_QUEUE:
+        return os << "SHARED_QUEUE";
+    case IStreamsExecutor::Config::TaskScheduling::WORK_STEALING:
+        return os << "WORK_STEALING";
+    default:
+        OPENVINO_THROW("Unsupported task scheduling mode");
+    }
+}
+
+inline std::istream& operator>>(std::istream& is, IStreamsExecutor::Config::TaskScheduling& mode) {
+    std::string str;
+    is >> str;
+    if (str == "SHARED_QUEUE") {
+        mode = IStreamsExecutor::Config::TaskScheduling::SHARED_QUEUE;
+    } else if (str == "WORK_STEALING") {
+        mode = IStreamsExecutor::Config::TaskScheduling::WORK_STEALING;
+    } else {
+        OPENVINO_THROW("Unsupported task scheduling mode: ", str);
+    }
+    return is;
+}
+/** @endcond */
+
 static std::mutex _streams_executor_mutex;
 
 }  // namespace threading
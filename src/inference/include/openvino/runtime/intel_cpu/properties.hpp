@@ -117,5 +117,35 @@ static constexpr Property<bool> denormals_optimization{"CPU_DENORMALS_OPTIMIZATI
  */
 static constexpr Property<float> sparse_weights_decompression_rate{"CPU_SPARSE_WEIGHTS_DECOMPRESSION_RATE"};
 
+/**
+ * @brief Read-only property to get the counters of the runtime work caused by the input shape changes
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * The counters are summed over all the streams of the compiled model:
+ *  - RUNTIME_CACHE_HITS, RUNTIME_CACHE_MISSES, RUNTIME_CACHE_EVICTIONS: lookups in the runtime cache of primitives
+ *  - PREPARE_PARAMS: primitive updates done for the new input shapes
+ *  - OUTPUT_REALLOCATIONS: output memory blocks allocated again for the bigger output shapes
+ *
+ * @code
+ * auto statistics = compiled_model.get_property(ov::intel_cpu::runtime_statistics);
+ * @endcode
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> runtime_statistics{
+    "CPU_RUNTIME_STATISTICS"};
+
+/**
+ * @brief Read-only property to get the memory in bytes held by the KV cache states of the stateful model
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * The size is summed over all the infer requests of the compiled model. It is the memory allocated by the plugin:
+ * the caches in their precision (e.g. u8 or u4) with the spare room reserved for the next tokens, the beam tables and
+ * the scales / zero points of the quantized caches. The offloaded states are not counted.
+ *
+ * @code
+ * auto size = compiled_model.get_property(ov::intel_cpu::kv_cache_memory_size);
+ * @endcode
+ */
+static constexpr Property<uint64_t, PropertyMutability::RO> kv_cache_memory_size{"CPU_KV_CACHE_MEMORY_SIZE"};
+
 }  // namespace intel_cpu
 }  // namespace ov
@@ -736,6 +736,20 @@ static constexpr Property<bool, PropertyMutability::RO> loaded_from_cache{"LOADE
  */
 static inline constexpr Property<std::filesystem::path, PropertyMutability::WO> cache_model_path{"CACHE_MODEL_PATH"};
 
+/**
+ * @brief Read-write property to write compiled models to the cache in background. Disabled by default.
+ * @ingroup ov_runtime_cpp_prop_api
+ *
+ * If enabled, on a cache miss `core::compile_model` returns the compiled model right after the compilation and the
+ * compiled blob is exported to `ov::cache_dir` by a background thread. The core waits for pending writes on
+ * destruction, other `compile_model` calls for the same model wait until the blob is written.
+ *
+ * value type: boolean
+ *   - True write compiled blobs in background
+ *   - False write compiled blobs before `core::compile_model` returns
+ */
+static constexpr Property<bool, PropertyMutability::RW> cache_write_async{"CACHE_WRITE_ASYNC"};
+
 /**
  * @brief Enum to define possible workload types
  *
@@ -889,6 +903,25 @@ static constexpr Property<uint32_t, PropertyMutability::RO> max_batch_size{"MAX_
  */
 static constexpr Property<uint32_t, PropertyMutability::RW> auto_batch_timeout{"AUTO_BATCH_TIMEOUT"};
 
+/**
+ * @brief Read-write property to enable the adaptive auto-batching
+ * @ingroup ov_runtime_cpp_prop_api
+ *
+ * The batch size is chosen per dispatch from the number of the collected inputs and the measured latency. The inputs
+ * collected by the moment of the time-out are executed with the smaller batch sizes compiled in advance (powers of 2)
+ * instead of being executed one by one.
+ */
+static constexpr Property<bool, PropertyMutability::RW> auto_batch_adaptive{"AUTO_BATCH_ADAPTIVE"};
+
+/**
+ * @brief Read-write property to set the latency target (in ms) for the adaptive auto-batching, 0 means no target
+ * @ingroup ov_runtime_cpp_prop_api
+ *
+ * The time to collect the inputs is shortened to fit the measured latency of the full batch into the target, and the
+ * batch sizes whose measured latency exceeds the target are not used.
+ */
+static constexpr Property<uint32_t, PropertyMutability::RW> auto_batch_latency_target{"AUTO_BATCH_LATENCY_TARGET"};
+
 /**
  * @brief Read-only property to provide a hint for a range for number of async infer requests. If device supports
  * streams, the metric provides range for number of IRs per stream.
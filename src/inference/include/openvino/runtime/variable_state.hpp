@@ -74,6 +74,19 @@ public:
      * @param state The current state to set.
      */
     void set_state(const Tensor& state);
+
+    /**
+     * @brief Moves the state content to a file and releases its memory until the next inference.
+     * The state is restored from the file on the next inference and the file is removed after that. get_state() reads
+     * the content from the file and keeps the state offloaded, set_state() and reset() remove the file. It lets an
+     * idle request keep its state without holding the memory.
+     * The content is written in the precision of the state, e.g. a KV cache with u8 or u4 precision is stored
+     * quantized; a state of f16/f32 precision is not re-quantized on offload.
+     * The call is not thread-safe: it must not run concurrently with an inference of the request or with other calls
+     * to its states.
+     * @param file_path Path to the file to store the state, the file is overwritten if it exists.
+     */
+    void offload(const std::string& file_path);
 };
 
 }  // namespace ov
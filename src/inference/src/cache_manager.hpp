@@ -9,13 +9,18 @@
  */
 #pragma once
 
+#include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <filesystem>
 #include <fstream>
 #include <functional>
 #include <memory>
 #include <string>
+#include <system_error>
 #include <variant>
 
+#include "openvino/core/except.hpp"
 #include "openvino/runtime/shared_buffer.hpp"
 #include "openvino/runtime/tensor.hpp"
 #include "openvino/util/file_util.hpp"
@@ -128,15 +133,42 @@ public:
     ~FileStorageCacheManager() override = default;
 
 private:
+    // Unique among the threads of the process by the counter and among the processes by the time the process wrote
+    // its first blob. std::random_device is not used as it may throw when no entropy source is available
+    static std::string unique_tmp_suffix() {
+        static const auto process_tag = std::chrono::steady_clock::now().time_since_epoch().count();
+        static std::atomic<uint64_t> counter{0};
+        return std::to_string(process_tag) + "." + std::to_string(counter++);
+    }
+
     void write_cache_entry(const std::string& id, StreamWriter writer) override {
         // Fix the bug caused by pugixml, which may return unexpected results if the locale is different from "C".
         ScopedLocale plocal_C(LC_ALL, "C");
         const auto blob_path = get_blob_file(id);
-        std::ofstream stream(blob_path, std::ios_base::binary);
-        writer(stream);
+        // The blob is written to a unique temporary file and renamed, so other threads and processes never read
+        // a partially written blob
+        auto tmp_path = blob_path;
+        tmp_path += "." + unique_tmp_suffix() + ".tmp";
+        std::error_code ec;
+        std::ofstream stream(tmp_path, std::ios_base::binary);
+        try {
+            writer(stream);
+        } catch (...) {
+            stream.close();
+            std::filesystem::remove(tmp_path, ec);
+            throw;
+        }
         stream.close();
-        std::filesystem::permissions(blob_path,
+        if (!stream) {
+            std::filesystem::remove(tmp_path, ec);
+            OPENVINO_THROW("Failed to write the compiled blob to ", ov::util::path_to_string(tmp_path));
+        }
+        std::filesystem::permissions(tmp_path,
                                      std::filesystem::perms::owner_read | std::filesystem::perms::group_read);
+        std::filesystem::rename(tmp_path, blob_path, ec);
+        if (ec) {
+            std::filesystem::remove(tmp_path, ec);
+        }
     }
 
     void read_cache_entry(const std::string& id, bool enable_mmap, StreamReader reader) override {
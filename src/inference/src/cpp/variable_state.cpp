@@ -49,4 +49,8 @@ void VariableState::set_state(const Tensor& state) {
     OV_VARIABLE_CALL_STATEMENT(_impl->set_state(get_tensor_impl(state)));
 }
 
+void VariableState::offload(const std::string& file_path) {
+    OV_VARIABLE_CALL_STATEMENT(_impl->offload(file_path));
+}
+
 }  // namespace ov
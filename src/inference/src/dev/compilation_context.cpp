@@ -11,11 +11,20 @@
 #    include <unistd.h>
 #endif
 
+#include <algorithm>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+
 #include "itt.hpp"
 #include "openvino/core/memory_util.hpp"
 #include "openvino/core/parallel.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/util/multi_subgraph_base.hpp"
 #include "openvino/pass/manager.hpp"
 #include "openvino/runtime/compilation_context.hpp"
+#include "openvino/runtime/compute_hash.hpp"
+#include "openvino/util/common_util.hpp"
 #include "openvino/util/file_util.hpp"
 #include "openvino/util/xml_parse_utils.hpp"
 #include "transformations/hash.hpp"
@@ -47,6 +56,157 @@ uint64_t hash_combine_options(uint64_t seed, const ov::AnyMap& compile_options)
     }
     return seed;
 }
+
+using ConstantVector = std::vector<std::shared_ptr<ov::op::v0::Constant>>;
+
+void collect_constants(const ov::Model& model, ConstantVector& constants) {
+    for (const auto& op : model.get_ordered_ops()) {
+        if (auto constant = ov::as_type_ptr<ov::op::v0::Constant>(op)) {
+            constants.push_back(std::move(constant));
+        } else if (const auto subgraph = ov::as_type_ptr<ov::op::util::MultiSubGraphOp>(op)) {
+            for (const auto& body : subgraph->get_functions()) {
+                collect_constants(*body, constants);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Hashes the data of all constants in parallel
+ *
+ * Every constant is split into fixed size chunks which are hashed independently by the CRC based
+ * ov::runtime::compute_hash, so a model dominated by a few huge weights still uses all the cores. The chunk hashes are
+ * combined in the model order, so the result does not depend on the number of threads.
+ *
+ * If the version of the file the constants are mapped from is known, the mapped constants are represented by their
+ * data fingerprints combined with the version instead, so their data is not paged in.
+ */
+uint64_t hash_constants(const ConstantVector& constants, std::optional<uint64_t> mapped_file_version = std::nullopt) {
+    constexpr size_t chunk_size = 4 * 1024 * 1024;
+
+    struct Chunk {
+        const ov::op::v0::Constant* constant;
+        size_t offset;
+        size_t size;
+        std::optional<uint64_t> fingerprint;
+    };
+    std::vector<Chunk> chunks;
+    for (const auto& constant : constants) {
+        if (auto fingerprint = mapped_file_version ? constant->get_data_fingerprint() : std::nullopt) {
+            chunks.push_back({constant.get(), 0, 0, util::u64_hash_combine(*fingerprint, *mapped_file_version)});
+            continue;
+        }
+        const auto byte_size = constant->get_byte_size();
+        if (constant->get_element_type() == ov::element::string || byte_size == 0) {
+            chunks.push_back({constant.get(), 0, byte_size, std::nullopt});
+            continue;
+        }
+        for (size_t offset = 0; offset < byte_size; offset += chunk_size) {
+            chunks.push_back({constant.get(), offset, std::min(chunk_size, byte_size - offset), std::nullopt});
+        }
+    }
+
+    std::vector<uint64_t> chunk_hashes(chunks.size(), 0);
+    ov::parallel_for(chunks.size(), [&](size_t i) {
+        const auto& chunk = chunks[i];
+        if (chunk.fingerprint) {
+            chunk_hashes[i] = *chunk.fingerprint;
+        } else if (chunk.constant->get_element_type() == ov::element::string) {
+            // std::string objects hold pointers, so only their content can be hashed
+            uint64_t seed = 0;
+            for (const auto& str : chunk.constant->get_value_strings()) {
+                seed = util::u64_hash_combine(seed, ov::runtime::compute_hash(str.data(), str.size()));
+            }
+            chunk_hashes[i] = seed;
+        } else {
+            const auto data = static_cast<const char*>(chunk.constant->get_data_ptr()) + chunk.offset;
+            chunk_hashes[i] = ov::runtime::compute_hash(data, chunk.size);
+        }
+    });
+
+    uint64_t seed = 0;
+    for (const auto hash : chunk_hashes) {
+        seed = util::u64_hash_combine(seed, hash);
+    }
+    return seed;
+}
+
+/**
+ * @brief Keeps the weights hash of models read from a weights file
+ *
+ * An entry is reused only while the weights file has the same path, modification time and size and the model still
+ * consists of the very same constant nodes, so repeated compile_model calls for a model read from IR do not rehash
+ * gigabytes of weights.
+ */
+class WeightsHashCache {
+public:
+    static WeightsHashCache& get() {
+        static WeightsHashCache cache;
+        return cache;
+    }
+
+    bool find(const std::string& file_info, const ConstantVector& constants, uint64_t& hash) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        const auto it = m_entries.find(file_info);
+        if (it == m_entries.end() || it->second.constants.size() != constants.size()) {
+            return false;
+        }
+        for (size_t i = 0; i < constants.size(); i++) {
+            if (it->second.constants[i].lock() != constants[i]) {
+                return false;
+            }
+        }
+        hash = it->second.hash;
+        return true;
+    }
+
+    void put(const std::string& file_info, const ConstantVector& constants, uint64_t hash) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        // drop the entries of released models, so the cache does not grow with every model read
+        for (auto it = m_entries.begin(); it != m_entries.end();) {
+            const auto& entry_constants = it->second.constants;
+            const bool expired = std::any_of(entry_constants.begin(), entry_constants.end(), [](const auto& constant) {
+                return constant.expired();
+            });
+            it = expired ? m_entries.erase(it) : std::next(it);
+        }
+        auto& entry = m_entries[file_info];
+        entry.constants.assign(constants.begin(), constants.end());
+        entry.hash = hash;
+    }
+
+private:
+    struct Entry {
+        std::vector<std::weak_ptr<ov::op::v0::Constant>> constants;
+        uint64_t hash = 0;
+    };
+
+    std::mutex m_mutex;
+    std::unordered_map<std::string, Entry> m_entries;
+};
+
+uint64_t hash_weights(const ov::Model& model) {
+    OV_ITT_SCOPE(FIRST_INFERENCE, ov::itt::domains::ReadTime, "ModelCache::compute_hash - Weights");
+    ConstantVector constants;
+    collect_constants(model, constants);
+
+    const auto& rt_info = model.get_rt_info();
+    const auto weights_path = rt_info.find("__weights_path");
+    if (weights_path == rt_info.end() || !weights_path->second.is<std::string>()) {
+        return hash_constants(constants);
+    }
+
+    // the constants mapped from the weights file are hashed by their fingerprints, which are bound to the file version
+    // by the file info, so a cold compile_model doesn't page in the weights the plugin never touches
+    const auto file_info = ModelCache::calculate_file_info(weights_path->second.as<std::string>());
+    auto& cache = WeightsHashCache::get();
+    uint64_t hash = 0;
+    if (!cache.find(file_info, constants, hash)) {
+        hash = hash_constants(constants, std::hash<std::string>{}(file_info));
+        cache.put(file_info, constants, hash);
+    }
+    return hash;
+}
 }  // namespace
 
 std::string ModelCache::calculate_file_info(const std::filesystem::path& file_path) {
@@ -76,11 +236,16 @@ std::string ModelCache::compute_hash(const std::shared_ptr<const ov::Model>& mod
     OPENVINO_ASSERT(model);
 
     uint64_t seed = 0;
-    // 1. Calculate hash on function, skipping weights if model path is provided
+    // 1. Calculate hash on function, weights are hashed separately in parallel
     ov::pass::Manager m;
-    m.register_pass<ov::pass::Hash>(seed, !model_path.empty());
+    m.register_pass<ov::pass::Hash>(seed, true);
     m.run_passes(std::const_pointer_cast<ov::Model>(model));
 
+    // Weights are skipped if model path is provided
+    if (model_path.empty()) {
+        seed = hash_combine(seed, hash_weights(*model));
+    }
+
     // 2. Compute hash on serialized data and options
     seed = hash_combine_options(seed, compile_options);
 
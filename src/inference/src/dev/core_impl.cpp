@@ -4,6 +4,9 @@
 
 #include "core_impl.hpp"
 
+#include <algorithm>
+#include <chrono>
+#include <future>
 #include <memory>
 #include <variant>
 
@@ -210,10 +213,14 @@ void clean_batch_properties(const std::string& device_name, ov::AnyMap& config,
 static const auto core_properties_names = ov::util::make_array(ov::cache_dir.name(),
                                                                ov::enable_mmap.name(),
                                                                ov::force_tbb_terminate.name(),
-                                                               ov::cache_model_path.name());
+                                                               ov::cache_model_path.name(),
+                                                               ov::cache_write_async.name());
 
 static const auto auto_batch_properties_names =
-    ov::util::make_array(ov::auto_batch_timeout.name(), ov::hint::allow_auto_batching.name());
+    ov::util::make_array(ov::auto_batch_timeout.name(),
+                         ov::auto_batch_adaptive.name(),
+                         ov::auto_batch_latency_target.name(),
+                         ov::hint::allow_auto_batching.name());
 
 std::filesystem::path extract_weight_path(const std::string& compiled_properties) {
     if (auto start = compiled_properties.find(ov::weights_path.name()); start != std::string::npos) {
@@ -430,6 +437,28 @@ ov::CoreImpl::CoreImpl() {
     }
 }
 
+ov::CoreImpl::~CoreImpl() {
+    // the blobs must be completely written before the plugins are unloaded
+    std::lock_guard<std::mutex> lock(m_cache_writes_mutex);
+    for (auto& cache_write : m_cache_writes) {
+        cache_write.second.wait();
+    }
+}
+
+void ov::CoreImpl::wait_cache_write(const std::string& blob_id) const {
+    std::shared_future<void> cache_write;
+    {
+        std::lock_guard<std::mutex> lock(m_cache_writes_mutex);
+        const auto found = m_cache_writes.find(blob_id);
+        if (found != m_cache_writes.end()) {
+            cache_write = found->second;
+        }
+    }
+    if (cache_write.valid()) {
+        cache_write.wait();
+    }
+}
+
 bool ov::CoreImpl::is_proxy_device(const ov::Plugin& plugin) const {
     return is_proxy_device(plugin.get_name());
 }
@@ -840,6 +869,7 @@ ov::SoPtr<ov::ICompiledModel> ov::CoreImpl::compile_model(const std::shared_ptr<
     } else if (cache_manager && device_supports_model_caching(plugin, parsed.m_config) && !is_proxy_device(plugin)) {
         emplace_cache_dir_if_supported(parsed.m_config, plugin, cache_dir);
         CacheContent cache_content{cache_manager, parsed.m_core_config.get_enable_mmap(), get_cache_model_path(config)};
+        cache_content.m_write_async = parsed.m_core_config.get_cache_write_async();
         const auto compiled_config = create_compile_config(plugin, parsed.m_config);
         cache_content.m_blob_id = ModelCache::compute_hash(model, cache_content.m_model_path, compiled_config);
         cache_content.model = model;
@@ -885,6 +915,7 @@ ov::SoPtr<ov::ICompiledModel> ov::CoreImpl::compile_model(const std::shared_ptr<
     } else if (cache_manager && device_supports_model_caching(plugin, parsed.m_config) && !is_proxy_device(plugin)) {
         emplace_cache_dir_if_supported(parsed.m_config, plugin, cache_dir);
         CacheContent cache_content{cache_manager, parsed.m_core_config.get_enable_mmap(), get_cache_model_path(config)};
+        cache_content.m_write_async = parsed.m_core_config.get_cache_write_async();
         const auto compiled_config = create_compile_config(plugin, parsed.m_config);
         cache_content.m_blob_id = ModelCache::compute_hash(model, cache_content.m_model_path, compiled_config);
         cache_content.model = model;
@@ -914,6 +945,7 @@ ov::SoPtr<ov::ICompiledModel> ov::CoreImpl::compile_model(const std::filesystem:
         CoreConfig::remove_core(parsed.m_config);
         emplace_cache_dir_if_supported(parsed.m_config, plugin, cache_dir);
         CacheContent cache_content{cache_manager, parsed.m_core_config.get_enable_mmap(), model_path};
+        cache_content.m_write_async = parsed.m_core_config.get_cache_write_async();
         cache_content.m_blob_id =
             ov::ModelCache::compute_hash(cache_content.m_model_path, create_compile_config(plugin, parsed.m_config));
         const auto lock = m_cache_guard.get_hash_lock(cache_content.m_blob_id);
@@ -943,6 +975,7 @@ ov::SoPtr<ov::ICompiledModel> ov::CoreImpl::compile_model(const std::string& mod
     } else if (cache_manager && device_supports_model_caching(plugin, parsed.m_config) && !is_proxy_device(plugin)) {
         emplace_cache_dir_if_supported(parsed.m_config, plugin, cache_dir);
         CacheContent cache_content{cache_manager, parsed.m_core_config.get_enable_mmap()};
+        cache_content.m_write_async = parsed.m_core_config.get_cache_write_async();
         cache_content.m_blob_id =
             ov::ModelCache::compute_hash(model_str, weights, create_compile_config(plugin, parsed.m_config));
         const auto lock = m_cache_guard.get_hash_lock(cache_content.m_blob_id);
@@ -1251,6 +1284,9 @@ ov::Any ov::CoreImpl::get_property_for_core(const std::string& name) const {
     } else if (name == ov::enable_mmap.name()) {
         const auto flag = m_core_config.get_enable_mmap();
         return decltype(ov::enable_mmap)::value_type(flag);
+    } else if (name == ov::cache_write_async.name()) {
+        const auto flag = m_core_config.get_cache_write_async();
+        return decltype(ov::cache_write_async)::value_type(flag);
     }
 
     OPENVINO_THROW("Exception is thrown while trying to call get_property with unsupported property: '", name, "'");
@@ -1454,30 +1490,62 @@ ov::SoPtr<ov::ICompiledModel> ov::CoreImpl::compile_model_and_cache(ov::Plugin&
     ov::SoPtr<ov::ICompiledModel> compiled_model =
         context ? plugin.compile_model(model, context, parsedConfig) : plugin.compile_model(model, parsedConfig);
     if (cacheContent.m_cache_manager && device_supports_model_caching(plugin)) {
-        try {
-            // need to export network for further import from "cache"
-            OV_ITT_SCOPE(FIRST_INFERENCE, ov::itt::domains::LoadTime, "Core::compile_model::Export");
-            std::string compiled_model_runtime_properties;
-            if (device_supports_internal_property(plugin, ov::internal::compiled_model_runtime_properties.name())) {
-                compiled_model_runtime_properties =
-                    plugin.get_property(ov::internal::compiled_model_runtime_properties.name(), {}).as<std::string>();
-            }
-            cacheContent.m_cache_manager->write_cache_entry(cacheContent.m_blob_id, [&](std::ostream& networkStream) {
-                uint32_t header_size_alignment{};
-                if (device_supports_internal_property(plugin, ov::internal::cache_header_alignment.name())) {
-                    header_size_alignment =
-                        plugin.get_property(ov::internal::cache_header_alignment.name(), {}).as<uint32_t>();
+        // need to export network for further import from "cache"
+        auto export_model = [this, plugin, compiled_model, cacheContent]() {
+            try {
+                OV_ITT_SCOPE(FIRST_INFERENCE, ov::itt::domains::LoadTime, "Core::compile_model::Export");
+                std::string compiled_model_runtime_properties;
+                if (device_supports_internal_property(plugin, ov::internal::compiled_model_runtime_properties.name())) {
+                    compiled_model_runtime_properties =
+                        plugin.get_property(ov::internal::compiled_model_runtime_properties.name(), {})
+                            .as<std::string>();
                 }
+                cacheContent.m_cache_manager->write_cache_entry(
+                    cacheContent.m_blob_id,
+                    [&](std::ostream& networkStream) {
+                        uint32_t header_size_alignment{};
+                        if (device_supports_internal_property(plugin, ov::internal::cache_header_alignment.name())) {
+                            header_size_alignment =
+                                plugin.get_property(ov::internal::cache_header_alignment.name(), {}).as<uint32_t>();
+                        }
 
-                networkStream << ov::CompiledBlobHeader(ov::get_openvino_version().buildNumber,
-                                                        ov::ModelCache::calculate_file_info(cacheContent.m_model_path),
-                                                        compiled_model_runtime_properties,
-                                                        header_size_alignment);
-                compiled_model->export_model(networkStream);
-            });
-        } catch (...) {
-            cacheContent.m_cache_manager->remove_cache_entry(cacheContent.m_blob_id);
-            throw;
+                        networkStream << ov::CompiledBlobHeader(
+                            ov::get_openvino_version().buildNumber,
+                            ov::ModelCache::calculate_file_info(cacheContent.m_model_path),
+                            compiled_model_runtime_properties,
+                            header_size_alignment);
+                        compiled_model->export_model(networkStream);
+                    });
+            } catch (...) {
+                cacheContent.m_cache_manager->remove_cache_entry(cacheContent.m_blob_id);
+                throw;
+            }
+        };
+
+        if (cacheContent.m_write_async) {
+            // the caller holds the hash lock of the blob, so the write is registered before any other compile_model
+            // call for the same model may look up the cache, load_model_from_cache waits for it
+            std::lock_guard<std::mutex> lock(m_cache_writes_mutex);
+            for (auto it = m_cache_writes.begin(); it != m_cache_writes.end();) {
+                if (it->second.wait_for(std::chrono::seconds(0)) == std::future_status::ready) {
+                    it = m_cache_writes.erase(it);
+                } else {
+                    ++it;
+                }
+            }
+            m_cache_writes[cacheContent.m_blob_id] =
+                std::async(std::launch::async, [export_model, blob_id = cacheContent.m_blob_id]() {
+                    try {
+                        export_model();
+                    } catch (const std::exception& ex) {
+                        // the model is just not cached, same as the plugin does not support export
+                        OPENVINO_WARN("Could not write the compiled model ", blob_id, " to cache: ", ex.what());
+                    } catch (...) {
+                        OPENVINO_WARN("Could not write the compiled model ", blob_id, " to cache");
+                    }
+                }).share();
+        } else {
+            export_model();
         }
     }
     return compiled_model;
@@ -1494,6 +1562,9 @@ ov::SoPtr<ov::ICompiledModel> ov::CoreImpl::load_model_from_cache(
 
     OPENVINO_ASSERT(cacheContent.m_cache_manager != nullptr);
 
+    // the blob of the same model may still be written in background
+    wait_cache_write(cacheContent.m_blob_id);
+
     try {
         cacheContent.m_cache_manager->read_cache_entry(
             cacheContent.m_blob_id,
@@ -1641,6 +1712,7 @@ ov::CoreConfig::CoreConfig(const CoreConfig& other) {
         m_devices_cache_config = other.m_devices_cache_config;
     }
     m_flag_enable_mmap = other.m_flag_enable_mmap;
+    m_flag_cache_write_async = other.m_flag_cache_write_async;
 }
 
 void ov::CoreConfig::set(const ov::AnyMap& config, const std::string& device_name) {
@@ -1665,6 +1737,10 @@ void ov::CoreConfig::set(const ov::AnyMap& config, const std::string& device_nam
     if (const auto cfg_entry = config.find(ov::enable_mmap.name()); cfg_entry != config.end()) {
         m_flag_enable_mmap = cfg_entry->second.as<bool>();
     }
+
+    if (const auto cfg_entry = config.find(ov::cache_write_async.name()); cfg_entry != config.end()) {
+        m_flag_cache_write_async = cfg_entry->second.as<bool>();
+    }
 }
 
 void ov::CoreConfig::set_and_update(ov::AnyMap& config, const std::string& device_name) {
@@ -1687,6 +1763,10 @@ bool ov::CoreConfig::get_enable_mmap() const {
     return m_flag_enable_mmap;
 }
 
+bool ov::CoreConfig::get_cache_write_async() const {
+    return m_flag_cache_write_async;
+}
+
 ov::CoreConfig::CacheConfig ov::CoreConfig::get_cache_config_for_device(const ov::Plugin& plugin) const {
     std::lock_guard<std::mutex> lock(m_cache_config_mutex);
     return m_devices_cache_config.count(plugin.get_name()) ? m_devices_cache_config.at(plugin.get_name())
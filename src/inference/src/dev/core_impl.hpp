@@ -4,6 +4,12 @@
 
 #pragma once
 
+#include <future>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
 #include "cache_guard.hpp"
 #include "cache_manager.hpp"
 #include "dev/plugin.hpp"
@@ -47,6 +53,8 @@ public:
 
     bool get_enable_mmap() const;
 
+    bool get_cache_write_async() const;
+
     // Creating thread-safe copy of global config including shared_ptr to ICacheManager
     CacheConfig get_cache_config_for_device(const ov::Plugin& plugin) const;
 
@@ -58,6 +66,7 @@ private:
     CacheConfig m_cache_config{};
     std::map<std::string, CacheConfig> m_devices_cache_config{};
     bool m_flag_enable_mmap{true};
+    bool m_flag_cache_write_async{false};
 };
 
 struct Parsed {
@@ -157,6 +166,7 @@ private:
         std::filesystem::path m_model_path{};
         std::shared_ptr<const ov::Model> model{};
         bool m_mmap_enabled{};
+        bool m_write_async{};
     };
 
     // Core settings (cache config, etc)
@@ -166,6 +176,11 @@ private:
 
     mutable ov::CacheGuard m_cache_guard;
 
+    // Compiled blobs which are written to the cache in background (ov::cache_write_async) by the blob id. The write is
+    // registered while the hash lock of the blob is held, so a following load of the same blob waits for it
+    mutable std::mutex m_cache_writes_mutex;
+    mutable std::unordered_map<std::string, std::shared_future<void>> m_cache_writes;
+
     struct PluginDescriptor {
         std::filesystem::path m_lib_location{};
         ov::AnyMap m_default_config{};
@@ -204,6 +219,8 @@ private:
                                                           const ov::SoPtr<ov::IRemoteContext>& context,
                                                           const CacheContent& cache_content) const;
 
+    void wait_cache_write(const std::string& blob_id) const;
+
     ov::SoPtr<ov::ICompiledModel> load_model_from_cache(
         const CacheContent& cache_content,
         ov::Plugin& plugin,
@@ -231,7 +248,7 @@ private:
 public:
     CoreImpl();
 
-    ~CoreImpl() override = default;
+    ~CoreImpl() override;
 
     /**
      * @brief Register plugins for devices which are located in .xml configuration file.
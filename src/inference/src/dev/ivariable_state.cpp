@@ -25,3 +25,7 @@ void ov::IVariableState::set_state(const ov::SoPtr<ov::ITensor>& state) {
 ov::SoPtr<ov::ITensor> ov::IVariableState::get_state() const {
     return m_state;
 }
+
+void ov::IVariableState::offload(const std::string& /*file_path*/) {
+    OPENVINO_NOT_IMPLEMENTED;
+}
@@ -6,6 +6,8 @@
 
 #include <atomic>
 #include <condition_variable>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <mutex>
 #include <queue>
@@ -24,6 +26,81 @@
 
 namespace ov {
 namespace threading {
+namespace {
+// capacity of the per-stream task queue in the work-stealing mode, the tasks above it go to the shared queue
+constexpr size_t work_stealing_queue_capacity = 1024;
+// number of attempts to find a task before the idle stream goes to sleep
+constexpr int work_stealing_spin_count = 256;
+
+/**
+ * @brief Bounded lock-free multi-producer multi-consumer FIFO queue (D. Vyukov's algorithm).
+ *        In the work-stealing mode any thread pushes the tasks, the owner stream pops them and the idle streams steal
+ *        them from the same end, so the tasks of the same stream are started in the order they were submitted.
+ */
+class LockFreeTaskQueue {
+public:
+    explicit LockFreeTaskQueue(size_t capacity) : _cells(capacity), _mask(capacity - 1) {
+        OPENVINO_ASSERT(capacity && !(capacity & _mask), "The capacity of the task queue must be a power of 2");
+        for (size_t i = 0; i < capacity; ++i) {
+            _cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    bool try_push(Task& task) {
+        auto pos = _tail.load(std::memory_order_relaxed);
+        for (;;) {
+            auto& cell = _cells[pos & _mask];
+            const auto sequence = cell.sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(pos);
+            if (diff == 0) {
+                if (_tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    cell.task = std::move(task);
+                    cell.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;  // full
+            } else {
+                pos = _tail.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    bool try_pop(Task& task) {
+        auto pos = _head.load(std::memory_order_relaxed);
+        for (;;) {
+            auto& cell = _cells[pos & _mask];
+            const auto sequence = cell.sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(pos + 1);
+            if (diff == 0) {
+                if (_head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    task = std::move(cell.task);
+                    cell.task = nullptr;
+                    cell.sequence.store(pos + _mask + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;  // empty
+            } else {
+                pos = _head.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    std::atomic<int> _numaNodeId = {-1};  // NUMA node of the owner stream, -1 until the stream is initialized
+
+private:
+    struct Cell {
+        std::atomic<size_t> sequence;
+        Task task;
+    };
+    std::vector<Cell> _cells;
+    const size_t _mask;
+    alignas(64) std::atomic<size_t> _head = {0};
+    alignas(64) std::atomic<size_t> _tail = {0};
+};
+}  // namespace
+
 struct CPUStreamsExecutor::Impl {
     struct Stream {
 #if OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO || OV_THREAD == OV_THREAD_TBB_ADAPTIVE
@@ -352,11 +429,24 @@ struct CPUStreamsExecutor::Impl {
         } else {
             _usedNumaNodes = std::move(numaNodes);
         }
+        _workStealing = _config.get_task_scheduling() == Config::TaskScheduling::WORK_STEALING && streams_num > 0;
+        if (_workStealing) {
+            for (auto streamId = 0; streamId < streams_num; ++streamId) {
+                _stealQueues.emplace_back(new LockFreeTaskQueue{work_stealing_queue_capacity});
+            }
+        }
         for (auto streamId = 0; streamId < streams_num; ++streamId) {
             if (_config.get_cpu_reservation()) {
                 std::lock_guard<std::mutex> lock(_cpu_ids_mutex);
                 _cpu_ids_all.insert(_cpu_ids_all.end(), processor_ids[streamId].begin(), processor_ids[streamId].end());
             }
+            if (_workStealing) {
+                _threads.emplace_back([this, streamId] {
+                    openvino::itt::threadName(_config.get_name() + "_" + std::to_string(streamId));
+                    WorkStealingLoop(static_cast<size_t>(streamId));
+                });
+                continue;
+            }
             _threads.emplace_back([this, streamId] {
                 openvino::itt::threadName(_config.get_name() + "_" + std::to_string(streamId));
                 for (bool stopped = false; !stopped;) {
@@ -380,6 +470,10 @@ struct CPUStreamsExecutor::Impl {
     }
 
     void Enqueue(Task task) {
+        if (_workStealing) {
+            EnqueueWorkStealing(std::move(task));
+            return;
+        }
         {
             std::lock_guard<std::mutex> lock(_mutex);
             _taskQueue.emplace(std::move(task));
@@ -387,6 +481,89 @@ struct CPUStreamsExecutor::Impl {
         _queueCondVar.notify_one();
     }
 
+    void EnqueueWorkStealing(Task task) {
+        // the queues are filled round-robin, the idle streams balance the load by stealing
+        const auto num_queues = _stealQueues.size();
+        const auto first = _nextQueue.fetch_add(1, std::memory_order_relaxed);
+        bool pushed = false;
+        for (size_t i = 0; i < num_queues && !pushed; ++i) {
+            pushed = _stealQueues[(first + i) % num_queues]->try_push(task);
+        }
+        if (!pushed) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _taskQueue.emplace(std::move(task));
+            _overflowSize.fetch_add(1, std::memory_order_relaxed);
+        }
+        // pairs with the check of the sleeping streams: either the stream going to sleep sees the new task,
+        // or the task producer sees the sleeping stream and wakes it up under the mutex
+        _pendingTasks.fetch_add(1);
+        if (_sleepingStreams.load() > 0) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _queueCondVar.notify_one();
+        }
+    }
+
+    bool TryTakeTask(size_t queue_id, Task& task) {
+        auto take = [&](LockFreeTaskQueue& queue) {
+            if (queue.try_pop(task)) {
+                _pendingTasks.fetch_sub(1);
+                return true;
+            }
+            return false;
+        };
+        auto& own_queue = *_stealQueues[queue_id];
+        if (take(own_queue)) {
+            return true;
+        }
+        // steal from the streams of the same NUMA node first, to keep the data of the task local
+        const auto num_queues = _stealQueues.size();
+        const auto numa_node_id = own_queue._numaNodeId.load(std::memory_order_relaxed);
+        for (const bool local : {true, false}) {
+            for (size_t i = 1; i < num_queues; ++i) {
+                auto& victim = *_stealQueues[(queue_id + i) % num_queues];
+                if ((victim._numaNodeId.load(std::memory_order_relaxed) == numa_node_id) == local && take(victim)) {
+                    return true;
+                }
+            }
+        }
+        if (_overflowSize.load(std::memory_order_relaxed) > 0) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (!_taskQueue.empty()) {
+                task = std::move(_taskQueue.front());
+                _taskQueue.pop();
+                _overflowSize.fetch_sub(1, std::memory_order_relaxed);
+                _pendingTasks.fetch_sub(1);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void WorkStealingLoop(size_t queue_id) {
+        _stealQueues[queue_id]->_numaNodeId = _streams->local()->_numaNodeId;
+        for (;;) {
+            Task task;
+            // bounded spinning, as the next task usually arrives soon under the throughput load
+            for (int spin = 0; spin < work_stealing_spin_count && !TryTakeTask(queue_id, task); ++spin) {
+                std::this_thread::yield();
+            }
+            if (task) {
+                Execute(task, *(_streams->local()));
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(_mutex);
+            _sleepingStreams.fetch_add(1);
+            _queueCondVar.wait(lock, [&] {
+                return _pendingTasks.load() > 0 || _isStopped;
+            });
+            _sleepingStreams.fetch_sub(1);
+            // all the submitted tasks are executed before the executor is destroyed
+            if (_isStopped && _pendingTasks.load() == 0) {
+                break;
+            }
+        }
+    }
+
     void Execute(const Task& task, Stream& stream) {
 #if OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO || OV_THREAD == OV_THREAD_TBB_ADAPTIVE
         auto& arena = stream._taskArena;
@@ -456,6 +633,13 @@ struct CPUStreamsExecutor::Impl {
     std::condition_variable _queueCondVar;
     std::queue<Task> _taskQueue;
     bool _isStopped = false;
+    // the work-stealing mode, the shared _taskQueue keeps only the tasks which do not fit into the stream queues
+    bool _workStealing = false;
+    std::vector<std::unique_ptr<LockFreeTaskQueue>> _stealQueues;
+    std::atomic<size_t> _nextQueue = {0};
+    std::atomic<int> _pendingTasks = {0};
+    std::atomic<int> _sleepingStreams = {0};
+    std::atomic<int> _overflowSize = {0};
     std::vector<int> _usedNumaNodes;
     std::shared_ptr<CustomThreadLocal> _streams;
     bool _isExit = false;
@@ -63,6 +63,8 @@ void IStreamsExecutor::Config::set_property(const ov::AnyMap& property) {
             _threads = val_i;
         } else if (key == ov::internal::threads_per_stream) {
             _threads_per_stream = static_cast<int>(value.as<size_t>());
+        } else if (key == ov::internal::task_scheduling) {
+            _task_scheduling = value.as<TaskScheduling>();
         } else {
             OPENVINO_THROW("Not recognized property key ", key);
         }
@@ -75,6 +77,7 @@ ov::Any IStreamsExecutor::Config::get_property(const std::string& key) const {
             ov::num_streams.name(),
             ov::inference_num_threads.name(),
             ov::internal::threads_per_stream.name(),
+            ov::internal::task_scheduling.name(),
         };
         return properties;
     } else if (key == ov::num_streams) {
@@ -83,6 +86,8 @@ ov::Any IStreamsExecutor::Config::get_property(const std::string& key) const {
         return decltype(ov::inference_num_threads)::value_type{_threads};
     } else if (key == ov::internal::threads_per_stream) {
         return decltype(ov::internal::threads_per_stream)::value_type{_threads_per_stream};
+    } else if (key == ov::internal::task_scheduling) {
+        return decltype(ov::internal::task_scheduling)::value_type{_task_scheduling};
     } else {
         OPENVINO_THROW("Wrong value for property key ", key);
     }
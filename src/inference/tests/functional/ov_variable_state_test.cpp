@@ -32,3 +32,8 @@ TEST_F(VariableStateOVTests, throwsOnUninitializedSetState) {
     ov::Tensor tensor;
     ASSERT_THROW(state.set_state(tensor), ov::Exception);
 }
+
+TEST_F(VariableStateOVTests, throwsOnUninitializedOffload) {
+    ov::VariableState state;
+    ASSERT_THROW(state.offload("state.bin"), ov::Exception);
+}
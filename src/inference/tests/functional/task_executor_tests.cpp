@@ -9,6 +9,7 @@
 
 #include "common_test_utils/test_assertions.hpp"
 #include "openvino/core/parallel.hpp"
+#include "openvino/runtime/internal_properties.hpp"
 #include "openvino/runtime/threading/cpu_streams_executor.hpp"
 #include "openvino/runtime/threading/immediate_executor.hpp"
 
@@ -217,6 +218,13 @@ TEST_P(ASyncTaskExecutorTests, runAndWaitDoesNotOwnTasks) {
 
 class StreamsExecutorConfigTest : public ::testing::Test {};
 
+static CPUStreamsExecutor::Ptr make_work_stealing_executor(int streams) {
+    auto threads = parallel_get_max_threads();
+    IStreamsExecutor::Config config{"TestCPUStreamsExecutor", streams, threads / streams};
+    config.set_property({ov::internal::task_scheduling(IStreamsExecutor::Config::TaskScheduling::WORK_STEALING)});
+    return std::make_shared<CPUStreamsExecutor>(config);
+}
+
 static auto Executors = ::testing::Values(
     [] {
         auto streams = get_number_of_cpu_cores();
@@ -236,6 +244,9 @@ static auto Executors = ::testing::Values(
         return std::make_shared<CPUStreamsExecutor>(
             IStreamsExecutor::Config{"TestCPUStreamsExecutor", streams, threads / streams});
     },
+    [] {
+        return make_work_stealing_executor(get_number_of_cpu_cores());
+    },
     [] {
         return std::make_shared<ImmediateExecutor>();
     });
@@ -260,6 +271,9 @@ static auto AsyncExecutors = ::testing::Values(
         auto threads = parallel_get_max_threads();
         return std::make_shared<CPUStreamsExecutor>(
             IStreamsExecutor::Config{"TestCPUStreamsExecutor", streams, threads / streams});
+    },
+    [] {
+        return make_work_stealing_executor(get_number_of_cpu_cores());
     });
 
 INSTANTIATE_TEST_SUITE_P(ASyncTaskExecutorTests, ASyncTaskExecutorTests, AsyncExecutors);
@@ -10,14 +10,18 @@
 #include <fstream>
 #include <string>
 #include <thread>
+#include <vector>
 
 #include "common_test_utils/common_utils.hpp"
 #include "common_test_utils/test_constants.hpp"
+#include "openvino/core/graph_util.hpp"
 #include "openvino/core/preprocess/pre_post_process.hpp"
 #include "openvino/op/add.hpp"
 #include "openvino/op/constant.hpp"
 #include "openvino/op/multiply.hpp"
 #include "openvino/op/parameter.hpp"
+#include "openvino/runtime/shared_buffer.hpp"
+#include "openvino/util/mmap_object.hpp"
 #include "transformations/rt_info/fused_names_attribute.hpp"
 #include "transformations/rt_info/primitives_priority_attribute.hpp"
 
@@ -322,6 +326,105 @@ TEST(NetworkContext, HashWithDifferentResults) {
     ASSERT_EQ(ov::ModelCache::compute_hash(net2, {}), ov::ModelCache::compute_hash(net3, {}));
 }
 
+static std::shared_ptr<ov::op::v0::Constant> get_add_constant(const std::shared_ptr<ov::Model>& model) {
+    const auto add = model->get_results().front()->get_input_node_shared_ptr(0);
+    return ov::as_type_ptr<ov::op::v0::Constant>(add->get_input_node_shared_ptr(1));
+}
+
+TEST(NetworkContext, HashWithDifferentWeights) {
+    auto net1 = create_simple_model();
+    auto net2 = create_simple_model();
+    auto constant = get_add_constant(net2);
+    ASSERT_NE(constant, nullptr);
+    auto new_constant = ov::op::v0::Constant::create(constant->get_element_type(), constant->get_shape(), {5});
+    new_constant->set_friendly_name(constant->get_friendly_name());
+    new_constant->get_output_tensor(0).set_names(constant->get_output_tensor(0).get_names());
+    ov::replace_node(constant, new_constant);
+    ASSERT_NE(ov::ModelCache::compute_hash(net1, {}), ov::ModelCache::compute_hash(net2, {}));
+}
+
+static std::shared_ptr<ov::Model> create_model_with_large_weights(size_t size, size_t modified_idx = 0) {
+    std::vector<uint8_t> values(size, 1);
+    values[modified_idx] = 2;
+    auto data = std::make_shared<ov::op::v0::Parameter>(ov::element::u8, ov::Shape{size});
+    auto constant = ov::op::v0::Constant::create(ov::element::u8, ov::Shape{size}, values);
+    auto add = std::make_shared<ov::op::v1::Add>(data, constant);
+    return std::make_shared<ov::Model>(ov::OutputVector{add}, ov::ParameterVector{data});
+}
+
+TEST(NetworkContext, HashOfLargeWeights) {
+    // several hash chunks with an incomplete last one
+    constexpr size_t size = 10 * 1024 * 1024 + 3;
+    const auto hash = ov::ModelCache::compute_hash(create_model_with_large_weights(size), {});
+    ASSERT_EQ(hash, ov::ModelCache::compute_hash(create_model_with_large_weights(size), {}));
+    ASSERT_NE(hash, ov::ModelCache::compute_hash(create_model_with_large_weights(size, size / 2), {}));
+    ASSERT_NE(hash, ov::ModelCache::compute_hash(create_model_with_large_weights(size, size - 1), {}));
+}
+
+TEST(NetworkContext, HashWithWeightsPath) {
+    auto weights_file = ov::test::utils::generateTestFilePrefix() + ".bin";
+    FileGuard guard(weights_file);
+    {
+        std::ofstream os(weights_file);
+        os << "weights";
+    }
+
+    auto net1 = create_simple_model();
+    net1->get_rt_info()["__weights_path"] = weights_file;
+    const auto hash = ov::ModelCache::compute_hash(net1, {});
+    // the stored weights hash is reused for the same model
+    ASSERT_EQ(hash, ov::ModelCache::compute_hash(net1, {}));
+    ASSERT_EQ(hash, ov::ModelCache::compute_hash(create_simple_model(), {}));
+
+    // the same weights file, but the constant is replaced
+    auto net2 = net1->clone();
+    auto constant = get_add_constant(net2);
+    ASSERT_NE(constant, nullptr);
+    ov::replace_node(constant, ov::op::v0::Constant::create(constant->get_element_type(), constant->get_shape(), {5}));
+    ASSERT_NE(hash, ov::ModelCache::compute_hash(net2, {}));
+    ASSERT_EQ(hash, ov::ModelCache::compute_hash(net1, {}));
+}
+
+static std::shared_ptr<ov::Model> create_model_with_mapped_weights(const std::shared_ptr<ov::MappedMemory>& mapped,
+                                                                   const std::string& weights_path,
+                                                                   size_t offset) {
+    auto buffer = std::make_shared<ov::SharedBuffer<std::shared_ptr<ov::MappedMemory>>>(mapped->data() + offset,
+                                                                                        8,
+                                                                                        mapped);
+    auto data = std::make_shared<ov::op::v0::Parameter>(ov::element::u8, ov::Shape{8});
+    auto constant = std::make_shared<ov::op::v0::Constant>(ov::element::u8, ov::Shape{8}, buffer);
+    auto add = std::make_shared<ov::op::v1::Add>(data, constant);
+    auto model = std::make_shared<ov::Model>(ov::OutputVector{add}, ov::ParameterVector{data});
+    model->get_rt_info()["__weights_path"] = weights_path;
+    return model;
+}
+
+TEST(NetworkContext, HashWithMappedWeights) {
+    auto weights_file = ov::test::utils::generateTestFilePrefix() + ".bin";
+    FileGuard guard(weights_file);
+    {
+        std::ofstream os(weights_file, std::ios::binary);
+        os << std::string(16, 'w');
+    }
+
+    std::string hash;
+    {
+        const auto mapped = ov::load_mmap_object(weights_file);
+        hash = ov::ModelCache::compute_hash(create_model_with_mapped_weights(mapped, weights_file, 0), {});
+        ASSERT_EQ(hash, ov::ModelCache::compute_hash(create_model_with_mapped_weights(mapped, weights_file, 0), {}));
+        // the mapped weights are hashed by their location in the file, not by the data
+        ASSERT_NE(hash, ov::ModelCache::compute_hash(create_model_with_mapped_weights(mapped, weights_file, 8), {}));
+    }
+
+    // the weights file is changed
+    {
+        std::ofstream os(weights_file, std::ios::binary);
+        os << std::string(24, 'w');
+    }
+    const auto mapped = ov::load_mmap_object(weights_file);
+    ASSERT_NE(hash, ov::ModelCache::compute_hash(create_model_with_mapped_weights(mapped, weights_file, 0), {}));
+}
+
 // Verify all internal hash calculations are thread-safe (like ov::Model serialization)
 TEST(NetworkContext, HashOfSameMultiThreading) {
     auto net1 = create_simple_model();
@@ -158,6 +158,17 @@ TEST_F(VariableStateTests, InfReqVariableStatePropagatesGetName) {
     EXPECT_STREQ(state.front().get_name().c_str(), "someName");
 }
 
+TEST_F(VariableStateTests, InfReqVariableStatePropagatesOffload) {
+    std::vector<ov::SoPtr<ov::IVariableState>> toReturn;
+    toReturn.push_back(mock_variable_state);
+
+    EXPECT_CALL(*mock_infer_request.get(), query_state()).Times(1).WillRepeatedly(Return(toReturn));
+    EXPECT_CALL(*mock_variable_state.get(), offload(std::string("state.bin"))).Times(1);
+
+    auto state = req.query_state();
+    state.front().offload("state.bin");
+}
+
 TEST_F(VariableStateTests, InfReqVariableStateCanPropagateSetState) {
     std::vector<ov::SoPtr<ov::IVariableState>> toReturn;
     ov::SoPtr<ov::ITensor> saver;
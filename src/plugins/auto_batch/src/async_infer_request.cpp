@@ -82,7 +82,8 @@ AsyncInferRequest::AsyncInferRequest(const std::shared_ptr<SyncInferRequest>& re
                  auto batchReq = this->m_sync_request->m_batched_request_wrapper;
                  if (batchReq->_exception_ptr)  // when the batchN execution failed
                      std::rethrow_exception(batchReq->_exception_ptr);
-                 // in the case of non-batched execution the tensors were set explicitly
+                 // in the case of non-batched execution the tensors were set explicitly,
+                 // the outputs of the partial batches are copied on their completion
                  if (SyncInferRequest::eExecutionFlavor::BATCH_EXECUTED ==
                      this->m_sync_request->m_batched_request_status) {
                      this->m_sync_request->copy_outputs_if_needed();
@@ -112,6 +113,8 @@ std::vector<ov::ProfilingInfo> AsyncInferRequest::get_profiling_info() const {
     check_state();
     if (SyncInferRequest::eExecutionFlavor::BATCH_EXECUTED == m_sync_request->m_batched_request_status)
         return m_sync_request->get_profiling_info();
+    else if (SyncInferRequest::eExecutionFlavor::PARTIAL_BATCH_EXECUTED == m_sync_request->m_batched_request_status)
+        return m_sync_request->m_partial_batch_request->get_profiling_info();
     else
         return m_request_without_batch->get_profiling_info();
 }
@@ -120,6 +123,8 @@ std::vector<ov::SoPtr<ov::IVariableState>> AsyncInferRequest::query_state() cons
     check_state();
     if (SyncInferRequest::eExecutionFlavor::BATCH_EXECUTED == m_sync_request->m_batched_request_status)
         return m_sync_request->query_state();
+    else if (SyncInferRequest::eExecutionFlavor::PARTIAL_BATCH_EXECUTED == m_sync_request->m_batched_request_status)
+        return m_sync_request->m_partial_batch_request->query_state();
     else
         return m_request_without_batch->query_state();
 }
@@ -0,0 +1,85 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include "batch_scheduler.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <utility>
+
+namespace ov {
+namespace autobatch_plugin {
+
+namespace {
+// weight of the latest measurement in the smoothed latency
+constexpr double latency_smoothing = 0.25;
+// a batch size exceeding the latency target is measured again after this number of rejections, so a slow measurement
+// (e.g. while the device was busy with another model) doesn't exclude it forever
+constexpr size_t reprobe_interval = 64;
+}  // namespace
+
+BatchScheduler::BatchScheduler(int max_batch_size, std::vector<int> partial_batch_sizes, uint32_t latency_target)
+    : m_max_batch_size(max_batch_size),
+      m_partial_batch_sizes(std::move(partial_batch_sizes)),
+      m_latency_target(latency_target) {
+    std::sort(m_partial_batch_sizes.begin(), m_partial_batch_sizes.end(), std::greater<int>());
+}
+
+std::vector<int> BatchScheduler::split(int num_requests) {
+    std::vector<int> batches;
+    int remaining = num_requests;
+    // each partial batch size has a single infer request per worker, so it is used at most once per dispatch
+    for (const auto batch_size : m_partial_batch_sizes) {
+        if (batch_size > 1 && batch_size <= remaining && fits(batch_size)) {
+            batches.push_back(batch_size);
+            remaining -= batch_size;
+        }
+    }
+    batches.insert(batches.end(), remaining, 1);
+    return batches;
+}
+
+bool BatchScheduler::fits(int batch_size) {
+    const uint32_t latency_target = m_latency_target;
+    if (!latency_target)
+        return true;
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_latency.find(batch_size);
+    if (it == m_latency.end() || it->second.samples < 2 || it->second.smoothed <= 1000.0 * latency_target)
+        return true;
+    return ++it->second.rejected % reprobe_interval == 0;
+}
+
+std::chrono::milliseconds BatchScheduler::wait_time(uint32_t time_out) const {
+    const auto time_out_ms = std::chrono::milliseconds(time_out);
+    const uint32_t latency_target = m_latency_target;
+    if (!latency_target)
+        return time_out_ms;
+    const auto budget = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::milliseconds(latency_target) - estimate(m_max_batch_size));
+    // never spin, even if the full batch alone exceeds the target
+    return std::max(std::chrono::milliseconds(1), std::min(time_out_ms, budget));
+}
+
+void BatchScheduler::record(int batch_size, std::chrono::microseconds latency) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto& entry = m_latency[batch_size];
+    const auto value = static_cast<double>(latency.count());
+    if (entry.samples == 1)
+        entry.smoothed = value;
+    else if (entry.samples > 1)
+        entry.smoothed += latency_smoothing * (value - entry.smoothed);
+    entry.samples++;
+    entry.rejected = 0;
+}
+
+std::chrono::microseconds BatchScheduler::estimate(int batch_size) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_latency.find(batch_size);
+    return std::chrono::microseconds(it == m_latency.end() ? 0 : static_cast<int64_t>(it->second.smoothed));
+}
+}  // namespace autobatch_plugin
+}  // namespace ov
@@ -0,0 +1,64 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <vector>
+
+#include "plugin.hpp"
+
+namespace ov {
+namespace autobatch_plugin {
+
+// Chooses the batch sizes for the adaptive auto-batching from the number of the collected requests and the measured
+// latency of each batch size. The same scheduler is shared by all the worker requests of the compiled model.
+class BatchScheduler {
+public:
+    BatchScheduler(int max_batch_size, std::vector<int> partial_batch_sizes, uint32_t latency_target);
+
+    // splits the collected requests into the partial batches (largest first), the remaining requests are 1s
+    std::vector<int> split(int num_requests);
+
+    // whether the batch size fits into the latency target (unmeasured batch sizes always fit), a batch size which
+    // doesn't fit is still chosen once in a while to measure it again
+    bool fits(int batch_size);
+
+    // time to collect the requests, so that the full batch still fits into the latency target
+    std::chrono::milliseconds wait_time(uint32_t time_out) const;
+
+    // the first measurement of each batch size includes its warm up and is discarded
+    void record(int batch_size, std::chrono::microseconds latency);
+
+    // smoothed latency of the batch size, zero if not measured yet
+    std::chrono::microseconds estimate(int batch_size) const;
+
+    void set_latency_target(uint32_t latency_target) {
+        m_latency_target = latency_target;
+    }
+
+    uint32_t get_latency_target() const {
+        return m_latency_target;
+    }
+
+private:
+    const int m_max_batch_size;
+    std::vector<int> m_partial_batch_sizes;  // descending
+    std::atomic<uint32_t> m_latency_target;  // in ms
+    struct Latency {
+        size_t samples = 0;
+        double smoothed = 0.0;  // in us
+        size_t rejected = 0;    // rejections since the last measurement
+    };
+
+    mutable std::mutex m_mutex;
+    std::map<int, Latency> m_latency;
+};
+}  // namespace autobatch_plugin
+}  // namespace ov
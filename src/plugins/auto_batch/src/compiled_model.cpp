@@ -17,18 +17,32 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
                              const std::set<std::size_t>& batched_outputs,
                              const ov::SoPtr<ov::ICompiledModel>& compiled_model_with_batch,
                              const ov::SoPtr<ov::ICompiledModel>& compiled_model_without_batch,
-                             const ov::SoPtr<ov::IRemoteContext>& context)
+                             const ov::SoPtr<ov::IRemoteContext>& context,
+                             const std::map<int, ov::SoPtr<ov::ICompiledModel>>& compiled_models_with_partial_batch)
     : ov::ICompiledModel(model, plugin, context),
       m_config(config),
       m_batched_inputs(batched_inputs),
       m_batched_outputs(batched_outputs),
       m_compiled_model_with_batch(compiled_model_with_batch),
-      m_compiled_model_without_batch(compiled_model_without_batch) {
+      m_compiled_model_without_batch(compiled_model_without_batch),
+      m_compiled_models_with_partial_batch(compiled_models_with_partial_batch) {
     // WA for gcc 4.8 ( fails compilation with member init-list)
     m_device_info = device_info;
     auto time_out = config.find(ov::auto_batch_timeout.name());
     OPENVINO_ASSERT(time_out != config.end(), "No timeout property be set in config, default will be used!");
     m_time_out = time_out->second.as<std::uint32_t>();
+
+    auto adaptive = config.find(ov::auto_batch_adaptive.name());
+    if (adaptive != config.end() && adaptive->second.as<bool>()) {
+        auto latency_target = config.find(ov::auto_batch_latency_target.name());
+        std::vector<int> partial_batch_sizes;
+        for (const auto& compiled_model : m_compiled_models_with_partial_batch)
+            partial_batch_sizes.push_back(compiled_model.first);
+        m_scheduler = std::make_shared<BatchScheduler>(
+            static_cast<int>(m_device_info.device_batch_size),
+            std::move(partial_batch_sizes),
+            latency_target != config.end() ? latency_target->second.as<std::uint32_t>() : 0);
+    }
 }
 
 CompiledModel::~CompiledModel() {
@@ -65,10 +79,21 @@ CompiledModel::GetWorkerInferRequest() const {
         workerRequestPtr->_batch_size = m_device_info.device_batch_size;
         workerRequestPtr->_completion_tasks.resize(workerRequestPtr->_batch_size);
         workerRequestPtr->_is_wakeup = false;
+        if (m_scheduler) {
+            for (const auto& compiled_model : m_compiled_models_with_partial_batch) {
+                workerRequestPtr->_infer_requests_partial[compiled_model.first] = {
+                    compiled_model.second->create_infer_request(),
+                    compiled_model.second._so};
+            }
+        }
         workerRequestPtr->_infer_request_batched->set_callback(
-            [workerRequestPtr](std::exception_ptr exceptionPtr) mutable {
+            [workerRequestPtr, this](std::exception_ptr exceptionPtr) mutable {
                 if (exceptionPtr)
                     workerRequestPtr->_exception_ptr = exceptionPtr;
+                if (m_scheduler)
+                    m_scheduler->record(workerRequestPtr->_batch_size,
+                                        std::chrono::duration_cast<std::chrono::microseconds>(
+                                            std::chrono::steady_clock::now() - workerRequestPtr->_start_time));
                 OPENVINO_ASSERT(workerRequestPtr->_completion_tasks.size() == (size_t)workerRequestPtr->_batch_size);
                 // notify the individual requests on the completion
                 for (int c = 0; c < workerRequestPtr->_batch_size; c++) {
@@ -84,7 +109,9 @@ CompiledModel::GetWorkerInferRequest() const {
                 std::cv_status status;
                 {
                     std::unique_lock<std::mutex> lock(workerRequestPtr->_mutex);
-                    status = workerRequestPtr->_cond.wait_for(lock, std::chrono::milliseconds(m_time_out));
+                    const auto wait_time =
+                        m_scheduler ? m_scheduler->wait_time(m_time_out) : std::chrono::milliseconds(m_time_out);
+                    status = workerRequestPtr->_cond.wait_for(lock, wait_time);
                     if ((status != std::cv_status::timeout) && (workerRequestPtr->_is_wakeup == false))
                         continue;
                     workerRequestPtr->_is_wakeup = false;
@@ -95,7 +122,10 @@ CompiledModel::GetWorkerInferRequest() const {
                     // as we pop the tasks from the queue only here
                     // it is ok to call size() (as the _tasks can only grow in parallel)
                     const int sz = static_cast<int>(workerRequestPtr->_tasks.size());
-                    if (sz == workerRequestPtr->_batch_size) {
+                    // in the adaptive mode the full batch is split as well, if it does not fit into the latency target
+                    const bool full_batch =
+                        (sz == workerRequestPtr->_batch_size) && (!m_scheduler || m_scheduler->fits(sz));
+                    if (full_batch) {
                         std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task> t;
                         for (int n = 0; n < sz; n++) {
                             OPENVINO_ASSERT(workerRequestPtr->_tasks.try_pop(t));
@@ -104,31 +134,13 @@ CompiledModel::GetWorkerInferRequest() const {
                             t.first->m_sync_request->m_batched_request_status =
                                 ov::autobatch_plugin::SyncInferRequest::eExecutionFlavor::BATCH_EXECUTED;
                         }
+                        workerRequestPtr->_start_time = std::chrono::steady_clock::now();
                         workerRequestPtr->_infer_request_batched->start_async();
-                    } else if ((status == std::cv_status::timeout) && sz) {
-                        // timeout to collect the batch is over, have to execute the requests in the batch1 mode
-                        std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task> t;
-                        // popping all tasks collected by the moment of the time-out and execute each with batch1
-                        std::atomic<int> arrived = {0};
-                        std::promise<void> all_completed;
-                        auto all_completed_future = all_completed.get_future();
-                        for (int n = 0; n < sz; n++) {
-                            OPENVINO_ASSERT(workerRequestPtr->_tasks.try_pop(t));
-                            t.first->m_request_without_batch->set_callback(
-                                [t, sz, &arrived, &all_completed](std::exception_ptr p) {
-                                    if (p)
-                                        t.first->m_sync_request->m_exception_ptr = p;
-                                    t.second();
-                                    if (sz == ++arrived) {
-                                        all_completed.set_value();
-                                    }
-                                });
-                            t.first->m_sync_request->m_batched_request_status =
-                                ov::autobatch_plugin::SyncInferRequest::eExecutionFlavor::TIMEOUT_EXECUTED;
-                            t.first->m_sync_request->set_tensors_to_another_request(t.first->m_request_without_batch);
-                            t.first->m_request_without_batch->start_async();
-                        }
-                        all_completed_future.get();
+                    } else if ((status == std::cv_status::timeout || sz == workerRequestPtr->_batch_size) && sz) {
+                        // timeout to collect the batch is over, have to execute the requests collected by the moment
+                        // either with the smaller batches (adaptive mode) or in the batch1 mode
+                        const auto batches = m_scheduler ? m_scheduler->split(sz) : std::vector<int>(sz, 1);
+                        execute_partial_batches(*workerRequestPtr, batches);
                         // now when all the tasks for this batch are completed, start waiting for the timeout again
                     }
                 }
@@ -138,6 +150,71 @@ CompiledModel::GetWorkerInferRequest() const {
     return {m_worker_requests.back(), static_cast<int>(batch_id)};
 }
 
+void CompiledModel::execute_partial_batches(WorkerInferRequest& worker_request, const std::vector<int>& batches) const {
+    const int num_batches = static_cast<int>(batches.size());
+    std::atomic<int> arrived = {0};
+    std::promise<void> all_completed;
+    auto all_completed_future = all_completed.get_future();
+    auto on_batch_completed = [num_batches, &arrived, &all_completed]() {
+        if (num_batches == ++arrived) {
+            all_completed.set_value();
+        }
+    };
+    // only the execution is timed, the inputs are copied and the requests are queued before the start
+    auto record_latency = [this](int batch_size, std::chrono::steady_clock::time_point start_time) {
+        if (m_scheduler)
+            m_scheduler->record(batch_size,
+                                std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() -
+                                                                                      start_time));
+    };
+    for (const int batch_size : batches) {
+        if (batch_size == 1) {
+            std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task> t;
+            OPENVINO_ASSERT(worker_request._tasks.try_pop(t));
+            t.first->m_sync_request->m_batched_request_status =
+                ov::autobatch_plugin::SyncInferRequest::eExecutionFlavor::TIMEOUT_EXECUTED;
+            t.first->m_sync_request->set_tensors_to_another_request(t.first->m_request_without_batch);
+            const auto start_time = std::chrono::steady_clock::now();
+            t.first->m_request_without_batch->set_callback(
+                [t, start_time, &on_batch_completed, &record_latency](std::exception_ptr p) {
+                    if (p)
+                        t.first->m_sync_request->m_exception_ptr = p;
+                    record_latency(1, start_time);
+                    t.second();
+                    on_batch_completed();
+                });
+            t.first->m_request_without_batch->start_async();
+        } else {
+            auto& request = worker_request._infer_requests_partial.at(batch_size);
+            std::vector<std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task>> tasks(batch_size);
+            for (int n = 0; n < batch_size; n++) {
+                OPENVINO_ASSERT(worker_request._tasks.try_pop(tasks[n]));
+                auto& sync_request = tasks[n].first->m_sync_request;
+                sync_request->copy_inputs_to(request, n, batch_size);
+                sync_request->m_partial_batch_request = request;
+                sync_request->m_batched_request_status =
+                    ov::autobatch_plugin::SyncInferRequest::eExecutionFlavor::PARTIAL_BATCH_EXECUTED;
+            }
+            const auto start_time = std::chrono::steady_clock::now();
+            request->set_callback(
+                [tasks, &request, batch_size, start_time, &on_batch_completed, &record_latency](std::exception_ptr p) {
+                    record_latency(batch_size, start_time);
+                    for (int n = 0; n < batch_size; n++) {
+                        auto& sync_request = tasks[n].first->m_sync_request;
+                        if (p)
+                            sync_request->m_exception_ptr = p;
+                        else
+                            sync_request->copy_outputs_from(request, n, batch_size);
+                        tasks[n].second();
+                    }
+                    on_batch_completed();
+                });
+            request->start_async();
+        }
+    }
+    all_completed_future.get();
+}
+
 std::shared_ptr<ov::IAsyncInferRequest> CompiledModel::create_infer_request() const {
     ov::SoPtr<ov::IAsyncInferRequest> infer_request_without_batch = {
         m_compiled_model_without_batch->create_infer_request(),
@@ -170,11 +247,18 @@ void CompiledModel::set_property(const ov::AnyMap& properties) {
         if (property.first == ov::auto_batch_timeout.name()) {
             m_time_out = property.second.as<std::uint32_t>();
             m_config[ov::auto_batch_timeout.name()] = property.second.as<std::uint32_t>();
+        } else if (property.first == ov::auto_batch_latency_target.name()) {
+            const auto latency_target = property.second.as<std::uint32_t>();
+            if (m_scheduler)
+                m_scheduler->set_latency_target(latency_target);
+            m_config[ov::auto_batch_latency_target.name()] = latency_target;
         } else {
             OPENVINO_THROW("AutoBatching Compiled Model dosen't support property",
                            property.first,
-                           ". The only property that can be changed on the fly is the ",
-                           ov::auto_batch_timeout.name());
+                           ". The only properties that can be changed on the fly are the ",
+                           ov::auto_batch_timeout.name(),
+                           " and ",
+                           ov::auto_batch_latency_target.name());
         }
     }
 }
@@ -212,7 +296,9 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
                 ov::PropertyName{ov::optimal_number_of_infer_requests.name(), ov::PropertyMutability::RO},
                 ov::PropertyName{ov::model_name.name(), ov::PropertyMutability::RO},
                 ov::PropertyName{ov::execution_devices.name(), ov::PropertyMutability::RO},
-                ov::PropertyName{ov::auto_batch_timeout.name(), ov::PropertyMutability::RW}};
+                ov::PropertyName{ov::auto_batch_timeout.name(), ov::PropertyMutability::RW},
+                ov::PropertyName{ov::auto_batch_adaptive.name(), ov::PropertyMutability::RO},
+                ov::PropertyName{ov::auto_batch_latency_target.name(), ov::PropertyMutability::RW}};
         } else if (name == ov::auto_batch_timeout) {
             uint32_t time_out = m_time_out;
             return time_out;
@@ -5,9 +5,13 @@
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 #pragma once
 
+#include <chrono>
 #include <condition_variable>
+#include <map>
+#include <memory>
 #include <thread>
 
+#include "batch_scheduler.hpp"
 #include "openvino/runtime/iasync_infer_request.hpp"
 #include "openvino/runtime/icompiled_model.hpp"
 #include "openvino/runtime/threading/thread_safe_containers.hpp"
@@ -23,6 +27,9 @@ public:
     struct WorkerInferRequest {
         ov::SoPtr<ov::IAsyncInferRequest> _infer_request_batched;
         int _batch_size;
+        // requests of the smaller batch sizes for the adaptive batching, by the batch size
+        std::map<int, ov::SoPtr<ov::IAsyncInferRequest>> _infer_requests_partial;
+        std::chrono::steady_clock::time_point _start_time;
         ov::threading::ThreadSafeQueueWithSize<std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task>>
             _tasks;
         std::vector<ov::threading::Task> _completion_tasks;
@@ -41,7 +48,8 @@ public:
                   const std::set<std::size_t>& batched_outputs,
                   const ov::SoPtr<ov::ICompiledModel>& compiled_model_with_batch,
                   const ov::SoPtr<ov::ICompiledModel>& compiled_model_without_batch,
-                  const ov::SoPtr<ov::IRemoteContext>& context);
+                  const ov::SoPtr<ov::IRemoteContext>& context,
+                  const std::map<int, ov::SoPtr<ov::ICompiledModel>>& compiled_models_with_partial_batch = {});
 
     void set_property(const ov::AnyMap& properties) override;
 
@@ -68,6 +76,8 @@ protected:
 
     std::pair<std::shared_ptr<ov::autobatch_plugin::CompiledModel::WorkerInferRequest>, int> GetWorkerInferRequest()
         const;
+    // executes the collected requests in the partial batches, the batches of 1 run on the requests without batch
+    void execute_partial_batches(WorkerInferRequest& worker_request, const std::vector<int>& batches) const;
     mutable std::vector<std::shared_ptr<WorkerInferRequest>> m_worker_requests;
     mutable std::mutex m_worker_requests_mutex;
 
@@ -79,6 +89,10 @@ protected:
 
     ov::SoPtr<ov::ICompiledModel> m_compiled_model_with_batch;
     ov::SoPtr<ov::ICompiledModel> m_compiled_model_without_batch;
+    const std::map<int, ov::SoPtr<ov::ICompiledModel>> m_compiled_models_with_partial_batch;
+
+    // set only in the adaptive mode
+    std::shared_ptr<BatchScheduler> m_scheduler;
 };
 }  // namespace autobatch_plugin
 }  // namespace ov
@@ -22,6 +22,8 @@ namespace autobatch_plugin {
 std::vector<ov::PropertyName> supported_configKeys = {
     ov::PropertyName{ov::device::priorities.name(), ov::PropertyMutability::RW},
     ov::PropertyName{ov::auto_batch_timeout.name(), ov::PropertyMutability::RW},
+    ov::PropertyName{ov::auto_batch_adaptive.name(), ov::PropertyMutability::RW},
+    ov::PropertyName{ov::auto_batch_latency_target.name(), ov::PropertyMutability::RW},
     ov::PropertyName{ov::enable_profiling.name(), ov::PropertyMutability::RW}};
 
 inline ov::AnyMap merge_properties(ov::AnyMap config, const ov::AnyMap& user_config) {
@@ -118,6 +120,8 @@ OV_DEFINE_PLUGIN_CREATE_FUNCTION(Plugin, version)
 Plugin::Plugin() {
     set_device_name("BATCH");
     m_plugin_config.insert(ov::auto_batch_timeout(1000));  // default value (ms)
+    m_plugin_config.insert(ov::auto_batch_adaptive(false));
+    m_plugin_config.insert(ov::auto_batch_latency_target(0));  // no target
     m_plugin_config.insert(ov::enable_profiling(false));
 }
 
@@ -268,29 +272,44 @@ std::shared_ptr<ov::ICompiledModel> Plugin::compile_model(const std::shared_ptr<
         if (supported_configKeys.end() != std::find(supported_configKeys.begin(), supported_configKeys.end(), c.first))
             compiled_model_config.insert(c);
     }
+    auto compile_model_with_batch = [&](uint32_t batch_size) -> ov::SoPtr<ov::ICompiledModel> {
+        auto reshaped = model->clone();
+        auto inputs = reshaped->inputs();
+        std::map<std::size_t, ov::PartialShape> partial_shapes;
+        for (size_t input_id = 0; input_id < inputs.size(); input_id++) {
+            auto input_shape = inputs[input_id].get_shape();
+            if (batched_inputs.find(input_id) != batched_inputs.end()) {
+                input_shape[0] = batch_size;
+            }
+            partial_shapes.insert({input_id, ov::PartialShape(input_shape)});
+        }
+
+        reshaped->reshape(partial_shapes);
+        return context ? core->compile_model(reshaped, context, device_config_no_auto_batch)
+                       : core->compile_model(reshaped, device_name, device_config_no_auto_batch);
+    };
     ov::SoPtr<ov::ICompiledModel> compiled_model_with_batch;
-    auto reshaped = model->clone();
     if (meta_device.device_batch_size > 1 && batched_inputs.size()) {
         try {
-            auto inputs = reshaped->inputs();
-            std::map<std::size_t, ov::PartialShape> partial_shapes;
-            for (size_t input_id = 0; input_id < inputs.size(); input_id++) {
-                auto input_shape = inputs[input_id].get_shape();
-                if (batched_inputs.find(input_id) != batched_inputs.end()) {
-                    input_shape[0] = meta_device.device_batch_size;
-                }
-                partial_shapes.insert({input_id, ov::PartialShape(input_shape)});
-            }
-
-            reshaped->reshape(partial_shapes);
-            compiled_model_with_batch = context
-                                            ? core->compile_model(reshaped, context, device_config_no_auto_batch)
-                                            : core->compile_model(reshaped, device_name, device_config_no_auto_batch);
+            compiled_model_with_batch = compile_model_with_batch(meta_device.device_batch_size);
         } catch (const ov::Exception&) {
             meta_device.device_batch_size = 1;
         }
     }
 
+    // the adaptive mode executes the partial batches with the smaller batch sizes (powers of 2)
+    std::map<int, ov::SoPtr<ov::ICompiledModel>> compiled_models_with_partial_batch;
+    const auto adaptive = full_properties.find(ov::auto_batch_adaptive.name());
+    if (compiled_model_with_batch && adaptive != full_properties.end() && adaptive->second.as<bool>()) {
+        for (uint32_t batch_size = 2; batch_size < meta_device.device_batch_size; batch_size *= 2) {
+            try {
+                compiled_models_with_partial_batch[batch_size] = compile_model_with_batch(batch_size);
+            } catch (const ov::Exception&) {
+                // such requests are executed with the smaller batches then
+            }
+        }
+    }
+
     ov::SoPtr<ov::IRemoteContext> device_context;
     if (!context) {
         try {
@@ -311,7 +330,8 @@ std::shared_ptr<ov::ICompiledModel> Plugin::compile_model(const std::shared_ptr<
                                            batched_outputs,
                                            compiled_model_with_batch,
                                            compiled_model_without_batch,
-                                           device_context);
+                                           device_context,
+                                           compiled_models_with_partial_batch);
 }
 
 ov::SupportedOpsMap Plugin::query_model(const std::shared_ptr<const ov::Model>& model,
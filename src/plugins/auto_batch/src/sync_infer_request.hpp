@@ -27,6 +27,12 @@ public:
 
     void copy_outputs_if_needed();
 
+    // copies the inputs to the batch_id slot of the request compiled with the (partial) batch_size
+    void copy_inputs_to(ov::SoPtr<ov::IAsyncInferRequest>& req, size_t batch_id, size_t batch_size);
+
+    // copies the outputs from the batch_id slot of the request compiled with the (partial) batch_size
+    void copy_outputs_from(ov::SoPtr<ov::IAsyncInferRequest>& req, size_t batch_id, size_t batch_size);
+
     void infer() override;
 
     std::vector<ov::SoPtr<ov::IVariableState>> query_state() const override;
@@ -40,14 +46,24 @@ public:
     enum eExecutionFlavor : uint8_t {
         NOT_EXECUTED,
         BATCH_EXECUTED,
-        TIMEOUT_EXECUTED
+        TIMEOUT_EXECUTED,
+        PARTIAL_BATCH_EXECUTED
     } m_batched_request_status = eExecutionFlavor::NOT_EXECUTED;
 
+    // the request of the smaller batch size used for the last PARTIAL_BATCH_EXECUTED inference
+    ov::SoPtr<ov::IAsyncInferRequest> m_partial_batch_request;
+
     size_t get_batch_size() const;
 
 protected:
     void copy_tensor_if_needed(const ov::SoPtr<ov::ITensor>& src, ov::SoPtr<ov::ITensor>& dst, const bool bInput);
 
+    void copy_tensor_if_needed(const ov::SoPtr<ov::ITensor>& src,
+                               ov::SoPtr<ov::ITensor>& dst,
+                               const bool bInput,
+                               size_t batch_id,
+                               size_t batch_size);
+
     void share_tensors_with_batched_req(const std::set<std::size_t>& batched_inputs,
                                         const std::set<std::size_t>& batched_outputs);
 
@@ -0,0 +1,80 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "batch_scheduler.hpp"
+#include "mock_common.hpp"
+
+using namespace std::chrono;
+
+TEST(BatchSchedulerTest, SplitWithoutLatencyTarget) {
+    BatchScheduler scheduler(16, {2, 4, 8}, 0);
+    EXPECT_EQ(scheduler.split(15), (std::vector<int>{8, 4, 2, 1}));
+    EXPECT_EQ(scheduler.split(6), (std::vector<int>{4, 2}));
+    EXPECT_EQ(scheduler.split(1), (std::vector<int>{1}));
+    EXPECT_EQ(scheduler.wait_time(200), milliseconds(200));
+}
+
+TEST(BatchSchedulerTest, SplitByMeasuredLatency) {
+    BatchScheduler scheduler(16, {2, 4, 8}, 10);
+    for (int i = 0; i < 2; i++) {
+        scheduler.record(8, milliseconds(12));
+        scheduler.record(4, milliseconds(6));
+    }
+    EXPECT_FALSE(scheduler.fits(8));
+    EXPECT_TRUE(scheduler.fits(4));
+    // the batch of 8 exceeds the target, so the requests go to the smaller batches
+    EXPECT_EQ(scheduler.split(9), (std::vector<int>{4, 2, 1, 1, 1}));
+
+    scheduler.set_latency_target(0);
+    EXPECT_EQ(scheduler.split(9), (std::vector<int>{8, 1}));
+}
+
+TEST(BatchSchedulerTest, WaitTimeFitsLatencyTarget) {
+    BatchScheduler scheduler(8, {2, 4}, 20);
+    // nothing is measured yet
+    EXPECT_EQ(scheduler.wait_time(100), milliseconds(20));
+
+    scheduler.record(8, milliseconds(15));
+    scheduler.record(8, milliseconds(15));
+    EXPECT_EQ(scheduler.estimate(8), milliseconds(15));
+    EXPECT_EQ(scheduler.wait_time(100), milliseconds(5));
+    EXPECT_EQ(scheduler.wait_time(2), milliseconds(2));
+
+    // the full batch alone exceeds the target
+    scheduler.record(8, milliseconds(75));
+    EXPECT_EQ(scheduler.estimate(8), milliseconds(30));
+    EXPECT_EQ(scheduler.wait_time(100), milliseconds(1));
+}
+
+TEST(BatchSchedulerTest, FirstMeasurementIsDiscarded) {
+    BatchScheduler scheduler(8, {2, 4}, 10);
+    // the first execution includes the warm up
+    scheduler.record(8, milliseconds(500));
+    EXPECT_EQ(scheduler.estimate(8), milliseconds(0));
+    EXPECT_TRUE(scheduler.fits(8));
+
+    scheduler.record(8, milliseconds(8));
+    EXPECT_EQ(scheduler.estimate(8), milliseconds(8));
+    EXPECT_TRUE(scheduler.fits(8));
+}
+
+TEST(BatchSchedulerTest, RejectedBatchSizeIsProbedAgain) {
+    BatchScheduler scheduler(8, {2, 4}, 10);
+    scheduler.record(8, milliseconds(40));
+    scheduler.record(8, milliseconds(40));
+
+    int probes = 0;
+    for (int i = 0; i < 1000; i++) {
+        probes += scheduler.fits(8) ? 1 : 0;
+    }
+    // the batch size is mostly rejected, but is still measured from time to time
+    EXPECT_GT(probes, 0);
+    EXPECT_LT(probes, 100);
+
+    // the new measurements bring the estimate back under the target
+    while (scheduler.estimate(8) > milliseconds(10)) {
+        scheduler.record(8, milliseconds(5));
+    }
+    EXPECT_TRUE(scheduler.fits(8));
+}
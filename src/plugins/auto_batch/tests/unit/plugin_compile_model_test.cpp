@@ -2,6 +2,8 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <set>
+
 #include "common_test_utils/subgraph_builders/conv_pool_relu_non_zero.hpp"
 #include "common_test_utils/subgraph_builders/multi_single_conv.hpp"
 #include "mock_common.hpp"
@@ -100,7 +102,25 @@ public:
 
 TEST_P(PluginCompileModelTest, PluginCompileModelTestCase) {
     m_model = ov::test::utils::make_multi_single_conv();
+    std::set<int64_t> compiled_batch_sizes;
+    ON_CALL(*m_core,
+            compile_model(MatcherCast<const std::shared_ptr<const ov::Model>&>(_),
+                          MatcherCast<const std::string&>(_),
+                          _))
+        .WillByDefault([&](const std::shared_ptr<const ov::Model>& model, const std::string&, const ov::AnyMap&) {
+            compiled_batch_sizes.insert(model->input(0).get_partial_shape()[0].get_length());
+            return m_mock_compile_model;
+        });
     OV_ASSERT_NO_THROW(m_plugin->compile_model(m_model, m_plugin_properities));
+
+    // the adaptive mode executes the collected requests with the smaller batches as well
+    const auto adaptive = m_plugin_properities.find(ov::auto_batch_adaptive.name());
+    if (adaptive != m_plugin_properities.end() && adaptive->second.as<bool>()) {
+        EXPECT_EQ(compiled_batch_sizes.count(m_batch_size), 1);
+        for (int batch_size = 2; batch_size < m_batch_size; batch_size *= 2) {
+            EXPECT_EQ(compiled_batch_sizes.count(batch_size), 1) << "batch size " << batch_size << " isn't compiled";
+        }
+    }
 }
 
 TEST_P(PluginCompileModelTest, PluginCompileModelWithRemoteContextTestCase) {
@@ -205,6 +225,17 @@ const std::vector<plugin_compile_model_param> plugin_compile_model_param_test =
                                 {ov::intel_gpu::device_total_mem_size.name(), static_cast<uint64_t>(4096000000)}},
                                {{ov::auto_batch_timeout(static_cast<uint32_t>(200))}, {ov::device::priorities("CPU(32)")}},
                                32},
+    // Case 5: adaptive batching compiles the partial batch sizes as well
+    plugin_compile_model_param{{{ov::hint::performance_mode.name(), ov::hint::PerformanceMode::THROUGHPUT},
+                                {ov::optimal_batch_size.name(), static_cast<unsigned int>(16)},
+                                {ov::hint::num_requests(12)},
+                                {ov::intel_gpu::memory_statistics.name(), static_cast<uint64_t>(1024000)},
+                                {ov::intel_gpu::device_total_mem_size.name(), static_cast<uint64_t>(4096000000)}},
+                               {{ov::auto_batch_timeout(static_cast<uint32_t>(200))},
+                                {ov::auto_batch_adaptive(true)},
+                                {ov::auto_batch_latency_target(static_cast<uint32_t>(50))},
+                                {ov::device::priorities("CPU(8)")}},
+                               8},
 };
 
 INSTANTIATE_TEST_SUITE_P(smoke_AutoBatch_BehaviorTests,
@@ -21,13 +21,38 @@ struct RequestExecutor : ov::threading::ITaskExecutor {
     ov::threading::Task m_task;
 };
 
+// Runs the micro-batches of the request through the submodels, the pipeline continues when all of them are done
+struct MicroBatchExecutor : ov::threading::ITaskExecutor {
+    explicit MicroBatchExecutor(const std::shared_ptr<ov::hetero::InferRequest>& request) : m_request(request) {}
+    void run(ov::threading::Task task) override {
+        m_task = std::move(task);
+        m_request->start_micro_batches([this](std::exception_ptr exception_ptr) {
+            m_exception_ptr = std::move(exception_ptr);
+            auto task = std::move(m_task);
+            task();
+        });
+    };
+    std::shared_ptr<ov::hetero::InferRequest> m_request;
+    std::exception_ptr m_exception_ptr;
+    ov::threading::Task m_task;
+};
+
 ov::hetero::AsyncInferRequest::AsyncInferRequest(const std::shared_ptr<ov::hetero::InferRequest>& request,
                                                  const std::shared_ptr<ov::threading::ITaskExecutor>& task_executor,
                                                  const std::shared_ptr<ov::threading::ITaskExecutor>& callback_executor)
     : ov::IAsyncInferRequest(request, task_executor, callback_executor),
       m_infer_request(std::static_pointer_cast<ov::hetero::InferRequest>(request)) {
     m_pipeline.clear();
-    for (auto&& request : m_infer_request->m_subrequests) {
+    if (m_infer_request->has_micro_batches()) {
+        auto micro_batch_executor = std::make_shared<MicroBatchExecutor>(m_infer_request);
+        m_pipeline.emplace_back(micro_batch_executor, [micro_batch_executor] {
+            if (nullptr != micro_batch_executor->m_exception_ptr) {
+                std::rethrow_exception(micro_batch_executor->m_exception_ptr);
+            }
+        });
+        return;
+    }
+    for (auto&& request : m_infer_request->m_subrequests.front()) {
         auto request_executor = std::make_shared<RequestExecutor>(request);
         m_pipeline.emplace_back(request_executor, [request_executor] {
             if (nullptr != request_executor->m_exception_ptr) {
@@ -43,7 +68,9 @@ ov::hetero::AsyncInferRequest::~AsyncInferRequest() {
 
 void ov::hetero::AsyncInferRequest::cancel() {
     ov::IAsyncInferRequest::cancel();
-    for (auto&& request : m_infer_request->m_subrequests) {
-        request->cancel();
+    for (auto&& subrequests : m_infer_request->m_subrequests) {
+        for (auto&& request : subrequests) {
+            request->cancel();
+        }
     }
 }
\ No newline at end of file
@@ -10,6 +10,8 @@
 #include "graph_debug_dump.hpp"
 #include "itt.hpp"
 #include "op/device_subgraph.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/result.hpp"
 #include "openvino/op/util/op_types.hpp"
 #include "openvino/pass/constant_folding.hpp"
 #include "openvino/pass/manager.hpp"
@@ -48,7 +50,7 @@ void ov::hetero::CompiledModel::compile_model(const std::vector<ov::hetero::Subm
     m_compiled_submodels.clear();
     m_compiled_submodels.reserve(submodels.size());
 
-    for (const auto& [device, sub_model] : submodels) {
+    for (const auto& [device, sub_model, numa_node] : submodels) {
         // get meta devices properties for the target device
         auto meta_devices = hetero_plugin->get_properties_per_device(device, device_properties);
 
@@ -56,8 +58,9 @@ void ov::hetero::CompiledModel::compile_model(const std::vector<ov::hetero::Subm
         auto device_config = meta_devices.at(device);
         device_config[ov::cache_dir.name()] = "";
 
-        // set exclusive_async_requests in case when model is split
-        if (add_exclusive) {
+        // set exclusive_async_requests in case when model is split, except the pipeline stages on the same device,
+        // which must run concurrently
+        if (add_exclusive && !m_cfg.pipeline_partitioning()) {
             auto supported_internal_properties = core->get_property(device, ov::internal::supported_properties);
             if (std::find(supported_internal_properties.begin(),
                           supported_internal_properties.end(),
@@ -67,16 +70,33 @@ void ov::hetero::CompiledModel::compile_model(const std::vector<ov::hetero::Subm
             }
         }
 
+        for (const auto& [key, value] : get_pipeline_stage_config(device, numa_node)) {
+            device_config[key] = value;
+        }
+
         // compile the submodel and add to the compiled submodels list
         CompiledModelDesc desc;
         desc.device = device;
         desc.model = sub_model;
         desc.compiled_model = core->compile_model(sub_model, device, device_config);
+        desc.numa_node = numa_node;
         m_compiled_submodels.emplace_back(std::move(desc));
     }
     set_inputs_and_outputs();
 }
 
+ov::AnyMap ov::hetero::CompiledModel::get_pipeline_stage_config(const std::string& device, int numa_node) const {
+    if (numa_node < 0) {
+        return {};
+    }
+    const auto& core = get_hetero_plugin()->get_core();
+    auto supported_internal_properties = core->get_property(device, ov::internal::supported_properties);
+    if (!ov::util::contains(supported_internal_properties, ov::internal::numa_node_id)) {
+        return {};
+    }
+    return {ov::internal::numa_node_id(numa_node)};
+}
+
 ov::hetero::CompiledModel::CompiledModel(std::istream& model,
                                          const std::shared_ptr<const ov::IPlugin>& plugin,
                                          const Configuration& cfg,
@@ -111,10 +131,14 @@ ov::hetero::CompiledModel::CompiledModel(std::istream& model,
     pugi::xml_node subnetworksNode = heteroNode.child("compiled_submodels");
     FOREACH_CHILD(subnetworkNode, subnetworksNode, "compiled_submodel") {
         auto device = get_str_attr(subnetworkNode, "device");
+        const auto numa_node = get_int_attr(subnetworkNode, "numa_node", -1);
 
         auto meta_devices = get_hetero_plugin()->get_properties_per_device(device, m_cfg.get_device_properties());
         assert(meta_devices.size() == 1);
         auto& loadConfig = meta_devices[device];
+        for (const auto& [key, value] : get_pipeline_stage_config(device, numa_node)) {
+            loadConfig[key] = value;
+        }
 
         ov::SoPtr<ov::ICompiledModel> compiled_model;
         std::shared_ptr<ov::Model> ov_model;
@@ -145,6 +169,7 @@ ov::hetero::CompiledModel::CompiledModel(std::istream& model,
             device,
             ov_model,
             compiled_model,
+            numa_node,
         });
     }
 
@@ -236,6 +261,7 @@ ov::Any ov::hetero::CompiledModel::get_property(const std::string& name) const {
         add_ro_properties(ov::supported_properties.name(), supported_properties);
         add_ro_properties(ov::device::properties.name(), supported_properties);
         add_ro_properties(ov::device::priorities.name(), supported_properties);
+        add_ro_properties(ov::hetero::micro_batches.name(), supported_properties);
         return decltype(ov::supported_properties)::value_type(std::move(supported_properties));
     } else if (ov::device::properties == name) {
         ov::AnyMap all_devices = {};
@@ -317,6 +343,31 @@ void ov::hetero::CompiledModel::set_inputs_and_outputs() {
                             " outputs. Index is out of range: " + std::to_string(output_idx));
         m_compiled_outputs.emplace_back(compiled_submodel->outputs()[output_idx]);
     }
+    if (m_cfg.micro_batches > 1) {
+        set_batch_inputs_and_outputs();
+    }
+}
+
+void ov::hetero::CompiledModel::set_batch_inputs_and_outputs() {
+    const auto batch_shape = [&](const ov::Output<const ov::Node>& port) {
+        auto shape = port.get_partial_shape();
+        OPENVINO_ASSERT(shape.is_static() && shape.size() > 0, "Unexpected shape of the micro-batch ", shape);
+        shape[0] = shape[0].get_length() * m_cfg.micro_batches;
+        return shape;
+    };
+    for (auto& input : m_compiled_inputs) {
+        auto parameter = std::make_shared<ov::op::v0::Parameter>(input.get_element_type(), batch_shape(input));
+        parameter->set_friendly_name(input.get_node()->get_friendly_name());
+        parameter->output(0).set_names(input.get_names());
+        input = parameter->output(0);
+    }
+    for (auto& output : m_compiled_outputs) {
+        auto parameter = std::make_shared<ov::op::v0::Parameter>(output.get_element_type(), batch_shape(output));
+        parameter->output(0).set_names(output.get_names());
+        auto result = std::make_shared<ov::op::v0::Result>(parameter);
+        result->set_friendly_name(output.get_node()->get_friendly_name());
+        output = result->output(0);
+    }
 }
 
 void ov::hetero::CompiledModel::export_model(std::ostream& model_stream) const {
@@ -352,6 +403,9 @@ void ov::hetero::CompiledModel::export_model(std::ostream& model_stream) const {
     for (const auto& comp_model_desc : m_compiled_submodels) {
         auto subnetworkNode = subnetworksNode.append_child("compiled_submodel");
         subnetworkNode.append_attribute("device").set_value(comp_model_desc.device.c_str());
+        if (comp_model_desc.numa_node >= 0) {
+            subnetworkNode.append_attribute("numa_node").set_value(comp_model_desc.numa_node);
+        }
     }
 
     auto heteroConfigsNode = heteroNode.append_child("hetero_config");
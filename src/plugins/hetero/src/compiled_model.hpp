@@ -56,6 +56,11 @@ private:
 
     void set_inputs_and_outputs();
 
+    // the ports of the whole batch, the submodels process a micro-batch
+    void set_batch_inputs_and_outputs();
+
+    ov::AnyMap get_pipeline_stage_config(const std::string& device, int numa_node) const;
+
     Configuration m_cfg;
     std::string m_name;
     const bool m_loaded_from_cache;
@@ -67,6 +72,7 @@ private:
         std::string device;
         std::shared_ptr<ov::Model> model;
         ov::SoPtr<ov::ICompiledModel> compiled_model;
+        int numa_node = -1;
     };
     std::vector<CompiledModelDesc> m_compiled_submodels;
 };
@@ -4,6 +4,9 @@
 
 #include "config.hpp"
 
+#include <algorithm>
+
+#include "openvino/runtime/device_id_parser.hpp"
 #include "openvino/runtime/internal_properties.hpp"
 #include "openvino/runtime/properties.hpp"
 #include "properties.hpp"
@@ -33,6 +36,14 @@ Configuration::Configuration(const ov::AnyMap& config, const Configuration& defa
                 }
             }
             modelDistributionPolicy = value.as<std::set<ov::hint::ModelDistributionPolicy>>();
+        } else if (ov::hetero::micro_batches == key) {
+            micro_batches = value.as<uint32_t>();
+            OPENVINO_ASSERT(micro_batches > 0,
+                            "Wrong value ",
+                            micro_batches,
+                            " for property key ",
+                            ov::hetero::micro_batches.name(),
+                            ". Expected positive number");
         } else if (ov::cache_encryption_callbacks == key) {
             encryption_callbacks = value.as<EncryptionCallbacks>();
         } else {
@@ -48,19 +59,22 @@ ov::Any Configuration::get(const std::string& name) const {
         return {device_priorities};
     } else if (name == ov::hint::model_distribution_policy) {
         return {modelDistributionPolicy};
+    } else if (name == ov::hetero::micro_batches) {
+        return {micro_batches};
     } else {
         OPENVINO_THROW("Property was not found: ", name);
     }
 }
 
 std::vector<ov::PropertyName> Configuration::get_supported() const {
-    static const std::vector<ov::PropertyName> names = {ov::device::priorities};
+    static const std::vector<ov::PropertyName> names = {ov::device::priorities, ov::hetero::micro_batches};
     return names;
 }
 
 ov::AnyMap Configuration::get_hetero_properties() const {
     return {{ov::device::priorities.name(), device_priorities},
-            {ov::hint::model_distribution_policy.name(), modelDistributionPolicy}};
+            {ov::hint::model_distribution_policy.name(), modelDistributionPolicy},
+            {ov::hetero::micro_batches.name(), micro_batches}};
 }
 
 ov::AnyMap Configuration::get_device_properties() const {
@@ -69,4 +83,12 @@ ov::AnyMap Configuration::get_device_properties() const {
 
 bool Configuration::dump_dot_files() const {
     return std::getenv("OPENVINO_HETERO_VISUALIZE") != NULL;
+}
+
+bool Configuration::pipeline_partitioning() const {
+    const auto device_names = ov::DeviceIDParser::get_hetero_devices(device_priorities);
+    return device_names.size() > 1 &&
+           std::all_of(device_names.begin(), device_names.end(), [&](const std::string& device_name) {
+               return device_name == device_names.front();
+           });
 }
\ No newline at end of file
@@ -34,10 +34,15 @@ struct Configuration {
 
     bool dump_dot_files() const;
 
+    // the same device is listed several times (e.g. HETERO:CPU,CPU), so the model is split into the pipeline stages
+    bool pipeline_partitioning() const;
+
     std::string device_priorities;
 
     std::set<ov::hint::ModelDistributionPolicy> modelDistributionPolicy = {};
 
+    uint32_t micro_batches = 1;
+
     EncryptionCallbacks encryption_callbacks;
 
     ov::AnyMap device_properties;
@@ -0,0 +1,128 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "pipeline_partitioner.hpp"
+
+#include <algorithm>
+#include <unordered_set>
+
+#include "openvino/core/except.hpp"
+#include "openvino/op/convolution.hpp"
+#include "openvino/op/group_conv.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/util/op_types.hpp"
+
+namespace {
+
+size_t output_size(const ov::Output<const ov::Node>& output) {
+    const auto& shape = output.get_partial_shape();
+    return shape.is_static() ? ov::shape_size(shape.to_shape()) : 1;
+}
+
+// number of the multiply-adds per output element, 1 if unknown
+size_t reduction_size(const std::shared_ptr<const ov::Node>& node) {
+    if (const auto matmul = ov::as_type_ptr<const ov::op::v0::MatMul>(node)) {
+        const auto& shape = matmul->get_input_partial_shape(0);
+        if (shape.rank().is_static() && shape.size() > 0) {
+            const auto axis = matmul->get_transpose_a() && shape.size() > 1 ? shape.size() - 2 : shape.size() - 1;
+            const auto& dim = shape[axis];
+            return dim.is_static() ? static_cast<size_t>(dim.get_length()) : 1;
+        }
+    } else if (ov::is_type<ov::op::v1::Convolution>(node) || ov::is_type<ov::op::v1::GroupConvolution>(node)) {
+        // [O, I, K...] or [G, O, I, K...]
+        const auto& shape = node->get_input_partial_shape(1);
+        const size_t outputs_rank = ov::is_type<ov::op::v1::Convolution>(node) ? 1 : 2;
+        if (shape.is_static() && shape.size() > outputs_rank) {
+            const auto& weights_shape = shape.to_shape();
+            return ov::shape_size(weights_shape.begin() + outputs_rank, weights_shape.end());
+        }
+    }
+    return 1;
+}
+
+}  // namespace
+
+size_t ov::hetero::estimate_cost(const std::shared_ptr<const ov::Node>& node) {
+    if (ov::op::util::is_constant(node.get()) || ov::op::util::is_parameter(node.get()) ||
+        ov::op::util::is_output(node.get())) {
+        return 0;
+    }
+    size_t cost = 0;
+    for (const auto& output : node->outputs()) {
+        cost += output_size(output);
+    }
+    return std::max<size_t>(cost, 1) * reduction_size(node);
+}
+
+std::unordered_map<std::string, size_t> ov::hetero::partition_by_cost(const std::shared_ptr<const ov::Model>& model,
+                                                                      size_t num_stages) {
+    OPENVINO_ASSERT(num_stages > 0, "The number of the pipeline stages must be positive");
+    const auto ordered_ops = model->get_ordered_ops();
+
+    // the nodes computed from the constants only, they go to the stage of their consumers
+    std::unordered_set<const ov::Node*> weights;
+    for (const auto& op : ordered_ops) {
+        if (ov::op::util::is_constant(op)) {
+            weights.insert(op.get());
+        } else if (op->get_input_size() > 0 && !ov::op::util::is_output(op) && !ov::op::util::is_sink(op)) {
+            const auto inputs = op->inputs();
+            if (std::all_of(inputs.begin(), inputs.end(), [&](const ov::Input<ov::Node>& input) {
+                    return weights.count(input.get_source_output().get_node()) != 0;
+                })) {
+                weights.insert(op.get());
+            }
+        }
+    }
+    const auto is_computation = [&](const std::shared_ptr<const ov::Node>& op) {
+        return !weights.count(op.get()) && !ov::op::util::is_parameter(op.get()) && !ov::op::util::is_output(op.get());
+    };
+
+    size_t total_cost = 0;
+    for (const auto& op : ordered_ops) {
+        if (is_computation(op)) {
+            total_cost += estimate_cost(op);
+        }
+    }
+
+    // the computations are cut at the multiples of total_cost / num_stages, so each op goes to the stage where the
+    // middle of its cost falls
+    std::unordered_map<const ov::Node*, size_t> stages;
+    size_t accumulated_cost = 0;
+    for (const auto& op : ordered_ops) {
+        if (!is_computation(op)) {
+            continue;
+        }
+        const auto cost = estimate_cost(op);
+        const auto middle = static_cast<double>(accumulated_cost) + static_cast<double>(cost) / 2;
+        const auto stage = static_cast<size_t>(middle * static_cast<double>(num_stages) / total_cost);
+        stages[op.get()] = std::min(stage, num_stages - 1);
+        accumulated_cost += cost;
+    }
+
+    // the weights and the parameters go to the first stage consuming them
+    for (auto it = ordered_ops.rbegin(); it != ordered_ops.rend(); ++it) {
+        const auto& op = *it;
+        if (stages.count(op.get()) || ov::op::util::is_output(op)) {
+            continue;
+        }
+        size_t stage = num_stages;
+        for (const auto& output : op->outputs()) {
+            for (const auto& target_input : output.get_target_inputs()) {
+                const auto found = stages.find(target_input.get_node());
+                if (found != stages.end()) {
+                    stage = std::min(stage, found->second);
+                }
+            }
+        }
+        // consumed by the results only
+        stages[op.get()] = stage == num_stages ? 0 : stage;
+    }
+
+    std::unordered_map<std::string, size_t> stages_by_name;
+    for (const auto& op : ordered_ops) {
+        const auto stage = ov::op::util::is_output(op) ? stages.at(op->get_input_node_ptr(0)) : stages.at(op.get());
+        stages_by_name[op->get_friendly_name()] = stage;
+    }
+    return stages_by_name;
+}
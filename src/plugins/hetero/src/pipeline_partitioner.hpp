@@ -0,0 +1,27 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "openvino/core/model.hpp"
+
+namespace ov {
+namespace hetero {
+
+// Rough cost of the node execution: the multiply-adds of MatMul and Convolution, the output size of the others.
+// The constants, parameters and results cost nothing.
+size_t estimate_cost(const std::shared_ptr<const ov::Node>& node);
+
+// Assigns the ops of the model to the pipeline stages of about the same estimated cost. The ops are cut in the
+// topological order, so the data only flows to the next stages. The subgraphs computing the weights (e.g. the
+// decompression of the compressed weights) are kept with their consumers. Returns the stage per op friendly name.
+std::unordered_map<std::string, size_t> partition_by_cost(const std::shared_ptr<const ov::Model>& model,
+                                                          size_t num_stages);
+
+}  // namespace hetero
+}  // namespace ov
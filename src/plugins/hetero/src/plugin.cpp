@@ -23,10 +23,70 @@
 #include "openvino/runtime/internal_properties.hpp"
 #include "openvino/runtime/properties.hpp"
 #include "openvino/runtime/shared_buffer.hpp"
+#include "openvino/runtime/system_conf.hpp"
 #include "openvino/util/common_util.hpp"
+#include "pipeline_partitioner.hpp"
 #include "properties.hpp"
 #include "remote_context.hpp"
 
+namespace {
+// The submodels process a micro-batch per request, the batch is the first dimension of all the inputs and outputs
+void reshape_to_micro_batch(const std::shared_ptr<ov::Model>& model, uint32_t micro_batches) {
+    OPENVINO_ASSERT(model->get_sinks().empty() && model->get_variables().empty(),
+                    ov::hetero::micro_batches.name(),
+                    " is not supported for the stateful models");
+    const auto& parameters = model->get_parameters();
+    OPENVINO_ASSERT(!parameters.empty(),
+                    ov::hetero::micro_batches.name(),
+                    " is not supported for the models without inputs");
+    const auto& first_shape = parameters.front()->get_partial_shape();
+    OPENVINO_ASSERT(first_shape.is_static() && first_shape.size() > 0,
+                    "Cannot split the batch of the input ",
+                    parameters.front()->get_friendly_name(),
+                    " ",
+                    first_shape,
+                    " into micro-batches");
+    const auto batch = first_shape[0].get_length();
+    OPENVINO_ASSERT(batch % micro_batches == 0,
+                    "Cannot split the batch ",
+                    batch,
+                    " into ",
+                    micro_batches,
+                    " micro-batches");
+    const auto micro_batch = batch / micro_batches;
+
+    const auto check_batch = [&](const ov::Output<ov::Node>& output, int64_t expected_batch) {
+        const auto& shape = output.get_partial_shape();
+        OPENVINO_ASSERT(shape.is_static() && shape.size() > 0 && shape[0].get_length() == expected_batch,
+                        "Cannot split ",
+                        output.get_node()->get_friendly_name(),
+                        " ",
+                        shape,
+                        " into micro-batches, the batch ",
+                        expected_batch,
+                        " is expected in the first dimension");
+    };
+    std::map<ov::Output<ov::Node>, ov::PartialShape> new_shapes;
+    for (const auto& parameter : parameters) {
+        check_batch(parameter->output(0), batch);
+        auto shape = parameter->get_partial_shape();
+        shape[0] = micro_batch;
+        new_shapes.emplace(parameter->output(0), shape);
+    }
+    for (const auto& result : model->get_results()) {
+        check_batch(result->input_value(0), batch);
+    }
+    try {
+        model->reshape(new_shapes);
+    } catch (const ov::Exception& e) {
+        OPENVINO_THROW("Cannot reshape the model to the micro-batch ", micro_batch, ": ", e.what());
+    }
+    for (const auto& result : model->get_results()) {
+        check_batch(result->input_value(0), micro_batch);
+    }
+}
+}  // namespace
+
 ov::hetero::Plugin::Plugin() {
     set_device_name("HETERO");
 }
@@ -59,16 +119,20 @@ std::pair<ov::hetero::SubgraphsMappingInfo, std::vector<ov::hetero::SubmodelInfo
         submodels.resize(ordered_subgraphs.size());
         for (size_t i = 0; i < ordered_subgraphs.size(); ++i) {
             const auto& subgraph = ordered_subgraphs[i];
-            submodels[i].first = subgraph._affinity;
-            submodels[i].second = std::make_shared<ov::Model>(subgraph._results,
-                                                              subgraph._sinks,
-                                                              subgraph._parameters,
-                                                              model_name + "_" + std::to_string(i));
+            submodels[i].device = subgraph._affinity;
+            submodels[i].model = std::make_shared<ov::Model>(subgraph._results,
+                                                             subgraph._sinks,
+                                                             subgraph._parameters,
+                                                             model_name + "_" + std::to_string(i));
         }
 
         return {mapping_info, submodels};
     }
 
+    if (config.pipeline_partitioning()) {
+        return split_pipeline(model, config);
+    }
+
     // Restore properties in order to pass "device priorities" together
     // with devices properties
     auto full_properties = config.get_hetero_properties();
@@ -91,27 +155,77 @@ std::pair<ov::hetero::SubgraphsMappingInfo, std::vector<ov::hetero::SubmodelInfo
 
     submodels.resize(ordered_subgraphs.size());
     for (size_t i = 0; i < ordered_subgraphs.size(); ++i) {
-        submodels[i].first = ordered_subgraphs[i]->get_affinity();
-        submodels[i].second = ordered_subgraphs[i]->get_function();
+        submodels[i].device = ordered_subgraphs[i]->get_affinity();
+        submodels[i].model = ordered_subgraphs[i]->get_function();
     }
 
     return {mapping_info, submodels};
 }
 
+std::pair<ov::hetero::SubgraphsMappingInfo, std::vector<ov::hetero::SubmodelInfo>> ov::hetero::Plugin::split_pipeline(
+    const std::shared_ptr<ov::Model>& model,
+    const Configuration& config) const {
+    const auto device_names = ov::DeviceIDParser::get_hetero_devices(config.device_priorities);
+    const auto& device_name = device_names.front();
+
+    // all the stages run on the same device, so it must support the whole model
+    const auto device_config = get_properties_per_device(device_name, config.get_device_properties()).at(device_name);
+    const auto supported_ops = get_core()->query_model(model, device_name, device_config);
+    for (const auto& op : model->get_ordered_ops()) {
+        OPENVINO_ASSERT(ov::op::util::is_parameter(op) || ov::op::util::is_output(op) ||
+                            ov::op::util::is_constant(op) || supported_ops.count(op->get_friendly_name()),
+                        "The model cannot be split into the pipeline stages on ",
+                        device_name,
+                        ", the device does not support ",
+                        op->get_friendly_name(),
+                        " (",
+                        op->get_type_name(),
+                        ")");
+    }
+
+    ov::SupportedOpsMap stage_affinities;
+    for (const auto& [name, stage] : ov::hetero::partition_by_cost(model, device_names.size())) {
+        stage_affinities.emplace(name, std::to_string(stage));
+    }
+    ov::hetero::SubgraphsVector ordered_subgraphs;
+    SubgraphsMappingInfo mapping_info;
+    std::tie(ordered_subgraphs, mapping_info) =
+        get_model_subgraphs(model, stage_affinities, true, config.dump_dot_files());
+
+    // the stages are pinned to the NUMA nodes round-robin
+    const auto num_numa_nodes = ov::get_num_numa_nodes();
+    std::vector<ov::hetero::SubmodelInfo> submodels(ordered_subgraphs.size());
+    for (size_t i = 0; i < ordered_subgraphs.size(); ++i) {
+        const auto& subgraph = ordered_subgraphs[i];
+        submodels[i].device = device_name;
+        submodels[i].model = std::make_shared<ov::Model>(subgraph._results,
+                                                         subgraph._sinks,
+                                                         subgraph._parameters,
+                                                         model->get_friendly_name() + "_" + std::to_string(i));
+        if (num_numa_nodes > 1) {
+            submodels[i].numa_node = static_cast<int>(std::stoul(subgraph._affinity) % num_numa_nodes);
+        }
+    }
+    return {mapping_info, submodels};
+}
+
 std::shared_ptr<ov::ICompiledModel> ov::hetero::Plugin::compile_model(const std::shared_ptr<const ov::Model>& model,
                                                                       const ov::AnyMap& properties) const {
     OV_ITT_SCOPED_TASK(itt::domains::Hetero, "Plugin::compile_model");
 
     auto config = Configuration{properties, m_cfg};
     auto cloned_model = model->clone();
+    if (config.micro_batches > 1) {
+        reshape_to_micro_batch(cloned_model, config.micro_batches);
+    }
     SubgraphsMappingInfo mapping_info;
     std::vector<ov::hetero::SubmodelInfo> submodels;
     std::tie(mapping_info, submodels) = split_graph(cloned_model, config);
     ov::hetero::RemoteContext::Ptr remote_context;
     try {
         std::map<std::string, ov::SoPtr<ov::IRemoteContext>> contexts_map;
-        for (const auto& [device_name, _] : submodels) {
-            contexts_map.insert({device_name, get_core()->get_default_context(device_name)});
+        for (const auto& submodel : submodels) {
+            contexts_map.insert({submodel.device, get_core()->get_default_context(submodel.device)});
         }
         remote_context = std::make_shared<ov::hetero::RemoteContext>(std::move(contexts_map));
     } catch (const ov::Exception&) {
@@ -365,7 +479,9 @@ ov::Any ov::hetero::Plugin::get_property(const std::string& name, const ov::AnyM
         return ro_properties;
     };
     const auto& default_rw_properties = []() {
-        std::vector<ov::PropertyName> rw_properties{ov::device::priorities, ov::hint::model_distribution_policy};
+        std::vector<ov::PropertyName> rw_properties{ov::device::priorities,
+                                                    ov::hint::model_distribution_policy,
+                                                    ov::hetero::micro_batches};
         return rw_properties;
     };
 
@@ -18,7 +18,12 @@
 namespace ov {
 namespace hetero {
 
-using SubmodelInfo = std::pair<std::string, std::shared_ptr<ov::Model>>;
+struct SubmodelInfo {
+    std::string device;
+    std::shared_ptr<ov::Model> model;
+    // the NUMA node the pipeline stage is pinned to, -1 if not pinned
+    int numa_node = -1;
+};
 
 class CompiledModel;
 
@@ -81,6 +86,10 @@ private:
         const std::shared_ptr<ov::Model>& model,
         Configuration config) const;
 
+    std::pair<ov::hetero::SubgraphsMappingInfo, std::vector<SubmodelInfo>> split_pipeline(
+        const std::shared_ptr<ov::Model>& model,
+        const Configuration& config) const;
+
     Configuration m_cfg;
 
     mutable size_t independent_submodel_size = 0;
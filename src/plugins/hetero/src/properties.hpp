@@ -17,5 +17,11 @@ static constexpr Property<std::string, PropertyMutability::RO> caching_device_pr
  * @brief Read-only property showing number of compiled submodels
  */
 static constexpr Property<size_t, PropertyMutability::RO> number_of_submodels{"HETERO_NUMBER_OF_SUBMODELS"};
+
+/**
+ * @brief Read-write property to set the number of micro-batches the batch (the first dimension of the inputs) of a
+ * request is split into. The micro-batches flow through the submodels concurrently.
+ */
+static constexpr Property<uint32_t, PropertyMutability::RW> micro_batches{"HETERO_MICRO_BATCHES"};
 }  // namespace hetero
 }  // namespace ov
@@ -5,6 +5,7 @@
 #include "sync_infer_request.hpp"
 
 #include <algorithm>
+#include <future>
 #include <map>
 #include <memory>
 #include <string>
@@ -13,15 +14,20 @@
 #include "compiled_model.hpp"
 #include "itt.hpp"
 #include "openvino/core/except.hpp"
+#include "openvino/runtime/iremote_tensor.hpp"
 #include "openvino/runtime/make_tensor.hpp"
 #include "plugin.hpp"
+#include "properties.hpp"
 #include "remote_tensor.hpp"
 
 ov::hetero::InferRequest::InferRequest(const std::shared_ptr<const ov::hetero::CompiledModel>& compiled_model)
     : ov::ISyncInferRequest(compiled_model) {
-    for (auto&& comp_model_desc : compiled_model->m_compiled_submodels) {
-        auto& comp_model = comp_model_desc.compiled_model;
-        m_subrequests.push_back({comp_model->create_infer_request(), comp_model._so});
+    m_subrequests.resize(compiled_model->m_cfg.micro_batches);
+    for (auto& subrequests : m_subrequests) {
+        for (auto&& comp_model_desc : compiled_model->m_compiled_submodels) {
+            auto& comp_model = comp_model_desc.compiled_model;
+            subrequests.push_back({comp_model->create_infer_request(), comp_model._so});
+        }
     }
 
     for (size_t i = 0; i < compiled_model->inputs().size(); i++) {
@@ -35,23 +41,45 @@ ov::hetero::InferRequest::InferRequest(const std::shared_ptr<const ov::hetero::C
         m_port_to_subrequest_idx[port] = submodel_idx;
     }
 
-    std::map<ov::Output<const ov::Node>, ov::SoPtr<ov::ITensor>> temp_tensor_map;
-    for (const auto& kvp : compiled_model->m_mapping_info._submodels_input_to_prev_output) {
-        const auto& submodel_idx_in = kvp.first.first;
-        const auto& port_idx_in = kvp.first.second;
-        const auto& submodel_idx_out = kvp.second.first;
-        const auto& port_idx_out = kvp.second.second;
+    for (auto& subrequests : m_subrequests) {
+        std::map<ov::Output<const ov::Node>, ov::SoPtr<ov::ITensor>> temp_tensor_map;
+        for (const auto& kvp : compiled_model->m_mapping_info._submodels_input_to_prev_output) {
+            const auto& submodel_idx_in = kvp.first.first;
+            const auto& port_idx_in = kvp.first.second;
+            const auto& submodel_idx_out = kvp.second.first;
+            const auto& port_idx_out = kvp.second.second;
+
+            const auto& output_port = subrequests[submodel_idx_out]->get_compiled_model()->outputs()[port_idx_out];
+            const auto& output_tensor = subrequests[submodel_idx_out]->get_tensor(output_port);
+            if (temp_tensor_map.find(output_port) == temp_tensor_map.end()) {
+                temp_tensor_map[output_port] = {
+                    ov::make_tensor(output_tensor->get_element_type(), output_tensor->get_shape()),
+                    nullptr};
+            }
+            subrequests[submodel_idx_out]->set_tensor(output_port, temp_tensor_map[output_port]);
+            const auto& input_port = subrequests[submodel_idx_in]->get_compiled_model()->inputs()[port_idx_in];
+            subrequests[submodel_idx_in]->set_tensor(input_port, temp_tensor_map[output_port]);
+        }
+    }
 
-        const auto& output_port = m_subrequests[submodel_idx_out]->get_compiled_model()->outputs()[port_idx_out];
-        const auto& output_tensor = m_subrequests[submodel_idx_out]->get_tensor(output_port);
-        if (temp_tensor_map.find(output_port) == temp_tensor_map.end()) {
-            temp_tensor_map[output_port] = {
-                ov::make_tensor(output_tensor->get_element_type(), output_tensor->get_shape()),
-                nullptr};
+    if (has_micro_batches()) {
+        // the tensors of the whole batch are owned by the request, the subrequests get their views
+        for (const auto& ports : {get_inputs(), get_outputs()}) {
+            for (const auto& port : ports) {
+                allocate_tensor(port, [&port](ov::SoPtr<ov::ITensor>& tensor) {
+                    tensor = {ov::make_tensor(port.get_element_type(), port.get_shape()), nullptr};
+                });
+            }
+        }
+        m_bound_tensors.resize(get_inputs().size() + get_outputs().size());
+        for (size_t micro_batch = 0; micro_batch < m_subrequests.size(); ++micro_batch) {
+            for (size_t submodel = 0; submodel < m_subrequests[micro_batch].size(); ++submodel) {
+                m_subrequests[micro_batch][submodel]->set_callback(
+                    [this, micro_batch, submodel](std::exception_ptr exception_ptr) {
+                        on_micro_batch_done(micro_batch, submodel, std::move(exception_ptr));
+                    });
+            }
         }
-        m_subrequests[submodel_idx_out]->set_tensor(output_port, temp_tensor_map[output_port]);
-        const auto& input_port = m_subrequests[submodel_idx_in]->get_compiled_model()->inputs()[port_idx_in];
-        m_subrequests[submodel_idx_in]->set_tensor(input_port, temp_tensor_map[output_port]);
     }
 }
 
@@ -66,10 +94,13 @@ ov::SoPtr<ov::IAsyncInferRequest> ov::hetero::InferRequest::get_request(const ov
     } else {
         internal_port = get_outputs().at(found_port.idx);
     }
-    return m_subrequests[m_port_to_subrequest_idx.at(internal_port)];
+    return m_subrequests.front()[m_port_to_subrequest_idx.at(internal_port)];
 }
 
 ov::SoPtr<ov::ITensor> ov::hetero::InferRequest::get_tensor(const ov::Output<const ov::Node>& port) const {
+    if (has_micro_batches()) {
+        return ov::ISyncInferRequest::get_tensor(port);
+    }
     const auto infer_request = get_request(port);
     auto tensor = infer_request->get_tensor(port);
     if (!tensor._so) {
@@ -80,6 +111,13 @@ ov::SoPtr<ov::ITensor> ov::hetero::InferRequest::get_tensor(const ov::Output<con
 
 void ov::hetero::InferRequest::set_tensor(const ov::Output<const ov::Node>& port,
                                           const ov::SoPtr<ov::ITensor>& tensor) {
+    if (has_micro_batches()) {
+        OPENVINO_ASSERT(!std::dynamic_pointer_cast<ov::IRemoteTensor>(tensor._ptr),
+                        "Remote tensors are not supported with ",
+                        ov::hetero::micro_batches.name());
+        ov::ISyncInferRequest::set_tensor(port, tensor);
+        return;
+    }
     if (auto remote = std::dynamic_pointer_cast<ov::hetero::RemoteTensor>(tensor._ptr)) {
         auto device_name = get_request(port)->get_compiled_model()->get_context()->get_device_name();
         get_request(port)->set_tensor(port, remote->get_tensor_by_name(device_name));
@@ -90,6 +128,9 @@ void ov::hetero::InferRequest::set_tensor(const ov::Output<const ov::Node>& port
 
 std::vector<ov::SoPtr<ov::ITensor>> ov::hetero::InferRequest::get_tensors(
     const ov::Output<const ov::Node>& port) const {
+    if (has_micro_batches()) {
+        return ov::ISyncInferRequest::get_tensors(port);
+    }
     const auto infer_request = get_request(port);
     auto tensors = infer_request->get_tensors(port);
     for (auto& tensor : tensors) {
@@ -102,6 +143,9 @@ std::vector<ov::SoPtr<ov::ITensor>> ov::hetero::InferRequest::get_tensors(
 
 void ov::hetero::InferRequest::set_tensors(const ov::Output<const ov::Node>& port,
                                            const std::vector<ov::SoPtr<ov::ITensor>>& tensors) {
+    if (has_micro_batches()) {
+        return ov::ISyncInferRequest::set_tensors(port, tensors);
+    }
     return get_request(port)->set_tensors(port, tensors);
 }
 
@@ -113,7 +157,7 @@ void ov::hetero::InferRequest::check_tensors() const {
 
 std::vector<ov::SoPtr<ov::IVariableState>> ov::hetero::InferRequest::query_state() const {
     std::vector<ov::SoPtr<ov::IVariableState>> variable_states = {};
-    for (const auto& request : m_subrequests) {
+    for (const auto& request : m_subrequests.front()) {
         OPENVINO_ASSERT(request);
         for (auto&& state : request->query_state()) {
             if (!state._so)
@@ -125,19 +169,106 @@ std::vector<ov::SoPtr<ov::IVariableState>> ov::hetero::InferRequest::query_state
 }
 
 void ov::hetero::InferRequest::infer() {
-    for (auto&& request : m_subrequests) {
+    if (has_micro_batches()) {
+        std::promise<void> done;
+        start_micro_batches([&done](std::exception_ptr exception_ptr) {
+            if (exception_ptr) {
+                done.set_exception(exception_ptr);
+            } else {
+                done.set_value();
+            }
+        });
+        done.get_future().get();
+        return;
+    }
+    for (auto&& request : m_subrequests.front()) {
         OPENVINO_ASSERT(request);
         request->infer();
     }
 }
 
+void ov::hetero::InferRequest::bind_micro_batches() {
+    const auto compiled_model = std::static_pointer_cast<const ov::hetero::CompiledModel>(get_compiled_model());
+    const auto& mapping_info = compiled_model->m_mapping_info;
+    const auto bind = [&](const ov::Output<const ov::Node>& port, size_t tensor_idx, const NodeInfo& submodel_port) {
+        const auto& tensor = get_tensor_ptr(port);
+        if (m_bound_tensors[tensor_idx] == tensor._ptr) {
+            return;
+        }
+        const auto is_input = tensor_idx < get_inputs().size();
+        const auto& shape = tensor->get_shape();
+        const auto micro_batch_size = shape[0] / m_subrequests.size();
+        ov::Coordinate begin(shape.size(), 0), end(shape);
+        for (auto& subrequests : m_subrequests) {
+            end[0] = begin[0] + micro_batch_size;
+            auto& request = subrequests[submodel_port.first];
+            const auto& compiled_submodel = request->get_compiled_model();
+            const auto& ports = is_input ? compiled_submodel->inputs() : compiled_submodel->outputs();
+            request->set_tensor(ports.at(submodel_port.second), {ov::make_tensor(tensor._ptr, begin, end), tensor._so});
+            begin[0] = end[0];
+        }
+        m_bound_tensors[tensor_idx] = tensor._ptr;
+    };
+    for (size_t i = 0; i < get_inputs().size(); ++i) {
+        bind(get_inputs()[i], i, mapping_info._inputs_to_submodels_inputs[i]);
+    }
+    for (size_t i = 0; i < get_outputs().size(); ++i) {
+        bind(get_outputs()[i], get_inputs().size() + i, mapping_info._outputs_to_submodels_outputs[i]);
+    }
+}
+
+void ov::hetero::InferRequest::start_micro_batches(std::function<void(std::exception_ptr)> callback) {
+    try {
+        bind_micro_batches();
+    } catch (...) {
+        callback(std::current_exception());
+        return;
+    }
+    m_micro_batches_exception = nullptr;
+    m_micro_batches_callback = std::move(callback);
+    m_running_micro_batches = m_subrequests.size();
+    for (size_t micro_batch = 0; micro_batch < m_subrequests.size(); ++micro_batch) {
+        try {
+            m_subrequests[micro_batch].front()->start_async();
+        } catch (...) {
+            on_micro_batch_done(micro_batch, m_subrequests[micro_batch].size() - 1, std::current_exception());
+        }
+    }
+}
+
+void ov::hetero::InferRequest::on_micro_batch_done(size_t micro_batch,
+                                                   size_t submodel,
+                                                   std::exception_ptr exception_ptr) {
+    if (!exception_ptr && submodel + 1 < m_subrequests[micro_batch].size()) {
+        try {
+            m_subrequests[micro_batch][submodel + 1]->start_async();
+            return;
+        } catch (...) {
+            exception_ptr = std::current_exception();
+        }
+    }
+    if (exception_ptr) {
+        std::lock_guard<std::mutex> lock{m_micro_batches_mutex};
+        if (!m_micro_batches_exception) {
+            m_micro_batches_exception = std::move(exception_ptr);
+        }
+    }
+    if (--m_running_micro_batches == 0) {
+        auto callback = std::move(m_micro_batches_callback);
+        callback(m_micro_batches_exception);
+    }
+}
+
 std::vector<ov::ProfilingInfo> ov::hetero::InferRequest::get_profiling_info() const {
     std::vector<ov::ProfilingInfo> info;
-    for (size_t i = 0; i < m_subrequests.size(); ++i) {
-        auto&& subreq_info = m_subrequests[i]->get_profiling_info();
-        for (auto&& rec : subreq_info)
-            rec.node_name = std::string("subgraph") + std::to_string(i) + ": " + rec.node_name;
-        info.insert(info.end(), subreq_info.begin(), subreq_info.end());
+    for (size_t micro_batch = 0; micro_batch < m_subrequests.size(); ++micro_batch) {
+        const auto prefix = has_micro_batches() ? "microbatch" + std::to_string(micro_batch) + " " : std::string{};
+        for (size_t i = 0; i < m_subrequests[micro_batch].size(); ++i) {
+            auto&& subreq_info = m_subrequests[micro_batch][i]->get_profiling_info();
+            for (auto&& rec : subreq_info)
+                rec.node_name = prefix + std::string("subgraph") + std::to_string(i) + ": " + rec.node_name;
+            info.insert(info.end(), subreq_info.begin(), subreq_info.end());
+        }
     }
     return info;
 }
@@ -5,9 +5,12 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 #include <chrono>
+#include <functional>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -45,13 +48,35 @@ public:
 
     void check_tensors() const override;
 
+    bool has_micro_batches() const {
+        return m_subrequests.size() > 1;
+    }
+
+    // Runs the micro-batches through the submodels, each micro-batch starts the next submodel once the previous one
+    // is done, so the micro-batches overlap on the different submodels. The callback is called when all of them are
+    // done or failed.
+    void start_micro_batches(std::function<void(std::exception_ptr)> callback);
+
 private:
     friend class AsyncInferRequest;
 
     ov::SoPtr<ov::IAsyncInferRequest> get_request(const ov::Output<const ov::Node>& port) const;
 
-    std::vector<ov::SoPtr<ov::IAsyncInferRequest>> m_subrequests;
+    void on_micro_batch_done(size_t micro_batch, size_t submodel, std::exception_ptr exception_ptr);
+
+    // sets the micro-batch views of the user tensors to the subrequests
+    void bind_micro_batches();
+
+    // [micro-batch][submodel]
+    std::vector<std::vector<ov::SoPtr<ov::IAsyncInferRequest>>> m_subrequests;
     std::map<ov::Output<const ov::Node>, size_t> m_port_to_subrequest_idx;
+
+    // the user tensors (inputs, then outputs) which views are set to the subrequests of the micro-batches
+    std::vector<std::shared_ptr<ov::ITensor>> m_bound_tensors;
+    std::function<void(std::exception_ptr)> m_micro_batches_callback;
+    std::atomic<size_t> m_running_micro_batches{0};
+    std::mutex m_micro_batches_mutex;
+    std::exception_ptr m_micro_batches_exception;
 };
 
 }  // namespace hetero
@@ -0,0 +1,106 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#include "common_test_utils/test_constants.hpp"
+#include "hetero_tests.hpp"
+#include "openvino/opsets/opset11.hpp"
+#include "properties.hpp"
+
+using namespace ov::hetero::tests;
+
+namespace {
+std::shared_ptr<ov::Model> create_model_with_batch(int64_t batch) {
+    auto param = std::make_shared<ov::opset11::Parameter>(ov::element::i64, ov::PartialShape{batch, 3, 2, 2});
+    param->set_friendly_name("input");
+    auto const_value = ov::opset11::Constant::create(ov::element::i64, ov::Shape{1, 1, 1, 1}, {1});
+    const_value->set_friendly_name("const_val");
+    auto add = std::make_shared<ov::opset11::Add>(param, const_value);
+    add->set_friendly_name("add");
+    auto subtract = std::make_shared<ov::opset11::Subtract>(add, const_value);
+    subtract->set_friendly_name("sub");
+    auto add_again = std::make_shared<ov::opset11::Add>(subtract, subtract);
+    add_again->set_friendly_name("add_again");
+    auto result = std::make_shared<ov::opset11::Result>(add_again);
+    result->set_friendly_name("res");
+    return std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{param});
+}
+
+void check_doubled(const ov::Tensor& input, const ov::Tensor& output) {
+    ASSERT_EQ(input.get_shape(), output.get_shape());
+    const auto* in = input.data<int64_t>();
+    const auto* out = output.data<int64_t>();
+    for (size_t i = 0; i < input.get_size(); ++i) {
+        ASSERT_EQ(in[i] * 2, out[i]) << "at " << i;
+    }
+}
+}  // namespace
+
+TEST_F(HeteroTests, infer_with_micro_batches) {
+    ov::AnyMap config = {ov::device::priorities("MOCK0,MOCK1"), ov::hetero::micro_batches(2)};
+    auto compiled_model = core.compile_model(create_model_with_batch(4), ov::test::utils::DEVICE_HETERO, config);
+    EXPECT_EQ(2, compiled_model.get_property(ov::hetero::micro_batches));
+    // the user sees the whole batch
+    EXPECT_EQ(ov::Shape({4, 3, 2, 2}), compiled_model.input().get_shape());
+    EXPECT_EQ(ov::Shape({4, 3, 2, 2}), compiled_model.output().get_shape());
+
+    auto infer_request = compiled_model.create_infer_request();
+    auto input_tensor = create_and_fill_tensor(ov::element::i64, compiled_model.input().get_shape());
+    infer_request.set_input_tensor(input_tensor);
+    infer_request.infer();
+    check_doubled(input_tensor, infer_request.get_output_tensor());
+
+    // the new tensors are bound to the micro-batches
+    auto new_input_tensor = create_and_fill_tensor(ov::element::i64, compiled_model.input().get_shape());
+    for (size_t i = 0; i < new_input_tensor.get_size(); ++i) {
+        new_input_tensor.data<int64_t>()[i] += 7;
+    }
+    ov::Tensor output_tensor(ov::element::i64, compiled_model.output().get_shape());
+    infer_request.set_input_tensor(new_input_tensor);
+    infer_request.set_output_tensor(output_tensor);
+    infer_request.start_async();
+    infer_request.wait();
+    check_doubled(new_input_tensor, output_tensor);
+}
+
+TEST_F(HeteroTests, compile_with_micro_batches_throw) {
+    // the batch can't be split
+    ov::AnyMap config = {ov::device::priorities("MOCK0,MOCK1"), ov::hetero::micro_batches(3)};
+    EXPECT_THROW(core.compile_model(create_model_with_batch(4), ov::test::utils::DEVICE_HETERO, config),
+                 ov::Exception);
+    config = {ov::device::priorities("MOCK0,MOCK1"), ov::hetero::micro_batches(0)};
+    EXPECT_THROW(core.compile_model(create_model_with_batch(4), ov::test::utils::DEVICE_HETERO, config),
+                 ov::Exception);
+}
+
+TEST_F(HeteroTests, compile_pipeline_stages) {
+    ov::AnyMap config = {ov::device::priorities("MOCK1,MOCK1")};
+    auto compiled_model = core.compile_model(create_model_with_batch(1), ov::test::utils::DEVICE_HETERO, config);
+    EXPECT_EQ(2, compiled_model.get_property(ov::hetero::number_of_submodels));
+    EXPECT_EQ(std::vector<std::string>{"MOCK1"}, compiled_model.get_property(ov::execution_devices));
+
+    auto infer_request = compiled_model.create_infer_request();
+    auto input_tensor = create_and_fill_tensor(ov::element::i64, compiled_model.input().get_shape());
+    infer_request.set_input_tensor(input_tensor);
+    infer_request.infer();
+    check_doubled(input_tensor, infer_request.get_output_tensor());
+}
+
+TEST_F(HeteroTests, compile_pipeline_stages_with_micro_batches) {
+    ov::AnyMap config = {ov::device::priorities("MOCK1,MOCK1,MOCK1"), ov::hetero::micro_batches(4)};
+    auto compiled_model = core.compile_model(create_model_with_batch(8), ov::test::utils::DEVICE_HETERO, config);
+    EXPECT_EQ(3, compiled_model.get_property(ov::hetero::number_of_submodels));
+
+    auto infer_request = compiled_model.create_infer_request();
+    auto input_tensor = create_and_fill_tensor(ov::element::i64, compiled_model.input().get_shape());
+    infer_request.set_input_tensor(input_tensor);
+    infer_request.start_async();
+    infer_request.wait();
+    check_doubled(input_tensor, infer_request.get_output_tensor());
+}
+
+TEST_F(HeteroTests, compile_pipeline_stages_unsupported_throw) {
+    // MOCK0 doesn't support Subtract
+    ov::AnyMap config = {ov::device::priorities("MOCK0,MOCK0")};
+    EXPECT_THROW(core.compile_model(create_model_with_batch(1), ov::test::utils::DEVICE_HETERO, config),
+                 ov::Exception);
+}
@@ -0,0 +1,107 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "pipeline_partitioner.hpp"
+
+#include <gtest/gtest.h>
+
+#include "openvino/core/except.hpp"
+#include "openvino/op/ops.hpp"
+
+using namespace ov::hetero;
+
+namespace {
+// input -> relu0 -> relu1 -> ... -> res
+std::shared_ptr<ov::Model> create_chain_model(size_t length) {
+    auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{1, 16});
+    param->set_friendly_name("input");
+    ov::Output<ov::Node> output = param;
+    for (size_t i = 0; i < length; ++i) {
+        auto relu = std::make_shared<ov::op::v0::Relu>(output);
+        relu->set_friendly_name("relu" + std::to_string(i));
+        output = relu;
+    }
+    auto result = std::make_shared<ov::op::v0::Result>(output);
+    result->set_friendly_name("res");
+    return std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{param});
+}
+
+// input -> add -> matmul(decompressed weights) -> relu -> res
+std::shared_ptr<ov::Model> create_matmul_model() {
+    auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{1, 64});
+    param->set_friendly_name("input");
+    auto bias = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{1, 64}, {1.f});
+    bias->set_friendly_name("bias");
+    auto add = std::make_shared<ov::op::v1::Add>(param, bias);
+    add->set_friendly_name("add");
+    auto weights = ov::op::v0::Constant::create(ov::element::f16, ov::Shape{64, 64}, {1.f});
+    weights->set_friendly_name("weights");
+    auto convert = std::make_shared<ov::op::v0::Convert>(weights, ov::element::f32);
+    convert->set_friendly_name("convert");
+    auto matmul = std::make_shared<ov::op::v0::MatMul>(add, convert);
+    matmul->set_friendly_name("matmul");
+    auto relu = std::make_shared<ov::op::v0::Relu>(matmul);
+    relu->set_friendly_name("relu");
+    auto result = std::make_shared<ov::op::v0::Result>(relu);
+    result->set_friendly_name("res");
+    return std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{param});
+}
+}  // namespace
+
+TEST(PipelinePartitionerTest, estimate_cost) {
+    const auto model = create_matmul_model();
+    for (const auto& op : model->get_ordered_ops()) {
+        const auto& name = op->get_friendly_name();
+        if (name == "matmul" || name == "convert") {
+            EXPECT_EQ(64 * 64, estimate_cost(op));
+        } else if (name == "add" || name == "relu") {
+            EXPECT_EQ(64, estimate_cost(op));
+        } else {
+            EXPECT_EQ(0, estimate_cost(op)) << name;
+        }
+    }
+}
+
+TEST(PipelinePartitionerTest, balanced_chain) {
+    const auto stages = partition_by_cost(create_chain_model(8), 4);
+    EXPECT_EQ(0, stages.at("input"));
+    for (size_t i = 0; i < 8; ++i) {
+        EXPECT_EQ(i / 2, stages.at("relu" + std::to_string(i)));
+    }
+    EXPECT_EQ(3, stages.at("res"));
+}
+
+TEST(PipelinePartitionerTest, more_stages_than_ops) {
+    const auto stages = partition_by_cost(create_chain_model(2), 4);
+    size_t prev_stage = 0;
+    for (const auto& name : {"input", "relu0", "relu1", "res"}) {
+        const auto stage = stages.at(name);
+        EXPECT_LT(stage, 4);
+        EXPECT_LE(prev_stage, stage);
+        prev_stage = stage;
+    }
+}
+
+TEST(PipelinePartitionerTest, weights_go_with_consumers) {
+    const auto stages = partition_by_cost(create_matmul_model(), 2);
+    // the matmul dominates the cost
+    EXPECT_EQ(0, stages.at("add"));
+    EXPECT_EQ(stages.at("add"), stages.at("bias"));
+    EXPECT_EQ(stages.at("matmul"), stages.at("weights"));
+    EXPECT_EQ(stages.at("matmul"), stages.at("convert"));
+    EXPECT_EQ(stages.at("relu"), stages.at("res"));
+    EXPECT_LE(stages.at("matmul"), stages.at("relu"));
+    EXPECT_EQ(1, stages.at("relu"));
+}
+
+TEST(PipelinePartitionerTest, single_stage) {
+    const auto stages = partition_by_cost(create_matmul_model(), 1);
+    for (const auto& stage : stages) {
+        EXPECT_EQ(0, stage.second) << stage.first;
+    }
+}
+
+TEST(PipelinePartitionerTest, zero_stages_throw) {
+    EXPECT_THROW(partition_by_cost(create_chain_model(2), 0), ov::Exception);
+}
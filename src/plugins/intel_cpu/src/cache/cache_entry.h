@@ -9,7 +9,8 @@
 #include <functional>
 #include <utility>
 
-#include "lru_cache.h"
+#include "cache_statistics.h"
+#include "clock_cache.h"
 
 namespace ov::intel_cpu {
 
@@ -18,6 +19,8 @@ public:
     enum class LookUpStatus : int8_t { Hit, Miss };
 
     virtual ~CacheEntryBase() = default;
+
+    [[nodiscard]] virtual CacheStatistics getStatistics() const = 0;
 };
 
 /**
@@ -25,13 +28,13 @@ public:
  * @tparam KeyType is a key type that must define hash() const method with return type convertible to size_t and define
  * comparison operator.
  * @tparam ValType is a type that must meet all the requirements to the std::unordered_map mapped type
- * @tparam ImplType is a type for the internal storage. It must provide put(KeyType, ValueType) and ValueType get(const
- * KeyType&) interface and must have constructor of type ImplType(size_t).
+ * @tparam ImplType is a type for the internal storage. It must provide put(KeyType, ValueType), ValueType get(const
+ * KeyType&) and CacheStatistics getStatistics() interface and must have constructor of type ImplType(size_t).
  *
  * @note In this implementation default constructed value objects are treated as empty objects.
  */
 
-template <typename KeyType, typename ValType, typename ImplType = LruCache<KeyType, ValType>>
+template <typename KeyType, typename ValType, typename ImplType = ClockCache<KeyType, ValType>>
 class CacheEntry : public CacheEntryBase {
 public:
     using ResultType = std::pair<ValType, LookUpStatus>;
@@ -65,6 +68,10 @@ public:
         return {retVal, retStatus};
     }
 
+    [[nodiscard]] CacheStatistics getStatistics() const override {
+        return _impl.getStatistics();
+    }
+
     ImplType _impl;
 };
 
@@ -0,0 +1,29 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+
+namespace ov::intel_cpu {
+
+/**
+ * @brief Lookup counters of a preemptive cache, used to choose the cache capacity from the real workload
+ */
+struct CacheStatistics {
+    size_t hits = 0;
+    size_t misses = 0;
+    size_t evictions = 0;
+    size_t size = 0;  // number of stored records
+
+    CacheStatistics& operator+=(const CacheStatistics& rhs) {
+        hits += rhs.hits;
+        misses += rhs.misses;
+        evictions += rhs.evictions;
+        size += rhs.size;
+        return *this;
+    }
+};
+
+}  // namespace ov::intel_cpu
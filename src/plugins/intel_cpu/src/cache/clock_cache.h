@@ -0,0 +1,223 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "cache_statistics.h"
+
+/**
+ * @brief This is a sharded preemptive cache with CLOCK (second chance) eviction policy.
+ * @tparam Key is a key type that must define hash() const method with return type convertible to size_t and define
+ * comparison operator.
+ * @tparam Value is a type that must meet all the requirements to the std::unordered_map mapped type
+ *
+ * The records are distributed over independent shards by the key hash. Each shard is guarded by its own reader/writer
+ * lock, lookups only take the shared lock and set the reference bit of the record, so concurrent lookups do not
+ * serialize on a single mutex and do not modify any list structure. A new record replaces the first record found by
+ * the clock hand which was not referenced since the previous pass.
+ *
+ * @note This cache implementation IS THREAD SAFE.
+ */
+
+namespace ov::intel_cpu {
+
+template <typename Key, typename Value>
+class ClockCache {
+public:
+    explicit ClockCache(size_t capacity) : _capacity(capacity) {
+        size_t num_shards = 1;
+        while (num_shards < max_shards && capacity / (num_shards * 2) >= min_shard_capacity) {
+            num_shards *= 2;
+        }
+        _shards.reserve(num_shards);
+        for (size_t i = 0; i < num_shards; ++i) {
+            // distribute the remainder, so the total capacity is exactly the requested one
+            const size_t shard_capacity = capacity / num_shards + (i < capacity % num_shards ? 1 : 0);
+            _shards.emplace_back(std::make_unique<Shard>(shard_capacity));
+        }
+    }
+
+    /**
+     * @brief Puts the value associated with the key into the cache.
+     * @param key
+     * @param value
+     */
+
+    void put(const Key& key, const Value& val) {
+        if (0 == _capacity) {
+            return;
+        }
+        auto& shard = getShard(key);
+        std::unique_lock<std::shared_mutex> lock(shard.guard);
+        auto mapItr = shard.mapper.find(key);
+        if (mapItr != shard.mapper.end()) {
+            auto& slot = shard.slots[mapItr->second];
+            slot.entry->value = val;
+            slot.referenced.store(true, std::memory_order_relaxed);
+            return;
+        }
+
+        size_t index = 0;
+        if (shard.used < shard.slots.size()) {
+            index = shard.used++;
+        } else {
+            index = shard.findVictim();
+            shard.mapper.erase(shard.slots[index].entry->key);
+            shard.counters.evictions.fetch_add(1, std::memory_order_relaxed);
+        }
+        auto& slot = shard.slots[index];
+        slot.entry.emplace(Entry{key, val});
+        slot.referenced.store(false, std::memory_order_relaxed);
+        shard.mapper.emplace(key, index);
+    }
+
+    /**
+     * @brief Searches a value associated with the key.
+     * @param key
+     * @return Value associated with the key or default constructed instance of the Value type.
+     */
+
+    Value get(const Key& key) {
+        auto& shard = getShard(key);
+        std::shared_lock<std::shared_mutex> lock(shard.guard);
+        auto itr = shard.mapper.find(key);
+        if (itr == shard.mapper.end()) {
+            shard.counters.misses.fetch_add(1, std::memory_order_relaxed);
+            return Value();
+        }
+        shard.counters.hits.fetch_add(1, std::memory_order_relaxed);
+        auto& slot = shard.slots[itr->second];
+        // a hot record is already referenced, skipping the store keeps its cache line shared between the readers
+        if (!slot.referenced.load(std::memory_order_relaxed)) {
+            slot.referenced.store(true, std::memory_order_relaxed);
+        }
+        return slot.entry->value;
+    }
+
+    /**
+     * @brief Evicts up to n records which were not referenced recently
+     * @param n number of records to be evicted, can be greater than capacity
+     */
+
+    void evict(size_t n) {
+        for (auto& shard_ptr : _shards) {
+            auto& shard = *shard_ptr;
+            std::unique_lock<std::shared_mutex> lock(shard.guard);
+            while (n > 0 && shard.used > 0) {
+                const size_t index = shard.findVictim();
+                shard.mapper.erase(shard.slots[index].entry->key);
+                // keep occupied slots dense
+                const size_t last = --shard.used;
+                if (index != last) {
+                    auto& dst = shard.slots[index];
+                    auto& src = shard.slots[last];
+                    dst.entry.emplace(std::move(*src.entry));
+                    dst.referenced.store(src.referenced.load(std::memory_order_relaxed), std::memory_order_relaxed);
+                    shard.mapper.find(dst.entry->key)->second = index;
+                }
+                shard.slots[last].entry.reset();
+                shard.slots[last].referenced.store(false, std::memory_order_relaxed);
+                shard.counters.evictions.fetch_add(1, std::memory_order_relaxed);
+                --n;
+            }
+        }
+    }
+
+    /**
+     * @brief Returns the current capacity value
+     * @return the current capacity value
+     */
+    [[nodiscard]] size_t getCapacity() const noexcept {
+        return _capacity;
+    }
+
+    /**
+     * @brief Returns the lookup counters and the number of stored records
+     */
+    [[nodiscard]] CacheStatistics getStatistics() const {
+        CacheStatistics statistics;
+        for (const auto& shard : _shards) {
+            std::shared_lock<std::shared_mutex> lock(shard->guard);
+            statistics.hits += shard->counters.hits.load(std::memory_order_relaxed);
+            statistics.misses += shard->counters.misses.load(std::memory_order_relaxed);
+            statistics.evictions += shard->counters.evictions.load(std::memory_order_relaxed);
+            statistics.size += shard->used;
+        }
+        return statistics;
+    }
+
+private:
+    static constexpr size_t max_shards = 16;
+    static constexpr size_t min_shard_capacity = 16;
+
+    struct key_hasher {
+        std::size_t operator()(const Key& k) const {
+            return k.hash();
+        }
+    };
+
+    struct Entry {
+        Key key;
+        Value value;
+    };
+
+    struct Slot {
+        std::optional<Entry> entry;
+        std::atomic<bool> referenced{false};
+    };
+
+    // each shard counts its own lookups, so the readers of different shards don't contend on shared counters
+    struct alignas(64) Counters {  // 64 bytes is the cache line size
+        std::atomic<size_t> hits{0};
+        std::atomic<size_t> misses{0};
+        std::atomic<size_t> evictions{0};
+    };
+
+    struct Shard {
+        explicit Shard(size_t capacity) : slots(capacity) {}
+
+        // must be called under the exclusive lock with at least one occupied slot
+        size_t findVictim() {
+            for (;;) {
+                if (hand >= used) {
+                    hand = 0;
+                }
+                auto& slot = slots[hand];
+                const size_t index = hand++;
+                if (!slot.referenced.exchange(false, std::memory_order_relaxed)) {
+                    return index;
+                }
+            }
+        }
+
+        mutable std::shared_mutex guard;
+        std::vector<Slot> slots;
+        std::unordered_map<Key, size_t, key_hasher> mapper;
+        size_t used = 0;
+        size_t hand = 0;
+        Counters counters;
+    };
+
+    Shard& getShard(const Key& key) {
+        // the low bits also select the bucket inside the shard map, so mix in the high ones
+        size_t h = key.hash();
+        h ^= (h >> 16) ^ (h >> 7);
+        return *_shards[h & (_shards.size() - 1)];
+    }
+
+    std::vector<std::unique_ptr<Shard>> _shards;
+    size_t _capacity;
+};
+
+}  // namespace ov::intel_cpu
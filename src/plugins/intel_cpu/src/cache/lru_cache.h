@@ -9,6 +9,8 @@
 #include <unordered_map>
 #include <utility>
 
+#include "cache_statistics.h"
+
 /**
  * @brief This is yet another implementation of a preemptive cache with LRU eviction policy.
  * @tparam Key is a key type that must define hash() const method with return type convertible to size_t and define
@@ -59,9 +61,11 @@ public:
     Value get(const Key& key) {
         auto itr = _cacheMapper.find(key);
         if (itr == _cacheMapper.end()) {
+            _statistics.misses++;
             return Value();
         }
 
+        _statistics.hits++;
         touch(itr->second);
         return _lruList.front().second;
     }
@@ -75,6 +79,7 @@ public:
         for (size_t i = 0; i < n && !_lruList.empty(); ++i) {
             _cacheMapper.erase(_lruList.back().first);
             _lruList.pop_back();
+            _statistics.evictions++;
         }
     }
 
@@ -86,6 +91,15 @@ public:
         return _capacity;
     }
 
+    /**
+     * @brief Returns the lookup counters and the number of stored records
+     */
+    [[nodiscard]] CacheStatistics getStatistics() const {
+        auto statistics = _statistics;
+        statistics.size = _cacheMapper.size();
+        return statistics;
+    }
+
 private:
     struct key_hasher {
         std::size_t operator()(const Key& k) const {
@@ -103,6 +117,7 @@ private:
     lru_list_type _lruList;
     std::unordered_map<Key, cache_map_value_type, key_hasher> _cacheMapper;
     size_t _capacity;
+    CacheStatistics _statistics;
 };
 
 }  // namespace ov::intel_cpu
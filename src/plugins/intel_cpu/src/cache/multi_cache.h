@@ -7,17 +7,21 @@
 #include <atomic>
 #include <cstddef>
 #include <memory>
+#include <mutex>
+#include <shared_mutex>
 #include <type_traits>
 #include <unordered_map>
 
 #include "cache_entry.h"
+#include "cache_statistics.h"
 
 namespace ov::intel_cpu {
 
 /**
  * @brief Class that represent a preemptive cache for different key/value pair types.
  *
- * @attention This implementation IS NOT THREAD SAFE!
+ * @note This implementation IS THREAD SAFE. Concurrent lookups of the same missing key may build the value more than
+ * once, the last built value is stored.
  */
 
 class MultiCache {
@@ -34,6 +38,11 @@ public:
      */
     explicit MultiCache(size_t capacity) : _capacity(capacity) {}
 
+    MultiCache(const MultiCache& other) : _capacity(other._capacity) {
+        std::shared_lock<std::shared_mutex> lock(other._guard);
+        _storage = other._storage;
+    }
+
     /**
      * @brief Searches a value of ValueType in the cache using the provided key or creates a new ValueType instance (if
      * nothing was found) using the key and the builder functor and adds the new record to the cache
@@ -51,6 +60,18 @@ public:
         return entry->getOrCreate(key, std::move(builder));
     }
 
+    /**
+     * @brief Returns the lookup counters summed over all the entries
+     */
+    [[nodiscard]] CacheStatistics getStatistics() const {
+        CacheStatistics retVal;
+        std::shared_lock<std::shared_mutex> lock(_guard);
+        for (const auto& item : _storage) {
+            retVal += item.second->getStatistics();
+        }
+        return retVal;
+    }
+
 private:
     template <typename T>
     size_t getTypeId();
@@ -60,6 +81,7 @@ private:
     static std::atomic_size_t _typeIdCounter;
     size_t _capacity;
     std::unordered_map<size_t, EntryBasePtr> _storage;
+    mutable std::shared_mutex _guard;
 };
 
 template <typename T>
@@ -72,6 +94,14 @@ template <typename KeyType, typename ValueType>
 MultiCache::EntryPtr<KeyType, ValueType> MultiCache::getEntry() {
     using EntryType = EntryTypeT<KeyType, ValueType>;
     size_t id = getTypeId<EntryType>();
+    {
+        std::shared_lock<std::shared_mutex> lock(_guard);
+        auto itr = _storage.find(id);
+        if (itr != _storage.end()) {
+            return std::static_pointer_cast<EntryType>(itr->second);
+        }
+    }
+    std::unique_lock<std::shared_mutex> lock(_guard);
     auto itr = _storage.find(id);
     if (itr == _storage.end()) {
         auto result = _storage.insert({id, std::make_shared<EntryType>(_capacity)});
@@ -5,15 +5,21 @@
 #include "compiled_model.h"
 
 #include <algorithm>
+#include <chrono>
+#include <cstdint>
 #include <cstring>
 #include <exception>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <ostream>
+#include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
 #include "async_infer_request.h"
+#include "cache/cache_statistics.h"
 #include "config.h"
 #include "cpu_parallel.hpp"
 #include "graph.h"
@@ -21,20 +27,27 @@
 #include "infer_request.h"
 #include "internal_properties.hpp"
 #include "low_precision/low_precision.hpp"
+#include "nodes/paged_attn.h"
 #include "openvino/core/any.hpp"
 #include "openvino/core/except.hpp"
 #include "openvino/core/model.hpp"
+#include "openvino/pass/manager.hpp"
 #include "openvino/runtime/iasync_infer_request.hpp"
 #include "openvino/runtime/icompiled_model.hpp"
 #include "openvino/runtime/intel_cpu/properties.hpp"
 #include "openvino/runtime/iplugin.hpp"
 #include "openvino/runtime/isync_infer_request.hpp"
+#include "openvino/runtime/make_tensor.hpp"
 #include "openvino/runtime/properties.hpp"
 #include "openvino/runtime/threading/cpu_message.hpp"
 #include "openvino/runtime/threading/cpu_streams_info.hpp"
 #include "openvino/runtime/threading/istreams_executor.hpp"
 #include "openvino/runtime/threading/itask_executor.hpp"
+#include "openvino/runtime/tensor.hpp"
+#include "paged_kv_cache.hpp"
+#include "shape_warmup_cache.hpp"
 #include "sub_memory_manager.hpp"
+#include "transformations/hash.hpp"
 #include "utils/debug_capabilities.h"
 #include "utils/general_utils.h"
 #include "utils/graph_serializer/serializer.hpp"
@@ -60,6 +73,15 @@ struct ImmediateSerialExecutor : public ov::threading::ITaskExecutor {
 };
 
 CompiledModel::~CompiledModel() {
+    if (m_shape_warmup_thread.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(m_shape_warmup_mutex);
+            m_shape_warmup_stop = true;
+        }
+        m_shape_warmup_cv.notify_all();
+        m_shape_warmup_thread.join();
+        m_shape_warmup_cache->flush();
+    }
     if (m_has_sub_compiled_models) {
         m_sub_compiled_models.clear();
         m_sub_memory_manager->_memorys_table.clear();
@@ -75,13 +97,16 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
                              const std::shared_ptr<const ov::IPlugin>& plugin,
                              Config cfg,
                              const bool loaded_from_cache,
-                             std::shared_ptr<SubMemoryManager> sub_memory_manager)
+                             std::shared_ptr<SubMemoryManager> sub_memory_manager,
+                             PackedWeights::Ptr packed_weights)
     : ov::ICompiledModel::ICompiledModel(model, plugin),
       m_model(model),
       m_plugin(plugin),
       m_cfg{std::move(cfg)},
       m_name{model->get_name()},
       m_loaded_from_cache(loaded_from_cache),
+      m_packed_weights(std::move(packed_weights)),
+      m_socketWeights(m_cfg.weightsNumaPolicy),
       m_sub_memory_manager(std::move(sub_memory_manager)) {
     m_mutex = std::make_shared<std::mutex>();
     const auto& core = m_plugin->get_core();
@@ -171,11 +196,125 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
                 std::make_shared<CompiledModel>(model, plugin, sub_cfg, loaded_from_cache, m_sub_memory_manager));
         }
     }
+    if (m_cfg.pagedKvCacheBlocks > 0 && !m_has_sub_compiled_models && PagedKVCache::is_paged_model(*m_model)) {
+        m_paged_kv_cache = std::make_shared<PagedKVCache>(*m_model,
+                                                          static_cast<size_t>(m_cfg.pagedKvCacheBlocks),
+                                                          node::PagedAttention::cacheBlockSize);
+    }
+    if (m_cfg.enableShapeWarmupCache && !m_has_sub_compiled_models && m_model->is_dynamic()) {
+        init_shape_warmup_cache();
+    }
+}
+
+void CompiledModel::init_shape_warmup_cache() {
+    std::string cache_dir;
+    try {
+        cache_dir = m_plugin->get_core()->get_property(m_plugin->get_device_name(), ov::cache_dir);
+    } catch (const ov::Exception&) {
+        return;
+    }
+    if (cache_dir.empty()) {
+        return;
+    }
+    // The records are keyed by the hash of the runtime model topology at the compilation, the weights don't affect the
+    // shapes and aren't hashed. It is kept in the blob, so the imported model finds the records of the compiled one.
+    constexpr const char* model_id_key = "intel_cpu_shape_warmup_id";
+    std::string model_id;
+    if (!m_loaded_from_cache) {
+        uint64_t hash = 0;
+        ov::pass::Manager manager;
+        manager.register_pass<ov::pass::Hash>(hash, true);
+        manager.run_passes(m_model);
+        model_id = std::to_string(hash);
+        m_model->set_rt_info(model_id, model_id_key);
+    } else if (m_model->has_rt_info(model_id_key)) {
+        model_id = m_model->get_rt_info<std::string>(model_id_key);
+    } else {
+        // the blob was exported without the shape warmup cache
+        return;
+    }
+    constexpr size_t max_records = 1024;
+    m_shape_warmup_cache = std::make_shared<ShapeWarmupCache>(cache_dir, model_id, *m_model, max_records);
+    m_shape_warmup_thread = std::thread(&CompiledModel::shape_warmup_routine, this);
+}
+
+void CompiledModel::shape_warmup_routine() {
+    // the import doesn't wait for the warmup, it is interrupted by the destructor
+    if (m_loaded_from_cache) {
+        try {
+            replay_warmup_shapes();
+        } catch (const std::exception& e) {
+            DEBUG_LOG("Shape warmup of ", m_name, " is interrupted: ", e.what());
+        }
+    }
+
+    // new shapes are written periodically, so the records survive a process which is killed
+    constexpr auto flush_interval = std::chrono::seconds(10);
+    std::unique_lock<std::mutex> lock(m_shape_warmup_mutex);
+    while (!m_shape_warmup_cv.wait_for(lock, flush_interval, [&] {
+        return m_shape_warmup_stop;
+    })) {
+        lock.unlock();
+        m_shape_warmup_cache->flush();
+        lock.lock();
+    }
+}
+
+void CompiledModel::replay_warmup_shapes() {
+    const auto records = m_shape_warmup_cache->records();
+    if (records.empty()) {
+        return;
+    }
+    // The requests must not own the compiled model: the warmup thread is joined in the destructor
+    std::shared_ptr<const CompiledModel> self(this, [](const CompiledModel*) {});
+    // The runtime cache is per stream, but the requests can't be bound to the streams, so as many requests as streams
+    // are started at once to let the executor spread them. A stream which misses a shape builds it on the first use.
+    std::vector<std::shared_ptr<AsyncInferRequest>> requests(m_graphs.size());
+    for (auto& request : requests) {
+        auto sync_request = std::make_shared<SyncInferRequest>(CompiledModelHolder(self));
+        request = std::make_shared<AsyncInferRequest>(sync_request,
+                                                      get_task_executor(),
+                                                      get_callback_executor(),
+                                                      m_optimized_single_stream);
+    }
+
+    // The inputs are filled with zeros, so a model with data-dependent logic (e.g. NonZero or Loop conditions) may take
+    // other paths and build other primitives than the ones the real data needs.
+    const auto& model_inputs = inputs();
+    for (const auto& shapes : records) {
+        {
+            std::lock_guard<std::mutex> lock(m_shape_warmup_mutex);
+            if (m_shape_warmup_stop) {
+                return;
+            }
+        }
+        for (size_t i = 0; i < model_inputs.size(); i++) {
+            ov::Tensor tensor(model_inputs[i].get_element_type(), shapes[i]);
+            if (model_inputs[i].get_element_type() != ov::element::string) {
+                std::memset(tensor.data(), 0, tensor.get_byte_size());
+            }
+            for (auto& request : requests) {
+                request->set_tensor(model_inputs[i], get_tensor_impl(tensor));
+            }
+        }
+        for (auto& request : requests) {
+            request->start_async();
+        }
+        for (auto& request : requests) {
+            try {
+                request->wait();
+            } catch (const std::exception& e) {
+                // e.g. shapes which are valid for the inputs, but not for the data-dependent model logic
+                DEBUG_LOG("Shape warmup of ", m_name, " failed: ", e.what());
+            }
+        }
+    }
 }
 
 CompiledModel::GraphGuard::Lock CompiledModel::get_graph() const {
     int streamId = 0;
     int socketId = 0;
+    int numaNodeId = 0;
 
     size_t graph_idx = 0;
     if (m_graphs.size() > 1) {
@@ -183,6 +322,7 @@ CompiledModel::GraphGuard::Lock CompiledModel::get_graph() const {
         if (nullptr != streamsExecutor) {
             streamId = streamsExecutor->get_stream_id();
             socketId = std::max(0, streamsExecutor->get_socket_id());
+            numaNodeId = std::max(0, streamsExecutor->get_numa_node_id());
         }
         graph_idx = streamId % m_graphs.size();
     }
@@ -201,7 +341,7 @@ CompiledModel::GraphGuard::Lock CompiledModel::get_graph() const {
                                            ov::pass::low_precision::LowPrecision::isFunctionQuantized(m_model);
                     auto cpuParallel = std::make_shared<CpuParallel>(m_cfg.tbbPartitioner);
                     ctx = std::make_shared<GraphContext>(m_cfg,
-                                                         m_socketWeights[socketId],
+                                                         m_socketWeights.forStream(socketId, numaNodeId),
                                                          isQuantizedFlag,
                                                          streamsExecutor,
                                                          cpuParallel,
@@ -210,6 +350,10 @@ CompiledModel::GraphGuard::Lock CompiledModel::get_graph() const {
 
                 const std::shared_ptr<const ov::Model> model = m_model;
                 graphLock._graph.Init(model, ctx);
+                if (m_packed_weights) {
+                    // the weights must be in place before the primitives are created
+                    m_packed_weights->apply(graphLock._graph, PackedWeights::make_signature(m_cfg.inferencePrecision));
+                }
                 graphLock._graph.Activate();
             } catch (...) {
                 exception = std::current_exception();
@@ -263,6 +407,13 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
     if (name == ov::loaded_from_cache) {
         return m_loaded_from_cache;
     }
+    // locks the graphs of all the streams, so it's handled before the graph of the current stream is locked
+    if (name == ov::intel_cpu::runtime_statistics) {
+        return get_runtime_statistics();
+    }
+    if (name == ov::intel_cpu::kv_cache_memory_size) {
+        return get_kv_cache_memory_size();
+    }
 
     Config engConfig = get_graph()._graph.getConfig();
     auto option = engConfig._config.find(name);
@@ -307,7 +458,9 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
             RO_property(ov::key_cache_precision.name()),
             RO_property(ov::value_cache_precision.name()),
             RO_property(ov::key_cache_group_size.name()),
-            RO_property(ov::value_cache_group_size.name())};
+            RO_property(ov::value_cache_group_size.name()),
+            RO_property(ov::intel_cpu::runtime_statistics.name()),
+            RO_property(ov::intel_cpu::kv_cache_memory_size.name())};
 
         return ro_properties;
     }
@@ -412,8 +565,52 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
     OPENVINO_THROW("Unsupported property: ", name);
 }
 
+decltype(ov::intel_cpu::runtime_statistics)::value_type CompiledModel::get_runtime_statistics() const {
+    CacheStatistics cache_statistics;
+    uint64_t prepare_params = 0;
+    uint64_t output_reallocations = 0;
+    for (auto&& graph : m_graphs) {
+        GraphGuard::Lock graph_lock{graph};
+        if (!graph.IsReady()) {
+            continue;
+        }
+        const auto ctx = graph.getGraphContext();
+        cache_statistics += ctx->getParamsCache()->getStatistics();
+        const auto& dynamic_shape_statistics = ctx->getDynamicShapeStatistics();
+        prepare_params += dynamic_shape_statistics.prepareParams.load(std::memory_order_relaxed);
+        output_reallocations += dynamic_shape_statistics.outputReallocations.load(std::memory_order_relaxed);
+    }
+    return {{"RUNTIME_CACHE_HITS", cache_statistics.hits},
+            {"RUNTIME_CACHE_MISSES", cache_statistics.misses},
+            {"RUNTIME_CACHE_EVICTIONS", cache_statistics.evictions},
+            {"PREPARE_PARAMS", prepare_params},
+            {"OUTPUT_REALLOCATIONS", output_reallocations}};
+}
+
+decltype(ov::intel_cpu::kv_cache_memory_size)::value_type CompiledModel::get_kv_cache_memory_size() const {
+    uint64_t size = 0;
+    for (auto&& graph : m_graphs) {
+        GraphGuard::Lock graph_lock{graph};
+        if (!graph.IsReady()) {
+            continue;
+        }
+        size += graph.getGraphContext()->getStateMemoryStatistics()->kvCacheBytes.load(std::memory_order_relaxed);
+    }
+    return size;
+}
+
 void CompiledModel::export_model(std::ostream& modelStream) const {
-    ModelSerializer serializer(modelStream, m_cfg.cacheEncrypt, m_cfg.m_cache_mode == ov::CacheMode::OPTIMIZE_SIZE);
+    const bool weightless = m_cfg.m_cache_mode == ov::CacheMode::OPTIMIZE_SIZE;
+    // the repacked weights make the blob bigger, so they are stored only when the cache is optimized for speed
+    PackedWeights::Ptr packed_weights;
+    if (!weightless && !m_has_sub_compiled_models) {
+        auto& graph = m_graphs.front();
+        std::lock_guard<std::mutex> lock(graph._mutex);
+        if (graph.IsReady()) {
+            packed_weights = PackedWeights::collect(graph, PackedWeights::make_signature(m_cfg.inferencePrecision));
+        }
+    }
+    ModelSerializer serializer(modelStream, m_cfg.cacheEncrypt, weightless, std::move(packed_weights));
     serializer << m_model;
 }
 
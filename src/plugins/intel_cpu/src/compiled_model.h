@@ -5,11 +5,15 @@
 #pragma once
 
 #include <atomic>
+#include <condition_variable>
+#include <cstdint>
 #include <deque>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <ostream>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -20,10 +24,14 @@
 #include "openvino/core/model.hpp"
 #include "openvino/runtime/icompiled_model.hpp"
 #include "openvino/runtime/iinfer_request.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
 #include "openvino/runtime/iplugin.hpp"
 #include "openvino/runtime/isync_infer_request.hpp"
 #include "openvino/runtime/threading/itask_executor.hpp"
+#include "paged_kv_cache.hpp"
+#include "shape_warmup_cache.hpp"
 #include "sub_memory_manager.hpp"
+#include "utils/graph_serializer/packed_weights.hpp"
 #include "weights_cache.hpp"
 
 namespace ov::intel_cpu {
@@ -44,7 +52,8 @@ public:
                   const std::shared_ptr<const ov::IPlugin>& plugin,
                   Config cfg,
                   bool loaded_from_cache,
-                  std::shared_ptr<SubMemoryManager> sub_memory_manager = nullptr);
+                  std::shared_ptr<SubMemoryManager> sub_memory_manager = nullptr,
+                  PackedWeights::Ptr packed_weights = nullptr);
 
     ~CompiledModel() override;
 
@@ -84,6 +93,8 @@ private:
     std::string m_name;
 
     const bool m_loaded_from_cache;
+    // weights repacked at export time and imported with the blob, must outlive the graphs referring to them
+    const PackedWeights::Ptr m_packed_weights;
     // WARNING: Do not use m_graphs directly.
     mutable std::deque<GraphGuard> m_graphs;
     mutable SocketsWeights m_socketWeights;
@@ -94,14 +105,33 @@ private:
      */
     GraphGuard::Lock get_graph() const;
 
+    // sums the runtime cache and the dynamic shape counters over the graphs of all the streams
+    decltype(ov::intel_cpu::runtime_statistics)::value_type get_runtime_statistics() const;
+    // sums the memory of the KV cache states over the graphs of all the streams
+    decltype(ov::intel_cpu::kv_cache_memory_size)::value_type get_kv_cache_memory_size() const;
+
     std::vector<std::shared_ptr<CompiledModel>> get_sub_compiled_models() const {
         return m_sub_compiled_models;
     }
 
+    void init_shape_warmup_cache();
+    void shape_warmup_routine();
+    void replay_warmup_shapes();
+
     std::vector<std::shared_ptr<CompiledModel>> m_sub_compiled_models;
     std::shared_ptr<SubMemoryManager> m_sub_memory_manager = nullptr;
     bool m_has_sub_compiled_models = false;
     bool m_optimized_single_stream = false;
+
+    // input shapes persisted in ov::cache_dir to warm up the runtime cache after the model is imported
+    ShapeWarmupCache::Ptr m_shape_warmup_cache;
+    std::thread m_shape_warmup_thread;
+    std::mutex m_shape_warmup_mutex;
+    std::condition_variable m_shape_warmup_cv;
+    bool m_shape_warmup_stop = false;
+
+    // the key/value caches and the block tables of a PagedAttention model shared by the infer requests
+    PagedKVCache::Ptr m_paged_kv_cache;
 };
 
 // This class provides safe access to the internal CompiledModel structures and helps to decouple SyncInferRequest and
@@ -152,6 +182,14 @@ public:
         return m_id;
     }
 
+    [[nodiscard]] const ShapeWarmupCache::Ptr& shape_warmup_cache() const {
+        return m_compiled_model->m_shape_warmup_cache;
+    }
+
+    [[nodiscard]] const PagedKVCache::Ptr& paged_kv_cache() const {
+        return m_compiled_model->m_paged_kv_cache;
+    }
+
 private:
     std::shared_ptr<const CompiledModel> m_compiled_model;
     const Graph* m_graph;
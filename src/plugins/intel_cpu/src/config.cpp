@@ -67,6 +67,7 @@ void Config::readProperties(const ov::AnyMap& prop, const ModelType modelType) {
             streams = streamExecutorConfig.get_streams();
             threads = streamExecutorConfig.get_threads();
             threadsPerStream = streamExecutorConfig.get_threads_per_stream();
+            taskScheduling = streamExecutorConfig.get_task_scheduling();
             if (key == ov::num_streams.name()) {
                 ov::Any value = val.as<std::string>();
                 auto streams_value = value.as<ov::streams::Num>();
@@ -232,6 +233,23 @@ void Config::readProperties(const ov::AnyMap& prop, const ModelType modelType) {
                                ov::internal::exclusive_async_requests.name(),
                                ". Expected only true/false");
             }
+        } else if (key == ov::internal::numa_node_id.name()) {
+            try {
+                numaNodeId = val.as<int32_t>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::internal::numa_node_id.name(),
+                               ". Expected only integer numbers");
+            }
+            if (numaNodeId < -1) {
+                OPENVINO_THROW("Wrong value ",
+                               numaNodeId,
+                               " for property key ",
+                               ov::internal::numa_node_id.name(),
+                               ". Expected only -1 or NUMA node id");
+            }
         } else if (key == ov::internal::enable_lp_transformations.name()) {
             try {
                 lpTransformsMode = val.as<bool>() ? LPTransformsMode::On : LPTransformsMode::Off;
@@ -285,6 +303,36 @@ void Config::readProperties(const ov::AnyMap& prop, const ModelType modelType) {
             // as zero that means disabling the cache
             rtCacheCapacity = std::max(val_i, 0);
             snippetsCacheCapacity = std::max(val_i, 0);
+        } else if (ov::intel_cpu::cpu_shape_warmup_cache.name() == key) {
+            try {
+                enableShapeWarmupCache = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::cpu_shape_warmup_cache.name(),
+                               ". Expected only true/false");
+            }
+        } else if (ov::intel_cpu::paged_kv_cache_blocks.name() == key) {
+            try {
+                pagedKvCacheBlocks = val.as<uint64_t>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::paged_kv_cache_blocks.name(),
+                               ". Expected only unsigned integer numbers");
+            }
+        } else if (ov::intel_cpu::weights_numa_policy.name() == key) {
+            try {
+                weightsNumaPolicy = val.as<WeightsNumaPolicy>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::weights_numa_policy.name(),
+                               ". Expected only BIND/REPLICATE/INTERLEAVE");
+            }
         } else if (ov::intel_cpu::denormals_optimization.name() == key) {
             try {
                 denormalsOptMode = val.as<bool>() ? DenormalsOptMode::DO_On : DenormalsOptMode::DO_Off;
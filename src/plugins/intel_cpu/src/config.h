@@ -13,6 +13,7 @@
 #include <string>
 #include <vector>
 
+#include "internal_properties.hpp"
 #include "openvino/core/any.hpp"
 #include "openvino/core/attribute_visitor.hpp"
 #include "openvino/core/type/element_type.hpp"
@@ -52,6 +53,7 @@ struct Config {
 
     bool collectPerfCounters = false;
     bool exclusiveAsyncRequests = false;
+    int numaNodeId = -1;
     SnippetsMode snippetsMode = SnippetsMode::Enable;
     std::string dumpToDot;
     std::string device_id;
@@ -73,6 +75,9 @@ struct Config {
     size_t rtCacheCapacity = 5000UL;
 #endif
     size_t snippetsCacheCapacity = 5000UL;
+    bool enableShapeWarmupCache = false;
+    uint64_t pagedKvCacheBlocks = 0;
+    WeightsNumaPolicy weightsNumaPolicy = WeightsNumaPolicy::BIND;
 #if defined(OPENVINO_ARCH_X86_64) || defined(OPENVINO_ARCH_ARM64)
     ov::element::Type kvCachePrecision = ov::element::u8;
     ov::element::Type keyCachePrecision = ov::element::u8;
@@ -92,6 +97,8 @@ struct Config {
     bool streamsChanged = false;
     int threads = 0;
     int threadsPerStream = 0;
+    ov::threading::IStreamsExecutor::Config::TaskScheduling taskScheduling =
+        ov::threading::IStreamsExecutor::Config::TaskScheduling::SHARED_QUEUE;
     ov::hint::PerformanceMode hintPerfMode = ov::hint::PerformanceMode::LATENCY;
     std::vector<std::vector<int>> streamsRankTable;
     bool changedHintPerfMode = false;
@@ -17,6 +17,7 @@
 #include <exception>
 #include <functional>
 #include <limits>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <numeric>
@@ -38,6 +39,7 @@
 #include "utils/debug_capabilities.h"
 #include "utils/general_utils.h"
 #if defined(__linux__)
+#    include <sys/syscall.h>
 #    include <unistd.h>
 
 #    include <cstring> /* strerror(errno) */
@@ -557,10 +559,11 @@ void StaticMemory::StaticMemoryBlock::unregisterMemory(Memory* memPtr) {
 }
 
 #if defined(__linux__)
-#    define MPOL_DEFAULT   0
-#    define MPOL_BIND      2
-#    define MPOL_MF_STRICT (1 << 0)
-#    define MPOL_MF_MOVE   (1 << 1)
+#    define MPOL_DEFAULT    0
+#    define MPOL_BIND       2
+#    define MPOL_INTERLEAVE 3
+#    define MPOL_MF_STRICT  (1 << 0)
+#    define MPOL_MF_MOVE    (1 << 1)
 #    if !defined(__NR_mbind)
 #        define NR_mbind 237
 #    else
@@ -578,12 +581,17 @@ static int64_t mbind(void* start, uint64_t len, int mode, const uint64_t* nmask,
 #endif
 
 #if defined(__linux__)
+// the whole pages covering [data, data + size): the first page and the length of the span
+static std::pair<void*, uint64_t> page_span(void* data, size_t size) {
+    const auto pagesize = static_cast<uintptr_t>(getpagesize());
+    const auto begin = reinterpret_cast<uintptr_t>(data) & ~(pagesize - 1);
+    const auto end = (reinterpret_cast<uintptr_t>(data) + size + pagesize - 1) & ~(pagesize - 1);
+    return {reinterpret_cast<void*>(begin), end - begin};  // NOLINT(performance-no-int-to-ptr)
+}
+
 bool mbind_move(void* data, size_t size, int targetNode) {
     int realNode = ov::get_org_numa_id(targetNode);
-    auto pagesize = getpagesize();
-    auto page_count = (size + pagesize - 1) / pagesize;
-    auto* pages = reinterpret_cast<char*>(  // NOLINT(performance-no-int-to-ptr)
-        ((reinterpret_cast<uintptr_t>(data)) & ~(static_cast<uintptr_t>(pagesize - 1))));
+    const auto pages = page_span(data, size);
     uint64_t mask = 0;
     unsigned flags = 0;
     if (realNode < 0) {
@@ -595,17 +603,90 @@ bool mbind_move(void* data, size_t size, int targetNode) {
         flags = MPOL_MF_MOVE | MPOL_MF_STRICT;
     }
 
-    auto rc = mbind(pages, page_count * pagesize, MPOL_BIND, &mask, sizeof(mask) * 8, flags);
+    auto rc = mbind(pages.first, pages.second, MPOL_BIND, &mask, sizeof(mask) * 8, flags);
+    if (rc < 0) {
+        DEBUG_LOG("mbind failed: ", strerror(errno));
+        return false;
+    }
+    return true;
+}
+
+bool mbind_interleave(void* data, size_t size) {
+    std::vector<int> nodes;
+    for (int node = 0; node < get_num_numa_nodes(); node++) {
+        const int realNode = ov::get_org_numa_id(node);
+        if (realNode >= 0) {
+            nodes.push_back(realNode);
+        }
+    }
+    if (nodes.empty()) {
+        return false;
+    }
+    // the nodemask spans as many 64-bit words as the highest node id needs
+    constexpr size_t bits_per_word = sizeof(uint64_t) * 8;
+    const auto max_node = static_cast<size_t>(*std::max_element(nodes.begin(), nodes.end()));
+    std::vector<uint64_t> mask(max_node / bits_per_word + 1, 0);
+    for (const auto node : nodes) {
+        mask[node / bits_per_word] |= uint64_t{1} << (node % bits_per_word);
+    }
+
+    // the kernel reads maxnode - 1 bits of the nodemask, as libnuma accounts for
+    const auto maxnode = mask.size() * bits_per_word + 1;
+    const auto pages = page_span(data, size);
+    auto rc = mbind(pages.first, pages.second, MPOL_INTERLEAVE, mask.data(), maxnode, MPOL_MF_MOVE);
     if (rc < 0) {
         DEBUG_LOG("mbind failed: ", strerror(errno));
         return false;
     }
     return true;
 }
+
+std::map<int, size_t> numa_resident_size(const void* data, size_t size) {
+    std::map<int, size_t> result;
+#    if defined(__NR_move_pages)
+    if (data == nullptr || size == 0) {
+        return result;
+    }
+    const auto pagesize = static_cast<size_t>(getpagesize());
+    const auto begin = reinterpret_cast<uintptr_t>(data) & ~(static_cast<uintptr_t>(pagesize - 1));
+    const auto end = reinterpret_cast<uintptr_t>(data) + size;
+    // move_pages without the target nodes only queries the node of each page
+    constexpr size_t batch = 1024;
+    std::vector<void*> pages;
+    std::vector<int> status;
+    pages.reserve(batch);
+    for (auto page = begin; page < end;) {
+        pages.clear();
+        for (; page < end && pages.size() < batch; page += pagesize) {
+            pages.push_back(reinterpret_cast<void*>(page));  // NOLINT(performance-no-int-to-ptr)
+        }
+        status.assign(pages.size(), -1);
+        if (syscall(__NR_move_pages, 0, pages.size(), pages.data(), nullptr, status.data(), 0) < 0) {
+            DEBUG_LOG("move_pages failed: ", strerror(errno));
+            return {};
+        }
+        for (const auto node : status) {
+            // negative status means the page is not resident
+            if (node >= 0) {
+                result[node] += pagesize;
+            }
+        }
+    }
+#    endif
+    return result;
+}
 #else
 bool mbind_move(void* data, size_t size, int targetNode) {
     return false;
 }
+
+bool mbind_interleave(void* data, size_t size) {
+    return false;
+}
+
+std::map<int, size_t> numa_resident_size(const void* data, size_t size) {
+    return {};
+}
 #endif
 
 bool mbind_move(const MemoryCPtr& mem, int numaNodeID) {
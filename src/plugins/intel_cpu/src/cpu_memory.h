@@ -7,6 +7,7 @@
 #include <cpu_shape.h>
 
 #include <cstddef>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <oneapi/dnnl/dnnl.hpp>
@@ -448,6 +449,10 @@ using StringMemoryPtr = std::shared_ptr<StringMemory>;
 bool mbind_move(void* data, size_t size, int targetNode);
 bool mbind_move(const MemoryCPtr& mem, int numaNodeID);
 bool mbind_move(const dnnl::memory& mem, int numaNodeID);
+// spreads the pages over all the NUMA nodes the process can use
+bool mbind_interleave(void* data, size_t size);
+// returns the number of resident bytes per NUMA node id
+std::map<int, size_t> numa_resident_size(const void* data, size_t size);
 
 MemoryPtr split_horizontal(const dnnl::engine& eng,
                            const MemoryPtr& src,
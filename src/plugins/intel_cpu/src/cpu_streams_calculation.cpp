@@ -1208,7 +1208,7 @@ void get_num_streams(const int streams, const std::shared_ptr<ov::Model>& model,
         std::lock_guard<std::mutex> lock{_streams_executor_mutex};
         std::vector<std::vector<int>> proc_type_table = get_proc_type_table();
 
-        generate_stream_info(streams, -1, model, config, proc_type_table);
+        generate_stream_info(streams, config.numaNodeId, model, config, proc_type_table);
     }
 }
 
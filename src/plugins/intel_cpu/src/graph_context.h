@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstdint>
 #include <memory>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <vector>
@@ -27,6 +29,21 @@ class MemoryStatesRegister;
 class MemoryControl;
 class NetworkMemoryControl;
 
+/**
+ * @brief Counters of the work caused by the input shape changes, they are summed over the graph and its subgraphs
+ */
+struct DynamicShapeStatistics {
+    std::atomic<uint64_t> prepareParams{0};        // number of the prepareParams() calls
+    std::atomic<uint64_t> outputReallocations{0};  // number of the output memory blocks allocated again
+};
+
+/**
+ * @brief Memory held by the KV cache states of the graph, summed over all the infer requests
+ */
+struct StateMemoryStatistics {
+    std::atomic<uint64_t> kvCacheBytes{0};  // kv caches with their spare room, beam tables, scales and zero points
+};
+
 class GraphContext {
 public:
     using Ptr = std::shared_ptr<GraphContext>;
@@ -51,6 +68,15 @@ public:
         return m_rtParamsCache;
     }
 
+    [[nodiscard]] DynamicShapeStatistics& getDynamicShapeStatistics() const {
+        return m_dynamicShapeStatistics;
+    }
+
+    // shared with the states, since a state may outlive the graph
+    [[nodiscard]] const std::shared_ptr<StateMemoryStatistics>& getStateMemoryStatistics() const {
+        return m_stateMemoryStatistics;
+    }
+
     [[nodiscard]] MultiCachePtr getSnippetsParamsCache() const {
         return m_snippetsParamsCache;
     }
@@ -117,6 +143,8 @@ private:
     // primitive cache
     MultiCachePtr m_rtParamsCache;
     MultiCachePtr m_snippetsParamsCache;
+    mutable DynamicShapeStatistics m_dynamicShapeStatistics;
+    std::shared_ptr<StateMemoryStatistics> m_stateMemoryStatistics = std::make_shared<StateMemoryStatistics>();
     // global scratch pad
     DnnlScratchPadPtr m_rtScratchPad;
 
@@ -4,7 +4,9 @@
 
 #include "infer_request.h"
 
+#include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <exception>
 #include <functional>
 #include <map>
@@ -64,6 +66,12 @@ SyncInferRequest::SyncInferRequest(CompiledModelHolder compiled_model)
     create_infer_request();
 }
 
+SyncInferRequest::~SyncInferRequest() {
+    if (const auto& paged_kv_cache = m_compiled_model.paged_kv_cache()) {
+        paged_kv_cache->release(m_paged_sequences);
+    }
+}
+
 void SyncInferRequest::create_infer_request() {
     m_profiling_task = openvino::itt::handle("SyncInferenceCPU::infer::" + m_compiled_model.name());
 
@@ -90,16 +98,6 @@ void SyncInferRequest::redefine_memory_for_input_nodes(Graph& graph) {
     }
 }
 
-void SyncInferRequest::update_external_tensor_ptrs() {
-    // Update it due to batched_tensors case will update input tensor
-    for (const auto& input : m_input_ports_map) {
-        if (m_input_external_ptr.find(input.first) != m_input_external_ptr.end()) {
-            const auto& tensor = get_tensor_ptr(input.second);
-            m_input_external_ptr[input.first] = tensor;
-        }
-    }
-}
-
 void SyncInferRequest::infer() {
     OV_ITT_SCOPED_TASK_BASE(itt::domains::ov_cpu_inference, m_profiling_task);
     auto graphLock = m_compiled_model.lock();
@@ -113,39 +111,66 @@ void SyncInferRequest::infer() {
         return;
     }
 
-    convert_batched_tensors();
-    if (!m_batched_tensors.empty()) {
-        // batched_tensors will be updated for each infer, external_ptr should be update together
-        update_external_tensor_ptrs();
-    }
+    const auto& paged_kv_cache = m_compiled_model.paged_kv_cache();
+    // the tokens registered for the paged KV cache are dropped if the inference doesn't complete, so they don't
+    // corrupt the next inference of the sequences
+    try {
+        if (paged_kv_cache) {
+            paged_kv_cache->prepare(*this, m_paged_sequences);
+        }
 
-    if (graph.hasDynamicInput()) {
-        redefine_memory_for_input_nodes(graph);
-    }
+        convert_batched_tensors();
+
+        if (graph.hasDynamicInput()) {
+            redefine_memory_for_input_nodes(graph);
+            if (const auto& shape_warmup_cache = m_compiled_model.shape_warmup_cache()) {
+                record_input_shapes(*shape_warmup_cache);
+            }
+        }
 
-    change_default_ptr(graph);
+        change_default_ptr(graph);
 
-    throw_if_canceled();
+        throw_if_canceled();
 
-    // state -> node
-    if (!m_memory_states.empty()) {
-        graph.assignStates(m_memory_states);
-    }
+        // state -> node
+        if (!m_memory_states.empty()) {
+            graph.assignStates(m_memory_states);
+        }
 
-    push_input_data(graph);
+        push_input_data(graph);
 
-    graph.Infer(this);
+        graph.Infer(this);
 
-    throw_if_canceled();
+        throw_if_canceled();
 
-    // update output control blocks, if any, in order to refresh internal buffers
-    if (graph.IsDynamic()) {
-        for (auto&& item : m_outputControlBlocks) {
-            item.second.update();
+        // update output control blocks, if any, in order to refresh internal buffers
+        if (graph.IsDynamic()) {
+            for (auto&& item : m_outputControlBlocks) {
+                item.second.update();
+            }
+        }
+
+        graph.PullOutputData(m_outputs);
+    } catch (...) {
+        if (paged_kv_cache) {
+            paged_kv_cache->rollback(m_paged_sequences);
         }
+        throw;
     }
 
-    graph.PullOutputData(m_outputs);
+    if (paged_kv_cache) {
+        paged_kv_cache->commit(m_paged_sequences);
+    }
+}
+
+void SyncInferRequest::record_input_shapes(ShapeWarmupCache& cache) const {
+    const auto& inputs = get_inputs();
+    ShapeWarmupCache::Record shapes;
+    shapes.reserve(inputs.size());
+    for (const auto& port : inputs) {
+        shapes.push_back(get_tensor(port)->get_shape());
+    }
+    cache.record(shapes);
 }
 
 std::vector<ov::ProfilingInfo> SyncInferRequest::get_profiling_info() const {
@@ -153,10 +178,21 @@ std::vector<ov::ProfilingInfo> SyncInferRequest::get_profiling_info() const {
     OPENVINO_ASSERT(graph.IsReady(), "Graph is not ready!");
     std::vector<ov::ProfilingInfo> perfMap;
     graph.GetPerfData(perfMap);
+    for (const auto& [index, copy] : m_input_copies) {
+        auto inputNode = graph.getInputNodeByIndex(index);
+        OPENVINO_ASSERT(inputNode, "CPU execution graph doesn't contain input node with index: ", index);
+        ov::ProfilingInfo pc;
+        pc.node_name = inputNode->getName();
+        pc.node_type = "InputCopy";
+        pc.exec_type = copy.reason;
+        pc.cpu_time = pc.real_time = copy.time;
+        pc.status = ov::ProfilingInfo::Status::EXECUTED;
+        perfMap.emplace_back(pc);
+    }
     return perfMap;
 }
 
-static inline void change_edge_ptr(const EdgePtr& edge, ov::SoPtr<ov::ITensor>& tensor) {
+static inline void change_edge_ptr(const EdgePtr& edge, const ov::SoPtr<ov::ITensor>& tensor) {
     auto mem = edge->getMemoryPtr();
     OPENVINO_ASSERT(mem, "Edge with name '", *edge, "' doesn't have allocated memory object.");
 
@@ -171,65 +207,131 @@ static inline void change_edge_ptr(const EdgePtr& edge, ov::SoPtr<ov::ITensor>&
     }
 }
 
+// switches the edge back to its own buffer, so the data copied into the graph doesn't overwrite the user tensor
+// bound on the previous inference
+static inline void restore_edge_ptr(const EdgePtr& edge) {
+    auto mem = edge->getMemoryPtr();
+    OPENVINO_ASSERT(mem, "Edge with name '", *edge, "' doesn't have allocated memory object.");
+
+    if (mem->getDesc().getPrecision() == element::string) {
+        auto memBlock = dynamic_cast<StringMemory*>(mem.get())->getStringMemoryBlockPtr();
+        OPENVINO_ASSERT(memBlock);
+        memBlock->setExtBuff(nullptr, 0);
+        memBlock->resize(mem->getShape().getElementsCount());
+    } else {
+        auto memBlock = mem->getMemoryBlock();
+        OPENVINO_ASSERT(memBlock);
+        memBlock->setExtBuff(nullptr, 0);
+        memBlock->resize(mem->getSize());
+    }
+}
+
+// returns the reason why the user tensor cannot be bound to the input node memory, nullptr if it can
+static const char* input_copy_reason(const NodePtr& inputNode, const ov::SoPtr<ov::ITensor>& tensor) {
+    const auto& childEdges = inputNode->getChildEdges();
+    // Perform checks that the user's memory will not be modified
+    for (const auto& childEdge : childEdges) {
+        auto ce = childEdge.lock();
+        OPENVINO_ASSERT(ce, "Node ", inputNode->getName(), " contains empty child edge");
+        const auto& child = ce->getChild();
+
+        if (child->isConstant()) {
+            return "constant consumer";
+        }
+
+        // the input memory should be referenced by the children, otherwise it should be written to a
+        // specific location
+        if (ce->inPlace(Edge::LOOK_DOWN)) {
+            return "in-place consumer";
+        }
+
+        if (ce->modifiedInPlace()) {
+            return "modified in-place";
+        }
+
+        if (child->getType() == Type::Concatenation && child->isInPlace()) {
+            return "in-place concatenation";
+        }
+    }
+    if (childEdges.empty()) {
+        return nullptr;
+    }
+
+    const auto& actualDesc = inputNode->getChildEdgeAt(0)->getMemory().getDesc();
+    if (actualDesc.getPrecision() != tensor->get_element_type()) {
+        return "precision mismatch";
+    }
+    if (!actualDesc.isDefined() || !actualDesc.isCompatible(*MemoryDescUtils::generateCpuBlockedMemoryDesc(tensor))) {
+        return "layout mismatch";
+    }
+    // the kernels may access the elements directly, so the data must be aligned at least to the element size
+    const auto& precision = tensor->get_element_type();
+    const size_t alignment = precision.bitwidth() < 8 ? 1 : precision.size();
+    if (reinterpret_cast<uintptr_t>(tensor->data()) % alignment != 0) {
+        return "misaligned data";
+    }
+    return nullptr;
+}
+
 void SyncInferRequest::change_default_ptr(Graph& graph) {
     std::unordered_set<const void*> inputPtrs;
-    std::function<void(const EdgePtr& edge, ov::SoPtr<ov::ITensor>& tensor)> changeInpPtr;
+    std::function<void(const EdgePtr& edge, const ov::SoPtr<ov::ITensor>& tensor)> changeInpPtr;
     if (graph.IsDynamic()) {
-        changeInpPtr = [&inputPtrs](const EdgePtr& edge, ov::SoPtr<ov::ITensor>& tensor) {
+        changeInpPtr = [&inputPtrs](const EdgePtr& edge, const ov::SoPtr<ov::ITensor>& tensor) {
             change_edge_ptr(edge, tensor);
             inputPtrs.insert(tensor->data());
         };
     } else {
-        changeInpPtr = [](const EdgePtr& edge, ov::SoPtr<ov::ITensor>& tensor) {
+        changeInpPtr = [](const EdgePtr& edge, const ov::SoPtr<ov::ITensor>& tensor) {
             change_edge_ptr(edge, tensor);
         };
     }
 
-    for (auto& it : m_input_external_ptr) {
-        auto inputNodePtr = graph.getInputNodeByIndex(it.first);
-        OPENVINO_ASSERT(inputNodePtr, "Cannot find input tensor with index: ", it.first);
-        if (inputNodePtr->getDstDataAtPort(0) == it.second->data()) {
+    // any user tensor matching the memory descriptor of the input node is bound to the graph, the rest is copied
+    for (const auto& input : m_input_ports_map) {
+        const auto& tensor = get_tensor_ptr(input.second);
+        auto inputNodePtr = graph.getInputNodeByIndex(input.first);
+        OPENVINO_ASSERT(inputNodePtr, "Cannot find input tensor with index: ", input.first);
+        if (tensor->get_size() == 0) {
             continue;
         }
+        if (inputNodePtr->getDstDataAtPort(0) == tensor->data()) {
+            continue;
+        }
+        auto& binding = m_input_bindings[input.first];
+        if (binding.graph != &graph || binding.tensor.lock() != tensor._ptr || binding.data != tensor->data() ||
+            binding.shape != tensor->get_shape()) {
+            binding = {&graph,
+                       tensor._ptr,
+                       tensor->data(),
+                       tensor->get_shape(),
+                       input_copy_reason(inputNodePtr, tensor)};
+        }
         const auto& childEdges = inputNodePtr->getChildEdges();
-        // Perform checks that the user's memory will not be modified
-        bool canBeInPlace = true;
-        for (const auto& childEdge : childEdges) {
-            auto ce = childEdge.lock();
-            OPENVINO_ASSERT(ce, "Node ", inputNodePtr->getName(), " contains empty child edge");
-            const auto& child = ce->getChild();
-
-            if (child->isConstant()) {
-                canBeInPlace = false;
-                break;
-            }
-
-            // the input memory should be referenced by the children, otherwise it should be written to a
-            // specific location
-            if (ce->inPlace(Edge::LOOK_DOWN)) {
-                canBeInPlace = false;
-                break;
-            }
-
-            if (auto result = ce->modifiedInPlace()) {
-                canBeInPlace = false;
-                break;
-            }
-
-            if (child->getType() == Type::Concatenation && child->isInPlace()) {
-                canBeInPlace = false;
-                break;
+        if (const auto* reason = binding.copy_reason) {
+            if (m_bound_inputs.erase(input.first)) {
+                // the edges sharing the memory block are switched together
+                const void* boundPtr = inputNodePtr->getDstDataAtPort(0);
+                for (const auto& edge : childEdges) {
+                    auto e = edge.lock();
+                    OPENVINO_ASSERT(e, "Node ", inputNodePtr->getName(), " contains empty child edge");
+                    if (e->getMemory().getData() == boundPtr) {
+                        restore_edge_ptr(e);
+                    }
+                }
             }
+            m_input_copies[input.first].reason = reason;
+            continue;
         }
-        if (canBeInPlace) {
-            for (const auto& edge : childEdges) {
-                auto e = edge.lock();
-                if (!e) {
-                    OPENVINO_THROW("Node ", inputNodePtr->getName(), " contains empty child edge");
-                }
-                changeInpPtr(e, it.second);
+        for (const auto& edge : childEdges) {
+            auto e = edge.lock();
+            if (!e) {
+                OPENVINO_THROW("Node ", inputNodePtr->getName(), " contains empty child edge");
             }
+            changeInpPtr(e, tensor);
         }
+        m_bound_inputs.insert(input.first);
+        m_input_copies.erase(input.first);
     }
 
     for (auto& it : m_output_external_ptr) {
@@ -370,7 +472,6 @@ void SyncInferRequest::set_tensor(const ov::Output<const ov::Node>& in_port, con
         tensor = ov::make_tensor(in_tensor->get_element_type(), in_port.get_shape(), in_tensor->data());
     }
     auto port_found = find_port(in_port);
-    auto mem_desc_ptr = MemoryDescUtils::generateCpuBlockedMemoryDesc(tensor);
     if (port_found.is_input()) {
         auto input_index = port_found.idx;
         const auto netInPrc = port.get_element_type();
@@ -400,26 +501,7 @@ void SyncInferRequest::set_tensor(const ov::Output<const ov::Node>& in_port, con
                         " and the tensor size = ",
                         tensor->get_size(),
                         " are different.");
-
-        auto&& graph = m_compiled_model.graph();
-
-        auto inputNode = graph.getInputNodeByIndex(input_index);
-        OPENVINO_ASSERT(inputNode, "CPU execution graph doesn't contain input node with index: ", input_index);
-
-        MemoryDescPtr actualDesc = inputNode->getBaseMemDescAtOutputPort(0);
-        if (!actualDesc->isDefined()) {
-            // we must define desc for dynamic case
-            // otherwise we got incorrect check on shape compatibility inside isCompatible
-            // because lower and upper bound will be compared
-            actualDesc = actualDesc->cloneWithNewDims(
-                ov::is_scalar(tensor->get_shape()) ? VectorDims{1} : VectorDims{tensor->get_shape()});
-        }
-
-        if (actualDesc->isCompatible(*mem_desc_ptr)) {
-            m_input_external_ptr[input_index] = tensor;
-        } else if (m_input_external_ptr.find(input_index) != m_input_external_ptr.end()) {
-            m_input_external_ptr.erase(input_index);
-        }
+        // whether the tensor is bound to the graph or copied is decided on each inference, see change_default_ptr
     } else {
         auto output_index = port_found.idx;
         const auto netOutPrc = port.get_element_type();
@@ -454,6 +536,7 @@ void SyncInferRequest::set_tensor(const ov::Output<const ov::Node>& in_port, con
 
         auto outputNode = graph.getOutputNodeByIndex(output_index);
         OPENVINO_ASSERT(outputNode, "CPU execution graph doesn't contain output node with index: ", output_index);
+        auto mem_desc_ptr = MemoryDescUtils::generateCpuBlockedMemoryDesc(tensor);
         const auto& desc = outputNode->getParentEdgeAt(0)->getMemory().getDesc();
         if (!isDynamic && mem_desc_ptr->isCompatible(desc)) {
             m_output_external_ptr[output_index] = tensor;
@@ -504,15 +587,6 @@ void SyncInferRequest::init_tensor(const std::size_t& port_index, const ov::ISyn
 
             tensor = ov::make_tensor(port.get_element_type(), tensor_shape);
             ov::ISyncInferRequest::set_tensor(port, tensor);
-
-            if (!isDynamic) {
-                auto mem_desc_ptr = MemoryDescUtils::generateCpuBlockedMemoryDesc(tensor);
-                auto inputNode = graph.getInputNodeByIndex(port_index);
-                OPENVINO_ASSERT(inputNode, "CPU execution graph doesn't contain input node with index: ", port_index);
-                if (mem_desc_ptr->isCompatible(inputNode->getChildEdgeAt(0)->getMemory().getDesc())) {
-                    m_input_external_ptr[port_index] = tensor;
-                }
-            }
         }
     }
 
@@ -598,9 +672,18 @@ void SyncInferRequest::init_tensor(const std::size_t& port_index, const ov::ISyn
 }
 
 void SyncInferRequest::push_input_data(Graph& graph) {
+    const bool perfCount = graph.getConfig().collectPerfCounters;
     for (auto& input : m_input_ports_map) {
         const auto& tensor = get_tensor_ptr(input.second);
+        auto copy = m_input_copies.find(input.first);
+        if (!perfCount || copy == m_input_copies.end()) {
+            graph.PushInputData(input.first, tensor);
+            continue;
+        }
+        const auto start = std::chrono::steady_clock::now();
         graph.PushInputData(input.first, tensor);
+        copy->second.time =
+            std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
     }
 }
 
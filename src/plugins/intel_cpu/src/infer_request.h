@@ -5,9 +5,11 @@
 #pragma once
 
 #include <array>
+#include <chrono>
 #include <cstddef>
 #include <memory>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include "compiled_model.h"
@@ -18,6 +20,7 @@
 #include "memory_state.h"
 #include "openvino/core/node.hpp"
 #include "openvino/core/node_output.hpp"
+#include "openvino/core/shape.hpp"
 #include "openvino/core/type/element_type.hpp"
 #include "openvino/itt.hpp"
 #include "openvino/runtime/isync_infer_request.hpp"
@@ -25,7 +28,9 @@
 #include "openvino/runtime/ivariable_state.hpp"
 #include "openvino/runtime/profiling_info.hpp"
 #include "openvino/runtime/so_ptr.hpp"
+#include "paged_kv_cache.hpp"
 #include "proxy_mem_blk.h"
+#include "shape_warmup_cache.hpp"
 
 namespace ov::intel_cpu {
 
@@ -35,6 +40,8 @@ class SyncInferRequest : public ov::ISyncInferRequest {
 public:
     explicit SyncInferRequest(CompiledModelHolder compiled_model);
 
+    ~SyncInferRequest() override;
+
     void infer() override;
 
     std::vector<ov::ProfilingInfo> get_profiling_info() const override;
@@ -112,7 +119,7 @@ private:
 
     void push_input_data(Graph& graph);
     void redefine_memory_for_input_nodes(Graph& graph);
-    void update_external_tensor_ptrs();
+    void record_input_shapes(ShapeWarmupCache& cache) const;
     void change_default_ptr(Graph& graph);
 
     const ov::Output<const ov::Node>& get_internal_port(const ov::Output<const ov::Node>& port) const;
@@ -121,11 +128,31 @@ private:
 
     std::unordered_map<std::size_t, OutputControlBlock> m_outputControlBlocks;
 
-    std::unordered_map<std::size_t, ov::SoPtr<ov::ITensor>> m_input_external_ptr;
+    // the input is copied into the graph memory instead of binding the user tensor, reported as a perf counter
+    struct InputCopy {
+        const char* reason = nullptr;
+        std::chrono::microseconds time{0};
+    };
+
+    // the binding decision made for the last user tensor of the input, the memory descriptor compatibility is checked
+    // again only once another tensor, data pointer or shape is set
+    struct InputBinding {
+        const Graph* graph = nullptr;
+        std::weak_ptr<ov::ITensor> tensor;
+        const void* data = nullptr;
+        ov::Shape shape;
+        const char* copy_reason = nullptr;
+    };
+
+    std::unordered_map<std::size_t, InputCopy> m_input_copies;
+    std::unordered_map<std::size_t, InputBinding> m_input_bindings;
+    std::unordered_set<std::size_t> m_bound_inputs;
     std::unordered_map<std::size_t, ov::SoPtr<ov::ITensor>> m_output_external_ptr;
 
     openvino::itt::handle_t m_profiling_task = nullptr;
     std::vector<MemStatePtr> m_memory_states;
+    // the sequence in each batch position of a PagedAttention model with the caches managed by the plugin
+    PagedKVCache::Sequences m_paged_sequences;
     AsyncInferRequest* m_asyncRequest = nullptr;
     CompiledModelHolder m_compiled_model;
 
@@ -20,6 +20,21 @@ namespace ov::intel_cpu {
  */
 static constexpr Property<int32_t, PropertyMutability::RW> cpu_runtime_cache_capacity{"CPU_RUNTIME_CACHE_CAPACITY"};
 
+/**
+ * @brief Defines whether the input shapes of a dynamic model are recorded next to the compiled blobs in ov::cache_dir and
+ * replayed in the background when the model is imported from the cache, so the CPU runtime parameters cache is warm
+ * after a process restart. The shapes are replayed with zero filled inputs.
+ */
+static constexpr Property<bool, PropertyMutability::RW> cpu_shape_warmup_cache{"CPU_SHAPE_WARMUP_CACHE"};
+
+/**
+ * @brief Defines the number of the key/value cache blocks allocated and managed by the plugin for a PagedAttention
+ * model. The block tables are built by the plugin and the prompt prefixes are shared by the sequences of all the infer
+ * requests of the compiled model. Zero disables the management, the caches and the block tables are then provided by
+ * the application.
+ */
+static constexpr Property<uint64_t, PropertyMutability::RW> paged_kv_cache_blocks{"CPU_PAGED_KV_CACHE_BLOCKS"};
+
 /**
  * @brief Enum to define possible snippets mode hints.
  */
@@ -67,6 +82,53 @@ inline std::istream& operator>>(std::istream& is, SnippetsMode& mode) {
  */
 static constexpr Property<SnippetsMode, PropertyMutability::RW> snippets_mode{"SNIPPETS_MODE"};
 
+/**
+ * @brief Enum to define the placement of the weights repacked by the CPU plugin on NUMA systems.
+ */
+enum class WeightsNumaPolicy : uint8_t {
+    BIND = 0,        //!<  One copy per socket, bound to the NUMA node of the stream executing the node
+    REPLICATE = 1,   //!<  One copy per NUMA node, placed on that node
+    INTERLEAVE = 2,  //!<  One copy for all the streams, pages interleaved over all the NUMA nodes
+};
+
+/** @cond INTERNAL */
+inline std::ostream& operator<<(std::ostream& os, const WeightsNumaPolicy& policy) {
+    switch (policy) {
+    case WeightsNumaPolicy::BIND:
+        return os << "BIND";
+    case WeightsNumaPolicy::REPLICATE:
+        return os << "REPLICATE";
+    case WeightsNumaPolicy::INTERLEAVE:
+        return os << "INTERLEAVE";
+    default:
+        OPENVINO_THROW("Unsupported weights NUMA policy value");
+    }
+}
+
+inline std::istream& operator>>(std::istream& is, WeightsNumaPolicy& policy) {
+    std::string str;
+    is >> str;
+    if (str == "BIND") {
+        policy = WeightsNumaPolicy::BIND;
+    } else if (str == "REPLICATE") {
+        policy = WeightsNumaPolicy::REPLICATE;
+    } else if (str == "INTERLEAVE") {
+        policy = WeightsNumaPolicy::INTERLEAVE;
+    } else {
+        OPENVINO_THROW("Unsupported weights NUMA policy: ", str);
+    }
+    return is;
+}
+/** @endcond */
+
+/**
+ * @brief Define the NUMA placement of the repacked weights shared by the streams.
+ * @param BIND - the weights are shared per socket and moved to the NUMA node of the stream executing the node
+ * @param REPLICATE - each NUMA node keeps its own copy, first touched on that node
+ * @param INTERLEAVE - a single copy with the pages interleaved over the NUMA nodes, never moved
+ */
+static constexpr Property<WeightsNumaPolicy, PropertyMutability::RW> weights_numa_policy{"CPU_WEIGHTS_NUMA_POLICY"};
+
 /**
  * @brief This property used to test accurcay of setting model_distribution_policy to TENSOR_PARALLEL in functional
  * tests.
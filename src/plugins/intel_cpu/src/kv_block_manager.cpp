@@ -0,0 +1,326 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "kv_block_manager.hpp"
+
+#include <algorithm>
+#include <common/utils.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <vector>
+
+#include "openvino/core/except.hpp"
+#include "openvino/runtime/tensor.hpp"
+
+namespace ov::intel_cpu {
+
+KVBlockManager::KVBlockManager(size_t num_blocks, size_t block_size, bool enable_prefix_caching)
+    : m_block_size(block_size),
+      m_enable_prefix_caching(enable_prefix_caching),
+      m_blocks(num_blocks) {
+    OPENVINO_ASSERT(num_blocks > 0 && num_blocks <= static_cast<size_t>(INT32_MAX),
+                    "KVBlockManager: unsupported number of blocks ",
+                    num_blocks);
+    OPENVINO_ASSERT(block_size > 0, "KVBlockManager: block size must be positive");
+    m_free_blocks.reserve(num_blocks);
+    // keep the lowest block ids at the back to hand them out first
+    for (size_t i = num_blocks; i > 0; i--) {
+        m_free_blocks.push_back(static_cast<int32_t>(i - 1));
+    }
+}
+
+size_t KVBlockManager::block_hash(size_t prev_hash, const Token* tokens) const {
+    size_t seed = prev_hash;
+    for (size_t i = 0; i < m_block_size; i++) {
+        seed = dnnl::impl::hash_combine(seed, tokens[i]);
+    }
+    return seed;
+}
+
+int32_t KVBlockManager::allocate_block() {
+    int32_t block_id = -1;
+    if (!m_free_blocks.empty()) {
+        block_id = m_free_blocks.back();
+        m_free_blocks.pop_back();
+    } else {
+        OPENVINO_ASSERT(!m_lru_blocks.empty(), "KVBlockManager: out of KV cache blocks");
+        block_id = m_lru_blocks.front();
+        m_lru_blocks.pop_front();
+        auto& block = m_blocks[block_id];
+        auto found = m_prefix_map.find(block.hash);
+        if (found != m_prefix_map.end() && found->second == block_id) {
+            m_prefix_map.erase(found);
+        }
+        block.registered = false;
+        block.tokens.clear();
+        m_evicted_blocks++;
+    }
+    m_blocks[block_id].ref_count = 1;
+    m_blocks[block_id].epoch++;
+    return block_id;
+}
+
+void KVBlockManager::release_block(int32_t block_id) {
+    auto& block = m_blocks[block_id];
+    OPENVINO_ASSERT(block.ref_count > 0, "KVBlockManager: double release of block ", block_id);
+    if (--block.ref_count > 0) {
+        return;
+    }
+    if (block.registered) {
+        block.lru_pos = m_lru_blocks.insert(m_lru_blocks.end(), block_id);
+    } else {
+        m_free_blocks.push_back(block_id);
+    }
+}
+
+void KVBlockManager::acquire_cached_block(int32_t block_id) {
+    auto& block = m_blocks[block_id];
+    if (block.ref_count == 0) {
+        m_lru_blocks.erase(block.lru_pos);
+    }
+    block.ref_count++;
+}
+
+int32_t KVBlockManager::find_cached_block(size_t hash, int32_t parent, const Token* tokens) const {
+    auto found = m_prefix_map.find(hash);
+    if (found == m_prefix_map.end()) {
+        return -1;
+    }
+    // the parent is the already verified previous block of the prefix, matching it extends the check to the whole chain
+    const auto& block = m_blocks[found->second];
+    if (block.parent != parent || (parent >= 0 && block.parent_epoch != m_blocks[parent].epoch)) {
+        return -1;
+    }
+    if (!std::equal(block.tokens.begin(), block.tokens.end(), tokens)) {
+        return -1;
+    }
+    return found->second;
+}
+
+void KVBlockManager::update_hashes(Sequence& seq) const {
+    for (size_t i = seq.block_hashes.size(); (i + 1) * m_block_size <= seq.tokens.size(); i++) {
+        const size_t prev_hash = i == 0 ? 0 : seq.block_hashes[i - 1];
+        seq.block_hashes.push_back(block_hash(prev_hash, seq.tokens.data() + i * m_block_size));
+    }
+}
+
+const KVBlockManager::Sequence& KVBlockManager::get_sequence(SequenceId id) const {
+    auto found = m_sequences.find(id);
+    OPENVINO_ASSERT(found != m_sequences.end(), "KVBlockManager: unknown sequence id ", id);
+    return found->second;
+}
+
+size_t KVBlockManager::add_sequence(SequenceId id, const std::vector<Token>& prompt) {
+    std::lock_guard<std::mutex> lock(m_guard);
+    OPENVINO_ASSERT(m_sequences.count(id) == 0, "KVBlockManager: sequence ", id, " already exists");
+    OPENVINO_ASSERT(!prompt.empty(), "KVBlockManager: empty prompt for sequence ", id);
+
+    Sequence seq;
+    seq.tokens = prompt;
+    update_hashes(seq);
+
+    // the last prompt token is always recomputed to produce logits
+    size_t num_matched = 0;
+    if (m_enable_prefix_caching) {
+        const size_t max_matched = (prompt.size() - 1) / m_block_size;
+        for (; num_matched < max_matched; num_matched++) {
+            const int32_t parent = num_matched == 0 ? -1 : seq.blocks.back();
+            auto block_id =
+                find_cached_block(seq.block_hashes[num_matched], parent, prompt.data() + num_matched * m_block_size);
+            if (block_id < 0) {
+                break;
+            }
+            acquire_cached_block(block_id);
+            seq.blocks.push_back(block_id);
+        }
+    }
+
+    const size_t num_required = num_blocks_for(prompt.size()) - num_matched;
+    if (num_required > available_blocks()) {
+        for (auto it = seq.blocks.rbegin(); it != seq.blocks.rend(); ++it) {
+            release_block(*it);
+        }
+        OPENVINO_THROW("KVBlockManager: out of KV cache blocks for sequence ",
+                       id,
+                       ", required ",
+                       num_required,
+                       " available ",
+                       available_blocks());
+    }
+    for (size_t i = 0; i < num_required; i++) {
+        seq.blocks.push_back(allocate_block());
+    }
+
+    seq.num_computed = num_matched * m_block_size;
+    m_lookup_tokens += prompt.size();
+    m_hit_tokens += seq.num_computed;
+    m_sequences.emplace(id, std::move(seq));
+    return num_matched * m_block_size;
+}
+
+std::vector<KVBlockManager::CopyOp> KVBlockManager::append_tokens(SequenceId id, const std::vector<Token>& tokens) {
+    std::lock_guard<std::mutex> lock(m_guard);
+    auto found = m_sequences.find(id);
+    OPENVINO_ASSERT(found != m_sequences.end(), "KVBlockManager: unknown sequence id ", id);
+    auto& seq = found->second;
+
+    const size_t cur_len = seq.tokens.size();
+    const bool need_copy = cur_len % m_block_size != 0 && m_blocks[seq.blocks.back()].ref_count > 1;
+    const size_t num_required = num_blocks_for(cur_len + tokens.size()) - seq.blocks.size() + (need_copy ? 1 : 0);
+    OPENVINO_ASSERT(num_required <= available_blocks(),
+                    "KVBlockManager: out of KV cache blocks for sequence ",
+                    id,
+                    ", required ",
+                    num_required,
+                    " available ",
+                    available_blocks());
+
+    std::vector<CopyOp> copies;
+    if (need_copy) {
+        // the partially filled last block is shared with a forked sequence and is about to be written
+        const int32_t src = seq.blocks.back();
+        const int32_t dst = allocate_block();
+        release_block(src);
+        seq.blocks.back() = dst;
+        copies.push_back({src, dst});
+        m_copied_blocks++;
+    }
+    while (seq.blocks.size() < num_blocks_for(cur_len + tokens.size())) {
+        seq.blocks.push_back(allocate_block());
+    }
+    seq.tokens.insert(seq.tokens.end(), tokens.begin(), tokens.end());
+    return copies;
+}
+
+void KVBlockManager::fork_sequence(SequenceId parent, SequenceId child) {
+    std::lock_guard<std::mutex> lock(m_guard);
+    OPENVINO_ASSERT(m_sequences.count(child) == 0, "KVBlockManager: sequence ", child, " already exists");
+    Sequence seq = get_sequence(parent);
+    for (auto block_id : seq.blocks) {
+        m_blocks[block_id].ref_count++;
+    }
+    m_sequences.emplace(child, std::move(seq));
+}
+
+void KVBlockManager::free_sequence(SequenceId id) {
+    std::lock_guard<std::mutex> lock(m_guard);
+    auto found = m_sequences.find(id);
+    OPENVINO_ASSERT(found != m_sequences.end(), "KVBlockManager: unknown sequence id ", id);
+    // release the tail first, so the eviction drops the end of a cached prefix before its beginning
+    const auto& blocks = found->second.blocks;
+    for (auto it = blocks.rbegin(); it != blocks.rend(); ++it) {
+        release_block(*it);
+    }
+    m_sequences.erase(found);
+}
+
+bool KVBlockManager::can_add_sequence(size_t num_tokens) const {
+    std::lock_guard<std::mutex> lock(m_guard);
+    return num_blocks_for(num_tokens) <= available_blocks();
+}
+
+KVBlockManager::PagedInputs KVBlockManager::get_paged_inputs(const std::vector<SequenceId>& ids) const {
+    std::lock_guard<std::mutex> lock(m_guard);
+    PagedInputs inputs;
+    inputs.past_lens.reserve(ids.size());
+    inputs.subsequence_begins.reserve(ids.size() + 1);
+    inputs.block_indices_begins.reserve(ids.size() + 1);
+    inputs.subsequence_begins.push_back(0);
+    inputs.block_indices_begins.push_back(0);
+    for (auto id : ids) {
+        const auto& seq = get_sequence(id);
+        inputs.past_lens.push_back(static_cast<int32_t>(seq.num_computed));
+        inputs.subsequence_begins.push_back(inputs.subsequence_begins.back() +
+                                            static_cast<int32_t>(seq.tokens.size() - seq.num_computed));
+        inputs.block_indices.insert(inputs.block_indices.end(), seq.blocks.begin(), seq.blocks.end());
+        inputs.block_indices_begins.push_back(static_cast<int32_t>(inputs.block_indices.size()));
+        inputs.max_context_len = std::max(inputs.max_context_len, static_cast<int32_t>(seq.tokens.size()));
+    }
+    return inputs;
+}
+
+void KVBlockManager::commit(const std::vector<SequenceId>& ids) {
+    std::lock_guard<std::mutex> lock(m_guard);
+    for (auto id : ids) {
+        auto found = m_sequences.find(id);
+        OPENVINO_ASSERT(found != m_sequences.end(), "KVBlockManager: unknown sequence id ", id);
+        auto& seq = found->second;
+        seq.num_computed = seq.tokens.size();
+        if (!m_enable_prefix_caching) {
+            continue;
+        }
+        update_hashes(seq);
+        for (size_t i = 0; i < seq.block_hashes.size(); i++) {
+            auto& block = m_blocks[seq.blocks[i]];
+            if (block.registered) {
+                continue;
+            }
+            // the same prefix may have been computed concurrently by another sequence, keep the first copy
+            if (m_prefix_map.emplace(seq.block_hashes[i], seq.blocks[i]).second) {
+                block.registered = true;
+                block.hash = seq.block_hashes[i];
+                block.tokens.assign(seq.tokens.begin() + i * m_block_size, seq.tokens.begin() + (i + 1) * m_block_size);
+                block.parent = i == 0 ? -1 : seq.blocks[i - 1];
+                block.parent_epoch = i == 0 ? 0 : m_blocks[block.parent].epoch;
+            }
+        }
+    }
+}
+
+void KVBlockManager::rollback(const std::vector<SequenceId>& ids) {
+    std::lock_guard<std::mutex> lock(m_guard);
+    for (auto id : ids) {
+        auto found = m_sequences.find(id);
+        OPENVINO_ASSERT(found != m_sequences.end(), "KVBlockManager: unknown sequence id ", id);
+        auto& seq = found->second;
+        // a block replaced by its copy keeps the copy, its computed content is the same
+        const size_t num_blocks = num_blocks_for(seq.num_computed);
+        while (seq.blocks.size() > num_blocks) {
+            release_block(seq.blocks.back());
+            seq.blocks.pop_back();
+        }
+        seq.tokens.resize(seq.num_computed);
+        seq.block_hashes.resize(std::min(seq.block_hashes.size(), seq.num_computed / m_block_size));
+    }
+}
+
+std::vector<int32_t> KVBlockManager::get_block_table(SequenceId id) const {
+    std::lock_guard<std::mutex> lock(m_guard);
+    return get_sequence(id).blocks;
+}
+
+size_t KVBlockManager::get_num_computed_tokens(SequenceId id) const {
+    std::lock_guard<std::mutex> lock(m_guard);
+    return get_sequence(id).num_computed;
+}
+
+KVBlockManager::Statistics KVBlockManager::get_statistics() const {
+    std::lock_guard<std::mutex> lock(m_guard);
+    return {m_blocks.size(),
+            m_free_blocks.size(),
+            m_lru_blocks.size(),
+            m_lookup_tokens,
+            m_hit_tokens,
+            m_evicted_blocks,
+            m_copied_blocks};
+}
+
+void KVBlockManager::copy_blocks(ov::Tensor& cache, const std::vector<CopyOp>& copies) {
+    if (copies.empty()) {
+        return;
+    }
+    const auto& shape = cache.get_shape();
+    OPENVINO_ASSERT(!shape.empty() && shape[0] > 0, "KVBlockManager: unexpected cache shape ", shape);
+    const size_t block_bytes = cache.get_byte_size() / shape[0];
+    auto* data = static_cast<uint8_t*>(cache.data());
+    for (const auto& copy : copies) {
+        OPENVINO_ASSERT(static_cast<size_t>(copy.src) < shape[0] && static_cast<size_t>(copy.dst) < shape[0],
+                        "KVBlockManager: block copy is out of the cache range");
+        std::memcpy(data + copy.dst * block_bytes, data + copy.src * block_bytes, block_bytes);
+    }
+}
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,178 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "openvino/runtime/tensor.hpp"
+
+namespace ov::intel_cpu {
+
+/**
+ * @brief Block manager for the paged KV cache consumed by the PagedAttention node.
+ *
+ * The manager owns the mapping from sequences to physical KV cache blocks and produces the
+ * past_lens / subsequence_begins / block_indices / block_indices_begins inputs of a PagedAttention model.
+ *
+ * - blocks are reference counted, so forked sequences (beam search, parallel sampling) share their common prefix;
+ * - every completely filled and computed block is registered under a hash of its tokens chained with the hash of
+ *   the previous block, so a new sequence with an already seen prefix reuses the cached blocks and only the rest of
+ *   the prompt has to be prefilled; a hash match is accepted only if the block tokens and its previous block match
+ *   as well, so the whole prefix is verified;
+ * - a shared block that is about to be written is copied first (copy-on-write), the copies are reported to the caller
+ *   which has to apply them to the key/value cache tensors before the inference;
+ * - blocks of finished sequences stay in the prefix cache until the free pool is exhausted and are then evicted in
+ *   the least recently used order.
+ *
+ * The manager is thread safe.
+ */
+class KVBlockManager {
+public:
+    using Ptr = std::shared_ptr<KVBlockManager>;
+    using SequenceId = uint64_t;
+    using Token = int64_t;
+
+    struct CopyOp {
+        int32_t src;
+        int32_t dst;
+    };
+
+    struct PagedInputs {
+        std::vector<int32_t> past_lens;             // [B_seq]
+        std::vector<int32_t> subsequence_begins;    // [B_seq + 1]
+        std::vector<int32_t> block_indices;         // [num_blocks]
+        std::vector<int32_t> block_indices_begins;  // [B_seq + 1]
+        int32_t max_context_len = 0;
+    };
+
+    struct Statistics {
+        size_t total_blocks;    // blocks in the pool
+        size_t free_blocks;     // blocks without references and cached content
+        size_t cached_blocks;   // blocks without references kept for prefix reuse
+        size_t lookup_tokens;   // prompt tokens checked against the prefix cache
+        size_t hit_tokens;      // prompt tokens found in the prefix cache
+        size_t evicted_blocks;  // cached blocks reused for new content
+        size_t copied_blocks;   // copy-on-write operations
+    };
+
+    KVBlockManager(size_t num_blocks, size_t block_size, bool enable_prefix_caching = true);
+
+    /**
+     * @brief Registers a new sequence with its prompt and reserves KV cache blocks for it.
+     * @return number of leading prompt tokens whose KV is already in the cache and need not be prefilled
+     */
+    size_t add_sequence(SequenceId id, const std::vector<Token>& prompt);
+
+    /**
+     * @brief Appends generated tokens to the sequence, allocating new blocks when needed.
+     * @return block copies that must be applied to the key/value caches before the next inference
+     */
+    std::vector<CopyOp> append_tokens(SequenceId id, const std::vector<Token>& tokens);
+
+    /**
+     * @brief Creates the child sequence sharing all blocks of the parent one.
+     */
+    void fork_sequence(SequenceId parent, SequenceId child);
+
+    /**
+     * @brief Releases the sequence. Its computed full blocks remain available for prefix reuse.
+     */
+    void free_sequence(SequenceId id);
+
+    /**
+     * @brief Checks that a sequence with the given prompt length can be added without running out of blocks.
+     */
+    [[nodiscard]] bool can_add_sequence(size_t num_tokens) const;
+
+    /**
+     * @brief Builds the PagedAttention inputs for the tokens of the given sequences that are not computed yet.
+     */
+    [[nodiscard]] PagedInputs get_paged_inputs(const std::vector<SequenceId>& ids) const;
+
+    /**
+     * @brief Marks all tokens of the given sequences as computed after a successful inference and publishes
+     * their full blocks in the prefix cache.
+     */
+    void commit(const std::vector<SequenceId>& ids);
+
+    /**
+     * @brief Drops the tokens of the given sequences that are not computed yet after a failed inference and releases
+     * the blocks reserved for them.
+     */
+    void rollback(const std::vector<SequenceId>& ids);
+
+    [[nodiscard]] std::vector<int32_t> get_block_table(SequenceId id) const;
+    [[nodiscard]] size_t get_num_computed_tokens(SequenceId id) const;
+    [[nodiscard]] Statistics get_statistics() const;
+
+    [[nodiscard]] size_t get_block_size() const {
+        return m_block_size;
+    }
+
+    /**
+     * @brief Applies block copies to a cache tensor laid out as [num_blocks, ...].
+     */
+    static void copy_blocks(ov::Tensor& cache, const std::vector<CopyOp>& copies);
+
+private:
+    struct Block {
+        size_t ref_count = 0;
+        size_t hash = 0;
+        bool registered = false;
+        uint64_t epoch = 0;  // incremented on each allocation, so a reused block id doesn't match a stale reference
+        // the content of a registered block and the block holding the previous part of its prefix, together they
+        // identify the whole prefix, so a hash collision can't map a block to a different prefix
+        std::vector<Token> tokens;
+        int32_t parent = -1;
+        uint64_t parent_epoch = 0;
+        std::list<int32_t>::iterator lru_pos;
+    };
+
+    struct Sequence {
+        std::vector<Token> tokens;
+        std::vector<int32_t> blocks;
+        std::vector<size_t> block_hashes;  // chained hashes of the full blocks
+        size_t num_computed = 0;
+    };
+
+    [[nodiscard]] size_t num_blocks_for(size_t num_tokens) const {
+        return (num_tokens + m_block_size - 1) / m_block_size;
+    }
+    [[nodiscard]] size_t available_blocks() const {
+        return m_free_blocks.size() + m_lru_blocks.size();
+    }
+
+    size_t block_hash(size_t prev_hash, const Token* tokens) const;
+    int32_t allocate_block();
+    void release_block(int32_t block_id);
+    void acquire_cached_block(int32_t block_id);
+    void update_hashes(Sequence& seq) const;
+    int32_t find_cached_block(size_t hash, int32_t parent, const Token* tokens) const;
+    const Sequence& get_sequence(SequenceId id) const;
+
+    const size_t m_block_size;
+    const bool m_enable_prefix_caching;
+
+    std::vector<Block> m_blocks;
+    std::vector<int32_t> m_free_blocks;
+    std::list<int32_t> m_lru_blocks;  // cached blocks without references, least recently used first
+    std::unordered_map<size_t, int32_t> m_prefix_map;
+    std::unordered_map<SequenceId, Sequence> m_sequences;
+
+    size_t m_lookup_tokens = 0;
+    size_t m_hit_tokens = 0;
+    size_t m_evicted_blocks = 0;
+    size_t m_copied_blocks = 0;
+
+    mutable std::mutex m_guard;
+};
+
+}  // namespace ov::intel_cpu
@@ -9,9 +9,13 @@
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
 #include <memory>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <string>
+#include <system_error>
 #include <utility>
 #include <vector>
 
@@ -19,6 +23,7 @@
 #include "cpu_tensor.h"
 #include "cpu_types.h"
 #include "dnnl_extension_utils.h"
+#include "graph_context.h"
 #include "memory_desc/blocked_memory_desc.h"
 #include "memory_desc/cpu_blocked_memory_desc.h"
 #include "memory_desc/cpu_memory_desc.h"
@@ -29,6 +34,8 @@
 #include "openvino/core/type/element_type.hpp"
 #include "openvino/runtime/itensor.hpp"
 #include "openvino/runtime/so_ptr.hpp"
+#include "openvino/util/file_util.hpp"
+#include "openvino/util/mmap_object.hpp"
 #include "utils/general_utils.h"
 #include "utils/plain_tensor.hpp"
 
@@ -226,23 +233,37 @@ VariableStateKVcache::VariableStateKVcache(const std::string& name,
                                            MemoryDescPtr external_desc,
                                            BlockedMemoryDescPtr dense_internal_desc,
                                            const bool quant_by_channel,
-                                           const size_t group_size)
+                                           const size_t group_size,
+                                           std::shared_ptr<StateMemoryStatistics> memory_statistics)
     : VariableStateBase(name, std::move(external_desc)),
       m_dense_internal_desc(std::move(dense_internal_desc)),
       m_quant_by_channel(quant_by_channel),
-      m_group_size(group_size) {
+      m_group_size(group_size),
+      m_memory_statistics(std::move(memory_statistics)) {
     auto&& shape = get_external_desc()->getShape();
     OPENVINO_ASSERT(shape.isDynamic(), "VariableStateKVcache is unexpectedly initalized with a static tensor");
 }
 
+VariableStateKVcache::~VariableStateKVcache() {
+    drop_offloaded();
+    if (m_memory_statistics) {
+        m_memory_statistics->kvCacheBytes.fetch_sub(m_reported_size, std::memory_order_relaxed);
+    }
+}
+
 ov::SoPtr<ov::ITensor> VariableStateKVcache::get_state() const {
-    if (!m_internal_mem || !m_hidden_state || is_reset_state()) {
+    // the offloaded state is read from the file and stays offloaded until the next inference
+    const auto resident = m_offloaded ? load_offloaded() : ResidentState{m_internal_mem, m_hidden_state, m_scale_zp};
+    const auto& internal_mem = resident.internal_mem;
+    const auto& hidden_state = resident.hidden_state;
+    const auto& scale_zp = resident.scale_zp;
+    if (!internal_mem || !hidden_state || is_reset_state()) {
         auto new_desc = to_static(get_external_desc());
         auto external_mem = std::make_shared<Memory>(get_engine(), new_desc);
         return std::make_shared<Tensor>(external_mem);
     }
 
-    auto actual_internal_desc = m_internal_mem->getDescWithType<BlockedMemoryDesc>();
+    auto actual_internal_desc = internal_mem->getDescWithType<BlockedMemoryDesc>();
     auto&& dims = actual_internal_desc->getShape().getStaticDims();
 
     auto actual_external_desc = get_external_desc()->cloneWithNewDims(dims);
@@ -260,8 +281,8 @@ ov::SoPtr<ov::ITensor> VariableStateKVcache::get_state() const {
     PlainTensor pastkv;
     PlainTensor beam_table;
     output.reset(external_mem);
-    beam_table.reset(m_hidden_state);
-    pastkv.reset(m_internal_mem);
+    beam_table.reset(hidden_state);
+    pastkv.reset(internal_mem);
     output = output.permute(actual_internal_order);
     pastkv = pastkv.permute(actual_internal_order);
     // S should be always the last dimension
@@ -270,7 +291,7 @@ ov::SoPtr<ov::ITensor> VariableStateKVcache::get_state() const {
     auto B = pastkv.size(1);
     auto H = pastkv.size(2);
     auto S = pastkv.size(3);
-    if (pastkv.get_precision() == element::u8) {
+    if (any_of(pastkv.get_precision(), element::u8, element::u4)) {
         auto nthr = parallel_get_max_threads();
         std::vector<PlainTensor> buffers(nthr);
         if (m_quant_by_channel) {
@@ -284,19 +305,28 @@ ov::SoPtr<ov::ITensor> VariableStateKVcache::get_state() const {
                                            S,
                                            pastkv.m_strides[2],
                                            S,
-                                           m_scale_zp.ptr<float>(group_id * 2, b_kv, h),
-                                           m_scale_zp.ptr<float>(group_id * 2 + 1, b_kv, h));
+                                           scale_zp.ptr<float>(group_id * 2, b_kv, h),
+                                           scale_zp.ptr<float>(group_id * 2 + 1, b_kv, h));
                 cpu_convert(buffers[ithr].ptr<float>(), output.ptr_v(m, b, h), element::f32, output.m_dt, S);
             });
         } else {
+            OPENVINO_ASSERT(pastkv.get_precision() == element::u8 || m_group_size % 2 == 0,
+                            "u4 KV cache requires even group size");
             parallel_for3d(L0, B, H, [&](size_t ithr, size_t m, size_t b, size_t h) {
                 auto b_kv = static_cast<size_t>(beam_table.at<int32_t>({b, m}));
                 buffers[ithr].resize<float>({S});
                 for (size_t group_id = 0; group_id < S / m_group_size; group_id++) {
-                    attn_dequant_u8(pastkv.ptr<uint8_t>(m, b_kv, h, group_id * m_group_size),
-                                    buffers[ithr].ptr<float>() + group_id * m_group_size,
-                                    m_group_size,
-                                    m_scale_zp.ptr<float>(m, b_kv, h, group_id * 2));
+                    if (pastkv.get_precision() == element::u4) {
+                        attn_dequant_u4(pastkv.ptr<uint8_t, element::u4>(m, b_kv, h, group_id * m_group_size),
+                                        buffers[ithr].ptr<float>() + group_id * m_group_size,
+                                        m_group_size,
+                                        scale_zp.ptr<float>(m, b_kv, h, group_id * 2));
+                    } else {
+                        attn_dequant_u8(pastkv.ptr<uint8_t>(m, b_kv, h, group_id * m_group_size),
+                                        buffers[ithr].ptr<float>() + group_id * m_group_size,
+                                        m_group_size,
+                                        scale_zp.ptr<float>(m, b_kv, h, group_id * 2));
+                    }
                 }
                 cpu_convert(buffers[ithr].ptr<float>(), output.ptr_v(m, b, h), element::f32, output.m_dt, S);
             });
@@ -312,6 +342,7 @@ ov::SoPtr<ov::ITensor> VariableStateKVcache::get_state() const {
 }
 
 void VariableStateKVcache::set_state_impl(const ov::SoPtr<ov::ITensor>& state) {
+    drop_offloaded();
     // 1. reset the memory object
     m_state = state;  // simply to extend the lifetime
     auto state_desc = MemoryDescUtils::generateCpuBlockedMemoryDesc(m_state);
@@ -322,7 +353,7 @@ void VariableStateKVcache::set_state_impl(const ov::SoPtr<ov::ITensor>& state) {
     m_internal_mem = std::make_shared<Memory>(get_engine(), dense_internal_desc);
     Memory external_mem(get_engine(), state_desc, m_state->data());
 
-    if (dense_internal_desc->getPrecision() == element::u8) {
+    if (any_of(dense_internal_desc->getPrecision(), element::u8, element::u4)) {
         PlainTensor external;
         PlainTensor internal;
         auto&& actual_internal_order = m_dense_internal_desc->getOrder();
@@ -365,11 +396,19 @@ void VariableStateKVcache::set_state_impl(const ov::SoPtr<ov::ITensor>& state) {
                 buffers[ithr].resize<float>({S});
                 cpu_convert(external.ptr_v(m, b, h), buffers[ithr].ptr<float>(), external.m_dt, element::f32, S);
                 for (size_t group_id = 0; group_id < S / m_group_size; group_id++) {
-                    attn_quant_u8(buffers[ithr].ptr<float>() + group_id * m_group_size,
-                                  internal.ptr<uint8_t>(m, b, h, group_id * m_group_size),
-                                  m_group_size,
-                                  m_scale_zp.at<float>({m, b, h, group_id * 2}),
-                                  m_scale_zp.at<float>({m, b, h, group_id * 2 + 1}));
+                    if (internal.get_precision() == element::u4) {
+                        attn_quant_u4(buffers[ithr].ptr<float>() + group_id * m_group_size,
+                                      internal.ptr<uint8_t, element::u4>(m, b, h, group_id * m_group_size),
+                                      m_group_size,
+                                      m_scale_zp.at<float>({m, b, h, group_id * 2}),
+                                      m_scale_zp.at<float>({m, b, h, group_id * 2 + 1}));
+                    } else {
+                        attn_quant_u8(buffers[ithr].ptr<float>() + group_id * m_group_size,
+                                      internal.ptr<uint8_t>(m, b, h, group_id * m_group_size),
+                                      m_group_size,
+                                      m_scale_zp.at<float>({m, b, h, group_id * 2}),
+                                      m_scale_zp.at<float>({m, b, h, group_id * 2 + 1}));
+                    }
                 }
             });
         }
@@ -392,12 +431,139 @@ void VariableStateKVcache::set_state_impl(const ov::SoPtr<ov::ITensor>& state) {
             buff[i * size_L + j] = i;
         }
     }
-    m_internal_mem_max_size = dense_internal_desc->getCurrentMemSize() / dense_internal_desc->getPrecision().size();
+    m_internal_mem_max_size = dense_internal_desc->getShape().getElementsCount();
     m_hidden_state_max_size = mem_desc->getCurrentMemSize() / mem_desc->getPrecision().size();
+    update_memory_statistics();
 }
 
 void VariableStateKVcache::reset_impl() {
-    // nothing to do
+    drop_offloaded();
+}
+
+void VariableStateKVcache::offload(const std::string& file_path) {
+    restore();
+    if (!m_internal_mem || !m_hidden_state || is_reset_state()) {
+        // nothing to keep
+        return;
+    }
+
+    auto offloaded = std::make_unique<OffloadedState>();
+    offloaded->file_path = file_path;
+    offloaded->internal_desc = m_internal_mem->getDescPtr();
+    offloaded->hidden_state_desc = m_hidden_state->getDescPtr();
+    // the kv cache is LBHS and the beam table is [B, L], only the filled part of the buffers is written
+    size_t scale_zp_size = 0;
+    if (m_scale_zp) {
+        PlainTensor pastkv;
+        pastkv.reset(m_internal_mem);
+        pastkv = pastkv.permute(m_dense_internal_desc->getOrder());
+        const auto L0 = pastkv.size(0);
+        const auto rows = m_quant_by_channel ? div_up(L0, m_group_size) * 2 : L0;
+        offloaded->scale_zp_dims = m_scale_zp.shape();
+        offloaded->scale_zp_dims[0] = rows;
+        offloaded->scale_zp_strides = m_scale_zp.get_strides<size_t>();
+        scale_zp_size = rows * m_scale_zp.stride(0) * sizeof(float);
+    }
+
+    {
+        std::ofstream file(ov::util::make_path(file_path), std::ios::binary | std::ios::trunc);
+        OPENVINO_ASSERT(file.is_open(), "Cannot open file ", file_path, " to offload the state ", get_name());
+        file.write(m_internal_mem->getDataAs<const char>(), static_cast<std::streamsize>(m_internal_mem->getSize()));
+        file.write(m_hidden_state->getDataAs<const char>(), static_cast<std::streamsize>(m_hidden_state->getSize()));
+        if (scale_zp_size) {
+            file.write(reinterpret_cast<const char*>(m_scale_zp.ptr<float>()),
+                       static_cast<std::streamsize>(scale_zp_size));
+        }
+        if (!file.good()) {
+            file.close();
+            std::error_code ec;
+            std::filesystem::remove(ov::util::make_path(file_path), ec);
+            OPENVINO_THROW("Cannot write file ", file_path, " to offload the state ", get_name());
+        }
+    }
+
+    m_offloaded = std::move(offloaded);
+    m_internal_mem.reset();
+    m_hidden_state.reset();
+    m_scale_zp = PlainTensor();
+    // a reset of the offloaded state must allocate new buffers
+    m_internal_mem_max_size = 0;
+    m_hidden_state_max_size = 0;
+    update_memory_statistics();
+}
+
+VariableStateKVcache::ResidentState VariableStateKVcache::load_offloaded() const {
+    const auto& offloaded = *m_offloaded;
+    // the pages are read on demand, so the file content is copied to the new buffers without a staging copy
+    auto mapped = ov::load_mmap_object(ov::util::make_path(offloaded.file_path));
+    size_t offset = 0;
+    auto read = [&](void* dst, size_t size) {
+        OPENVINO_ASSERT(offset + size <= mapped->size(),
+                        "The file ",
+                        offloaded.file_path,
+                        " is too small for the offloaded state ",
+                        get_name());
+        std::memcpy(dst, mapped->data() + offset, size);
+        offset += size;
+    };
+
+    auto internal_mem = std::make_shared<Memory>(get_engine(), offloaded.internal_desc);
+    read(internal_mem->getData(), internal_mem->getSize());
+    auto hidden_state = std::make_shared<Memory>(get_engine(), offloaded.hidden_state_desc);
+    read(hidden_state->getData(), hidden_state->getSize());
+    PlainTensor scale_zp;
+    if (!offloaded.scale_zp_dims.empty()) {
+        scale_zp.resize<float>(offloaded.scale_zp_dims, nullptr, offloaded.scale_zp_strides.data());
+        read(scale_zp.ptr<float>(), offloaded.scale_zp_dims[0] * scale_zp.stride(0) * sizeof(float));
+    }
+    return {internal_mem, hidden_state, scale_zp};
+}
+
+void VariableStateKVcache::restore() {
+    if (!m_offloaded) {
+        return;
+    }
+    auto resident = load_offloaded();
+    m_internal_mem = resident.internal_mem;
+    m_hidden_state = resident.hidden_state;
+    m_scale_zp = resident.scale_zp;
+    // the buffers have no spare room, the next inference reallocates them
+    m_internal_mem_max_size = m_offloaded->internal_desc->getShape().getElementsCount();
+    m_hidden_state_max_size = m_offloaded->hidden_state_desc->getShape().getElementsCount();
+    drop_offloaded();
+    update_memory_statistics();
+}
+
+size_t VariableStateKVcache::resident_size() const {
+    size_t size = 0;
+    if (m_internal_mem) {
+        size += div_up(m_internal_mem_max_size * m_dense_internal_desc->getPrecision().bitwidth(), 8);
+    }
+    if (m_hidden_state) {
+        size += m_hidden_state_max_size * sizeof(int32_t);
+    }
+    // the scales and zero points of u8/u4 cache
+    return size + m_scale_zp.m_capacity;
+}
+
+void VariableStateKVcache::update_memory_statistics() {
+    if (!m_memory_statistics) {
+        return;
+    }
+    const auto size = resident_size();
+    // the counter is shared by the states of all the requests, each state adds the change of its own size (a shrink
+    // wraps around the unsigned addition)
+    m_memory_statistics->kvCacheBytes.fetch_add(size - m_reported_size, std::memory_order_relaxed);
+    m_reported_size = size;
+}
+
+void VariableStateKVcache::drop_offloaded() {
+    if (!m_offloaded) {
+        return;
+    }
+    std::error_code ec;
+    std::filesystem::remove(ov::util::make_path(m_offloaded->file_path), ec);
+    m_offloaded.reset();
 }
 
 void VariableStateKVcache::commit_impl() {
@@ -405,10 +571,12 @@ void VariableStateKVcache::commit_impl() {
 }
 
 MemoryPtr VariableStateKVcache::input_mem() {
+    restore();
     return m_internal_mem;
 }
 
 MemoryPtr VariableStateKVcache::output_mem() {
+    restore();
     return m_internal_mem;
 }
 
@@ -11,6 +11,7 @@
 #include <string>
 
 #include "cpu_memory.h"
+#include "cpu_types.h"
 #include "memory_desc/blocked_memory_desc.h"
 #include "memory_desc/cpu_memory_desc.h"
 #include "openvino/runtime/ivariable_state.hpp"
@@ -20,6 +21,8 @@
 
 namespace ov::intel_cpu {
 
+struct StateMemoryStatistics;
+
 class IVariableState : public ov::IVariableState {
 public:
     using ov::IVariableState::IVariableState;
@@ -124,10 +127,18 @@ public:
                          MemoryDescPtr external_desc,
                          BlockedMemoryDescPtr dense_internal_desc,
                          bool quant_by_channel,
-                         size_t group_size = 0);
+                         size_t group_size = 0,
+                         std::shared_ptr<StateMemoryStatistics> memory_statistics = nullptr);
+
+    ~VariableStateKVcache() override;
 
     // ov::IVariableState
     ov::SoPtr<ov::ITensor> get_state() const override;
+    void offload(const std::string& file_path) override;
+
+    // loads the offloaded state back to memory, nothing to do if the state is resident; like offload() it must not run
+    // concurrently with the inference or other calls to the state
+    void restore();
 
     // ov::intel_cpu::VariableStateBase
     MemoryPtr input_mem() override;
@@ -146,6 +157,7 @@ public:
     }
     void assign_internal_state_max_size(size_t max_size) {
         m_internal_mem_max_size = max_size;
+        update_memory_statistics();
     }
 
     size_t hidden_state_max_size() const {
@@ -153,6 +165,7 @@ public:
     }
     void assign_hidden_state_max_size(size_t max_size) {
         m_hidden_state_max_size = max_size;
+        update_memory_statistics();
     }
 
     PlainTensor& get_scale_zp() {
@@ -160,14 +173,39 @@ public:
     }
     void set_scale_zp(const PlainTensor& t) {
         m_scale_zp = t;
+        update_memory_statistics();
     }
 
+    // bytes allocated for the state, including the spare room for the next tokens; zero while offloaded
+    size_t resident_size() const;
+
 private:
     // ov::intel_cpu::VariableStateBase
     void set_state_impl(const ov::SoPtr<ov::ITensor>& state) override;
     void reset_impl() override;
     void commit_impl() override;
 
+    void drop_offloaded();
+    void update_memory_statistics();
+
+    // the part of the state written to the file by offload(), the buffers are read back in the same order
+    struct OffloadedState {
+        std::string file_path;
+        MemoryDescPtr internal_desc;
+        MemoryDescPtr hidden_state_desc;
+        VectorDims scale_zp_dims;
+        VectorDims scale_zp_strides;
+    };
+
+    struct ResidentState {
+        MemoryPtr internal_mem;
+        MemoryPtr hidden_state;
+        PlainTensor scale_zp;
+    };
+
+    // reads the offloaded buffers from the file, the state itself stays offloaded
+    ResidentState load_offloaded() const;
+
     MemoryPtr m_internal_mem;  // kv cache
     MemoryPtr m_hidden_state;  // beam access table
     size_t m_internal_mem_max_size = 0;
@@ -180,6 +218,11 @@ private:
     PlainTensor m_scale_zp;
     bool m_quant_by_channel = false;
     size_t m_group_size = 0;
+
+    std::unique_ptr<OffloadedState> m_offloaded;
+
+    std::shared_ptr<StateMemoryStatistics> m_memory_statistics;
+    size_t m_reported_size = 0;  // resident_size() accounted in m_memory_statistics
 };
 
 using MemStatePtr = std::shared_ptr<IVariableState>;
@@ -7,6 +7,7 @@
 #include <oneapi/dnnl/dnnl_types.h>
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <cstddef>
 #include <cstdint>
@@ -57,6 +58,7 @@
 #include "utils/general_utils.h"
 #include "utils/ngraph_utils.hpp"
 #include "utils/rt_info/memory_formats_attribute.hpp"
+#include "weights_cache.hpp"
 
 using namespace dnnl;
 using namespace openvino;
@@ -809,6 +811,7 @@ void Node::updateDynamicParams() {
                           " ",
                           getOriginalLayers());
                 context->getCpuParallel()->activate();
+                context->getDynamicShapeStatistics().prepareParams.fetch_add(1, std::memory_order_relaxed);
                 prepareParams();
             }
         }
@@ -880,7 +883,12 @@ void Node::redefineOutputMemory(const size_t port, const VectorDims& new_output_
     const bool has_zero_dims = std::count(std::begin(new_shape), std::end(new_shape), 0LU) > 0;
     const auto mem_desc = getBaseMemDescAtOutputPort(port)->cloneWithNewDims(new_shape, has_zero_dims);
     for (size_t j = 0LU; j < edges.size(); j++) {  // NOLINT(modernize-loop-convert)
-        edges[j]->getMemoryPtr()->redefineDesc(mem_desc);
+        const auto& memory = edges[j]->getMemoryPtr();
+        const void* prev_data = memory->getMemoryBlock()->getRawPtr();
+        memory->redefineDesc(mem_desc);
+        if (memory->getMemoryBlock()->getRawPtr() != prev_data) {
+            context->getDynamicShapeStatistics().outputReallocations.fetch_add(1, std::memory_order_relaxed);
+        }
     }
 }
 
@@ -1115,6 +1123,9 @@ void Node::prepareMemory(const DnnlMemoryDescPtr& intDesc, size_t indx) {
         Memory memory{engine, newDesc, internalBlob->getData()};
 
         MemoryPtr _ptr = std::make_shared<Memory>(engine, intDesc);
+        if (const auto& weightCache = context->getWeightsCache()) {
+            weightCache->place(*_ptr);
+        }
         node::Reorder::reorderData(memory,
                                    *_ptr,
                                    context->getParamsCache(),
@@ -1152,6 +1163,9 @@ MemoryPtr Node::prepareWeightMemory(DnnlMemoryDescPtr dstWeightDesc, DnnlMemoryD
     auto create = [&]() {
         Memory srcMemory{getEngine(), srcWeightDesc, edgeMem->getData()};
         MemoryPtr _ptr = std::make_shared<Memory>(getEngine(), dstWeightDesc);
+        if (const auto& weightCache = context->getWeightsCache()) {
+            weightCache->place(*_ptr);
+        }
         node::Reorder::reorderData(srcMemory,
                                    *_ptr,
                                    context->getParamsCache(),
@@ -1166,7 +1180,8 @@ MemoryPtr Node::prepareWeightMemory(DnnlMemoryDescPtr dstWeightDesc, DnnlMemoryD
     OPENVINO_ASSERT(privateWeightCache, "privateWeightCache is nullptr");
 
     auto itr = privateWeightCache->find(format);
-    if (privateWeightCache->end() != itr) {
+    // the format does not include the precision, and the cache may be seeded from the compiled blob
+    if (privateWeightCache->end() != itr && itr->second->getDesc().isCompatible(*dstWeightDesc)) {
         return itr->second;
     }
 
@@ -1202,12 +1217,14 @@ void Node::toNumaNodeImpl(int numaNodeID) {
         primArgs[DNNL_ARG_SCRATCHPAD] = scratchpadMem->getPrimitive();
     }
 
-    // mbind constant prim args to numa nodes
-    if (auto it = primArgs.find(DNNL_ARG_WEIGHTS); it != primArgs.end()) {
-        mbind_move(it->second, numaNodeID);
-    }
-    if (auto it = primArgs.find(DNNL_ARG_BIAS); it != primArgs.end()) {
-        mbind_move(it->second, numaNodeID);
+    // mbind constant prim args to numa nodes, the other policies place the weights when they are created
+    if (WeightsSharing::followsStreamNode(context->getWeightsCache())) {
+        if (auto it = primArgs.find(DNNL_ARG_WEIGHTS); it != primArgs.end()) {
+            mbind_move(it->second, numaNodeID);
+        }
+        if (auto it = primArgs.find(DNNL_ARG_BIAS); it != primArgs.end()) {
+            mbind_move(it->second, numaNodeID);
+        }
     }
 
     curNumaNode = numaNodeID;
@@ -418,6 +418,11 @@ public:
         return originalLayers;
     }
 
+    // weights repacked by the node, keyed by the serialized format of the layout
+    const std::shared_ptr<std::unordered_map<std::string, MemoryPtr>>& getPrivateWeightCache() const {
+        return privateWeightCache;
+    }
+
     Type getType() const {
         return type;
     }
@@ -20,6 +20,7 @@
 #include "nodes/executors/memory_arguments.hpp"
 #include "onednn/iml_type_mapper.h"
 #include "utils/debug_capabilities.h"
+#include "weights_cache.hpp"
 
 namespace ov::intel_cpu {
 
@@ -83,6 +84,11 @@ public:
         m_scratchPadMemory = m_context->getScratchPad()->createScratchPadMem(newPrimMemDesc);
         m_primArgs[DNNL_ARG_SCRATCHPAD] = m_scratchPadMemory->getPrimitive();
 
+        if (!WeightsSharing::followsStreamNode(m_context->getWeightsCache())) {
+            curNumaNode = numaNodeID;
+            return;
+        }
+
         if (auto it = m_primArgs.find(DNNL_ARG_WEIGHTS); it != m_primArgs.end()) {
             if (!mbind_move(it->second, numaNodeID)) {
                 DEBUG_LOG("[FullyConnected] move DNNL_ARG_WEIGHTS to node ", numaNodeID, " failed");
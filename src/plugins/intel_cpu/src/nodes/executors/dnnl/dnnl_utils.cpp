@@ -58,7 +58,8 @@ MemoryPtr prepareWeightsMemory(const DnnlMemoryDescPtr& srcWeightDesc,
     const auto format = dstWeightDesc->serializeFormat();
     if (privateWeightCache) {
         auto itr = privateWeightCache->find(format);
-        if (privateWeightCache->end() != itr) {
+        // entries imported with the compiled blob may differ from the runtime descriptor in precision
+        if (privateWeightCache->end() != itr && itr->second->getDesc().isCompatible(*dstWeightDesc)) {
             return itr->second;
         }
     }
@@ -74,6 +75,9 @@ MemoryPtr prepareWeightsMemory(const DnnlMemoryDescPtr& srcWeightDesc,
             // prevent reorderData from doing conversion
             Memory srcMemory{eng, srcWeightDesc->cloneWithNewPrecision(dst_wdt), weightsMem->getData()};
             MemoryPtr _ptr = std::make_shared<Memory>(eng, dstWeightDesc);
+            if (globalWeightCache) {
+                globalWeightCache->place(*_ptr);
+            }
             node::Reorder::reorderData(srcMemory, *_ptr, rtCache, threadPool);
 
             // do shift
@@ -98,6 +102,9 @@ MemoryPtr prepareWeightsMemory(const DnnlMemoryDescPtr& srcWeightDesc,
 
         Memory srcMemory{eng, srcWeightDesc, weightsMem->getData()};
         MemoryPtr _ptr = std::make_shared<Memory>(eng, dstWeightDesc);
+        if (globalWeightCache) {
+            globalWeightCache->place(*_ptr);
+        }
         node::Reorder::reorderData(srcMemory, *_ptr, rtCache, threadPool);
 
         return _ptr;
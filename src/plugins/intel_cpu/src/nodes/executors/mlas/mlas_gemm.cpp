@@ -22,6 +22,7 @@
 #include "nodes/executors/mlas/mlas_gemm.hpp"
 #include "openvino/core/type/element_type.hpp"
 #include "utils/debug_capabilities.h"
+#include "weights_cache.hpp"
 
 namespace ov::intel_cpu {
 
@@ -52,6 +53,9 @@ static MemoryPtr prepareWeightMemory(const MemoryPtr weightsMemory,
 
         MemoryPtr _ptr = std::make_shared<Memory>(context->getEngine(),
                                                   intel_cpu::CpuBlockedMemoryDesc(i8, intel_cpu::Shape{packedBsize}));
+        if (const auto& weightCache = context->getWeightsCache()) {
+            weightCache->place(*_ptr);
+        }
         auto* prepackedDst = _ptr->getDataAs<float>();
         DEBUG_LOG("MlasGemmExecutor: cache miss, perform packing");
         mlas_sgemm_pack(weightsTransposed ? "T" : "F", N, K, ldb, weightPtr, prepackedDst);
@@ -107,7 +111,8 @@ MlasGemmExecutor::MlasGemmExecutor(const FCAttrs& attrs, const MemoryArgs& memor
       packedWeights(prepareWeightMemory(memory.at(ARG_WEI), context, !attrs.weightsNonTransposed)),
 
       N(batchDim(memory.at(ARG_WEI)->getStaticDims())),
-      K(memory.at(ARG_WEI)->getStaticDims().back()) {}
+      K(memory.at(ARG_WEI)->getStaticDims().back()),
+      followStreamNode(WeightsSharing::followsStreamNode(context->getWeightsCache())) {}
 
 bool MlasGemmExecutor::update(const MemoryArgs& memory) {
     const auto& dstDesc = memory.at(ARG_DST)->getDescPtr();
@@ -149,6 +154,9 @@ void MlasGemmExecutor::moveMemToNumaNode(int numaNodeID) {
         return;
     }
     curNumaNode = numaNodeID;
+    if (!followStreamNode) {
+        return;
+    }
     mbind_move(packedWeights, numaNodeID);
     if (!m_memoryArgs.at(ARG_BIAS)->getDesc().empty()) {
         mbind_move(m_memoryArgs.at(ARG_BIAS), numaNodeID);
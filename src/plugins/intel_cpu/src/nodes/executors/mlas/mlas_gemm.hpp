@@ -36,6 +36,7 @@ private:
     const MemoryCPtr packedWeights;
     int64_t M = 0, N, K;
     int curNumaNode = -1;
+    bool followStreamNode;
 };
 
 using MlasGemmExecutorPtr = std::shared_ptr<MlasGemmExecutor>;
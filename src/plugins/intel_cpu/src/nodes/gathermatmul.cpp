@@ -7,6 +7,7 @@
 #include <oneapi/dnnl/dnnl_common_types.h>
 #include <oneapi/dnnl/dnnl_types.h>
 
+#include <algorithm>
 #include <bitset>
 #include <common/primitive_hashing_utils.hpp>
 #include <common/utils.hpp>
@@ -38,6 +39,7 @@
 #include "onednn/iml_type_mapper.h"
 #include "openvino/core/except.hpp"
 #include "openvino/core/node.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/core/type.hpp"
 #include "openvino/core/type/element_type.hpp"
 #include "openvino/op/constant.hpp"
@@ -114,9 +116,8 @@ public:
         m_output_md =
             dnnl::memory::desc(dnnl::memory::dims({M, N}), src_md.get_data_type(), dnnl::memory::format_tag::ab);
 
-        dnnl::memory::desc bias_md;
         if (m_has_bias) {
-            bias_md =
+            m_bias_md =
                 dnnl::memory::desc(dnnl::memory::dims({N}), dnnl::memory::data_type::f32, dnnl::memory::format_tag::a);
         }
 
@@ -125,7 +126,7 @@ public:
                                                         dnnl::prop_kind::forward_inference,
                                                         m_input_md,
                                                         weights_md,
-                                                        bias_md,
+                                                        m_bias_md,
                                                         m_output_md,
                                                         attr);
 
@@ -139,7 +140,7 @@ public:
         dnnl::memory wei_memory(m_wei_md, eng, DNNL_MEMORY_NONE);
         dnnl::memory bias_memory;
         if (m_has_bias) {
-            bias_memory = dnnl::memory(bias_md, eng, DNNL_MEMORY_NONE);
+            bias_memory = dnnl::memory(m_bias_md, eng, DNNL_MEMORY_NONE);
         }
         dnnl::memory scale_memory;
         if (!scale_shape.empty()) {
@@ -174,6 +175,33 @@ public:
         m_prim.execute(astream, args);
     }
 
+    // the same as exec, but may be called from several threads at once, as the memory objects are created per call
+    void exec_concurrently(const dnnl::stream& astream,
+                           void* src,
+                           void* dst,
+                           void* weight,
+                           void* bias = nullptr,
+                           void* scale = nullptr,
+                           void* zp = nullptr) const {
+        const auto eng = astream.get_engine();
+        dnnl::memory inp_memory(m_input_md, eng, src);
+        dnnl::memory out_memory(m_output_md, eng, dst);
+        dnnl::memory wei_memory(m_wei_md, eng, weight);
+        dnnl::memory bias_memory;
+        if (bias) {
+            bias_memory = dnnl::memory(m_bias_md, eng, bias);
+        }
+        dnnl::memory scale_memory;
+        if (scale) {
+            scale_memory = dnnl::memory(m_scale_md, eng, scale);
+        }
+        dnnl::memory zp_memory;
+        if (zp) {
+            zp_memory = dnnl::memory(m_zp_md, eng, zp);
+        }
+        m_prim.execute(astream, make_args(inp_memory, out_memory, wei_memory, bias_memory, scale_memory, zp_memory));
+    }
+
     [[nodiscard]] dnnl::memory::desc get_weights_md() const {
         return m_wei_md;
     }
@@ -229,6 +257,7 @@ private:
     dnnl::memory::desc m_input_md;
     dnnl::memory::desc m_output_md;
     dnnl::memory::desc m_wei_md;
+    dnnl::memory::desc m_bias_md;
     dnnl::memory::desc m_scale_md;
     dnnl::memory::desc m_zp_md;
     dnnl::primitive_attr attr;
@@ -388,11 +417,6 @@ void GatherMatmul::initSupportedPrimitiveDescriptors() {
 
     NodeConfig nodeConfig;
 
-    if (srcTypes.front() == ov::element::bf16 && dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx512_core_amx)) {
-        // enable bf16 amx optimizations
-        bf16_amx_mode = true;
-    }
-
     const auto& creatorsMap = BlockedDescCreator::getCommonCreators();
     for (size_t i = 0; i < srcTypes.size(); i++) {
         if (srcTypes[i] == element::dynamic) {
@@ -546,7 +570,7 @@ void GatherMatmul::createPrimitive() {
 }
 
 bool GatherMatmul::needPrepareParams() const {
-    if (bf16_amx_mode && Node::needPrepareParams()) {
+    if (Node::needPrepareParams()) {
         auto srcMem = getSrcMemoryAtPort(DATA);
         const auto& srcShape = srcMem->getStaticDims();
         const auto M = srcShape[1];
@@ -557,7 +581,8 @@ bool GatherMatmul::needPrepareParams() const {
     return false;
 }
 
-// AMX tile has 16 rows, so to avoid partial tiles it's better to pad M dimension to 16 multiple
+// AMX tile has 16 rows, so to avoid partial tiles it's better to pad M dimension to 16 multiple. The padding also
+// bounds the number of the gemm primitives created for the different numbers of tokens routed to an expert.
 static Dim normalizeM(Dim M) {
     if (M < 512) {
         M = rnd_up(M, 16);
@@ -569,10 +594,16 @@ static Dim normalizeM(Dim M) {
     return M;
 }
 
+// Upper bound of the rows taken by numRows rows split into up to numGroups groups, each padded by normalizeM: a group
+// gets up to 31 padding rows, and only the groups of at least 1024 rows may get up to 255.
+static Dim maxNormalizedRows(Dim numRows, Dim numGroups) {
+    return numRows + numGroups * 31 + numRows / 1024 * 255;
+}
+
 void GatherMatmul::prepareParams() {
     auto srcMem = getSrcMemoryAtPort(DATA);
     const auto& srcShape = srcMem->getStaticDims();
-    const Dim M = normalizeM(srcShape[1]);
+    const auto& indexShape = getSrcMemoryAtPort(INDICES)->getStaticDims();
     const auto& creatorsMap = BlockedDescCreator::getCommonCreators();
 
     const auto srcPrc = srcMem->getDesc().getPrecision();
@@ -580,17 +611,31 @@ void GatherMatmul::prepareParams() {
     auto dstMem = getDstMemoryAtPort(0);
     const auto& dstShape = dstMem->getStaticDims();
 
-    m_tmpInputDesc = creatorsMap.at(LayoutType::ncsp)->createSharedDesc(srcPrc, Shape({M, srcShape[2]}));
-    m_tmpOutputDesc = creatorsMap.at(LayoutType::ncsp)->createSharedDesc(srcPrc, Shape({M, dstShape[2]}));
+    // all the routed tokens are packed into the temporary buffer expert by expert
+    const Dim routedRows = indexShape[0] * indexShape[1];
+    const Dim numExperts = m_weightsMemory->getStaticDims()[0];
+    m_maxPackedRows = maxNormalizedRows(routedRows, std::min(routedRows, numExperts));
+
+    m_tmpInputDesc = creatorsMap.at(LayoutType::ncsp)->createSharedDesc(srcPrc, Shape({m_maxPackedRows, srcShape[2]}));
+    m_tmpOutputDesc = creatorsMap.at(LayoutType::ncsp)->createSharedDesc(srcPrc, Shape({m_maxPackedRows, dstShape[2]}));
 
     const size_t srcSize = rnd_up(m_tmpInputDesc->getCurrentMemSize(), 64);  // 64 bytes is the cache line size
     const size_t totalSize = srcSize + m_tmpOutputDesc->getCurrentMemSize();
     auto scratchPadDesc = creatorsMap.at(LayoutType::ncsp)->createSharedDesc(ov::element::u8, Shape({totalSize}));
     m_tmpInpBuffer = getScratchPadMem(scratchPadDesc);
+}
+
+GatherMatmul::GemvImplPtr GatherMatmul::getGemmImpl(Dim M) {
+    const auto found = gemm_impls.find(M);
+    if (found != gemm_impls.end()) {
+        return found->second;
+    }
 
     CPU_NODE_ASSERT(gemv_impl, "GEMV implementation is not created");
 
-    dnnl::memory::desc src_md({static_cast<dnnl::memory::dim>(M), static_cast<dnnl::memory::dim>(srcShape[2])},
+    const auto srcPrc = getSrcMemoryAtPort(DATA)->getDesc().getPrecision();
+    const auto K = getSrcMemoryAtPort(DATA)->getStaticDims()[2];
+    dnnl::memory::desc src_md({static_cast<dnnl::memory::dim>(M), static_cast<dnnl::memory::dim>(K)},
                               DnnlExtensionUtils::ElementTypeToDataType(srcPrc),
                               dnnl::memory::format_tag::ab);
     auto weights_md = gemv_impl->get_weights_md();
@@ -622,9 +667,22 @@ void GatherMatmul::prepareParams() {
 
     auto cache = context->getParamsCache();
     const auto& eng = getEngine();
-    std::tie(gemm_impl, std::ignore) = cache->getOrCreate(key, [&eng](const onednn_matmul_key& k) {
-        return std::make_shared<onednn_matmul>(eng, k);
-    });
+    GemvImplPtr impl = nullptr;
+    try {
+        std::tie(impl, std::ignore) = cache->getOrCreate(key, [&eng](const onednn_matmul_key& k) {
+            return std::make_shared<onednn_matmul>(eng, k);
+        });
+    } catch (const dnnl::error&) {
+        // the weights are repacked for the gemv, no gemm implementation may accept such a layout, so the tokens of
+        // this size are computed by the gemv one by one
+        impl = nullptr;
+    }
+    if (impl && (impl->get_impl_type() & impl_desc_type::ref)) {
+        // the reference gemm is slower than the optimized gemv
+        impl = nullptr;
+    }
+    gemm_impls.emplace(M, impl);
+    return impl;
 }
 
 bool GatherMatmul::isExecutable() const {
@@ -751,88 +809,146 @@ void GatherMatmul::execute(const dnnl::stream& strm) {
             }
         }
 
-        if (bf16_amx_mode) {
-            // When AMX is available, we use GEMM for better performance
-            // first we pack all the tokens corresponding to a specific expert into a temporary buffer
-            // then we call GEMM for that expert on that temporary buffer
-            // and finally scatter the results to result memory
-            CPU_NODE_ASSERT(m_tmpInpBuffer, "Temporary input/output memory is not created");
-            CPU_NODE_ASSERT(m_tmpInputDesc, "Temporary input memory desc is not created");
-            CPU_NODE_ASSERT(m_tmpOutputDesc, "Temporary output memory desc is not created");
+        // The tokens routed to an expert are packed into a temporary buffer, multiplied by a single gemm, so the
+        // expert weights are read and decompressed once per group instead of once per token, and then scattered to
+        // the output. The experts with a single token or without an applicable gemm use the gemv per token.
+        struct ExpertGroup {
+            size_t expert;
+            size_t rows;
+            size_t row_offset;  // in the temporary buffers
+            GemvImplPtr gemm;
+        };
+        std::vector<ExpertGroup> groups;
+        for (size_t gather_axis_index = 0; gather_axis_index < gather_axis_size; gather_axis_index++) {
+            const size_t num_rows = elements_per_gather_indx[gather_axis_index];
+            if (num_rows > 0) {
+                groups.push_back({gather_axis_index, num_rows, 0, nullptr});
+            }
+        }
+        // the biggest groups go first
+        std::stable_sort(groups.begin(), groups.end(), [](const ExpertGroup& lhs, const ExpertGroup& rhs) {
+            return lhs.rows > rhs.rows;
+        });
+
+        std::vector<size_t> packed_groups;  // the indices of the groups computed by gemm
+        std::vector<size_t> packed_offsets;
+        size_t packed_rows = 0;
+        for (size_t i = 0; i < groups.size(); i++) {
+            auto& group = groups[i];
+            if (group.rows > 1) {
+                group.gemm = getGemmImpl(normalizeM(group.rows));
+            }
+            if (group.gemm) {
+                group.row_offset = packed_rows;
+                packed_groups.push_back(i);
+                packed_offsets.push_back(packed_rows);
+                packed_rows += normalizeM(group.rows);
+            }
+        }
+
+        CPU_NODE_ASSERT(m_tmpInpBuffer, "Temporary input/output memory is not created");
+        CPU_NODE_ASSERT(m_tmpInputDesc, "Temporary input memory desc is not created");
+        CPU_NODE_ASSERT(m_tmpOutputDesc, "Temporary output memory desc is not created");
+        CPU_NODE_ASSERT(packed_rows <= m_maxPackedRows, "Temporary memory is too small for ", packed_rows, " rows");
 
-            const auto element_size = m_tmpInputDesc->getPrecision().size();
-            const auto K_size = m_tmpInputDesc->getShape().getStaticDims()[1];
-            const auto M_size = m_tmpInputDesc->getShape().getStaticDims()[0];
-            const auto N_size = dstMem->getStaticDims()[2];
+        const auto element_size = m_tmpInputDesc->getPrecision().size();
+        const auto K_size = m_tmpInputDesc->getShape().getStaticDims()[1];
+        const auto N_size = dstMem->getStaticDims()[2];
 
-            auto* input_ptr = m_tmpInpBuffer->getDataAs<uint8_t>();
-            auto* output_ptr =
-                input_ptr + rnd_up(m_tmpInputDesc->getCurrentMemSize(), 64);  // 64 bytes is the cache line size
+        auto* input_ptr = m_tmpInpBuffer->getDataAs<uint8_t>();
+        auto* output_ptr =
+            input_ptr + rnd_up(m_tmpInputDesc->getCurrentMemSize(), 64);  // 64 bytes is the cache line size
 
-            Memory tmpInput(getEngine(), m_tmpInputDesc, input_ptr);
-            Memory tmpOutput(getEngine(), m_tmpOutputDesc, output_ptr);
+        Memory tmpInput(getEngine(), m_tmpInputDesc, input_ptr);
+        Memory tmpOutput(getEngine(), m_tmpOutputDesc, output_ptr);
 
-            auto tmp_input_offset = OffsetHelper::createOffsetHelper(tmpInput);
-            auto tmp_dst_offset = OffsetHelper::createOffsetHelper(tmpOutput);
+        auto tmp_input_offset = OffsetHelper::createOffsetHelper(tmpInput);
+        auto tmp_dst_offset = OffsetHelper::createOffsetHelper(tmpOutput);
 
-            CPU_NODE_ASSERT(gemm_impl, "GEMM implementation is not created");
-            for (size_t gather_axis_index = 0; gather_axis_index < gather_axis_size; gather_axis_index++) {
-                const size_t num_valid_rows = elements_per_gather_indx[gather_axis_index];
-                if (0 == num_valid_rows) {
-                    continue;
-                }
+        // the packed row -> {the group, the row in the group}
+        auto find_packed_row = [&](size_t row) {
+            const auto it = std::upper_bound(packed_offsets.begin(), packed_offsets.end(), row) - 1;
+            return std::make_pair(packed_groups[it - packed_offsets.begin()], row - *it);
+        };
 
-                cpu_parallel->parallel_for(M_size, [&](size_t m) {
-                    auto* dst_row = tmp_input_offset(m);
-
-                    if (m < num_valid_rows) {
-                        const auto row_id = gather_idx_map[gather_axis_index * M + m].first;
-                        const auto batch_index = gather_idx_map[gather_axis_index * M + m].second;
-                        const auto* src_data = src_offset(batch_index, row_id);
-                        std::memcpy(dst_row, src_data, K_size * element_size);
-                    } else {
-                        // Zero padding for rows beyond num_valid_tokens
-                        std::memset(dst_row, 0, K_size * element_size);
-                    }
-                });
-
-                auto* src = tmp_input_offset.get_base();
-                auto* dst = tmp_dst_offset.get_base();
-                auto* wei = wei_offset(gather_axis_index);
-                auto* bias = bias_offset(gather_axis_index);
-                auto* scale = scale_offset(gather_axis_index);
-                auto* zp = zp_offset(gather_axis_index);
-                gemm_impl->exec(strm, src, dst, wei, bias, scale, zp);
-
-                // Immediately scatter results while they're hot in cache
-                cpu_parallel->parallel_for(num_valid_rows, [&](size_t m) {
-                    const auto* src_row = tmp_dst_offset(m);
-                    const auto row_id = gather_idx_map[gather_axis_index * M + m].first;
-                    const auto batch_index = gather_idx_map[gather_axis_index * M + m].second;
-                    auto* dst_row = dst_offset(batch_index, row_id);
-                    std::memcpy(dst_row, src_row, N_size * element_size);
-                });
+        cpu_parallel->parallel_for(packed_rows, [&](size_t row) {
+            const auto [group_idx, m] = find_packed_row(row);
+            const auto& group = groups[group_idx];
+            auto* dst_row = tmp_input_offset(row);
+            if (m < group.rows) {
+                const auto& gather_idx = gather_idx_map[group.expert * M + m];
+                const auto* src_data = src_offset(gather_idx.second, gather_idx.first);
+                std::memcpy(dst_row, src_data, K_size * element_size);
+            } else {
+                // Zero padding for rows beyond num_valid_tokens
+                std::memset(dst_row, 0, K_size * element_size);
             }
-        } else {
-            // For the default SIMD it's better to simply call GEMV
-            CPU_NODE_ASSERT(gemv_impl, "GEMM implementation is not created");
-            for (size_t gather_axis_index = 0; gather_axis_index < gather_axis_size; gather_axis_index++) {
-                if (0 == elements_per_gather_indx[gather_axis_index]) {
-                    continue;
+        });
+
+        auto compute_group = [&](const ExpertGroup& group, bool concurrently) {
+            auto* wei = wei_offset(group.expert);
+            auto* bias = bias_offset(group.expert);
+            auto* scale = scale_offset(group.expert);
+            auto* zp = zp_offset(group.expert);
+            if (group.gemm) {
+                auto* src = tmp_input_offset(group.row_offset);
+                auto* dst = tmp_dst_offset(group.row_offset);
+                if (concurrently) {
+                    group.gemm->exec_concurrently(strm, src, dst, wei, bias, scale, zp);
+                } else {
+                    group.gemm->exec(strm, src, dst, wei, bias, scale, zp);
                 }
-                auto* wei = wei_offset(gather_axis_index);
-                auto* bias = bias_offset(gather_axis_index);
-                auto* scale = scale_offset(gather_axis_index);
-                auto* zp = zp_offset(gather_axis_index);
-                for (int32_t m = 0; m < elements_per_gather_indx[gather_axis_index]; ++m) {
-                    const auto row_id = gather_idx_map[gather_axis_index * M + m].first;
-                    const auto batch_index = gather_idx_map[gather_axis_index * M + m].second;
-                    auto* src = src_offset(batch_index, row_id);
-                    auto* dst = dst_offset(batch_index, row_id);
+                return;
+            }
+            CPU_NODE_ASSERT(gemv_impl, "GEMV implementation is not created");
+            for (size_t m = 0; m < group.rows; ++m) {
+                const auto& gather_idx = gather_idx_map[group.expert * M + m];
+                auto* src = src_offset(gather_idx.second, gather_idx.first);
+                auto* dst = dst_offset(gather_idx.second, gather_idx.first);
+                if (concurrently) {
+                    gemv_impl->exec_concurrently(strm, src, dst, wei, bias, scale, zp);
+                } else {
                     gemv_impl->exec(strm, src, dst, wei, bias, scale, zp);
                 }
             }
+        };
+
+        // A group having at least the per thread share of the tokens is computed alone, parallelized inside the
+        // primitive. The smaller groups are computed concurrently by single threads, so the experts with a few tokens
+        // don't leave most of the threads idle. They are assigned to the least loaded thread, the biggest first.
+        const size_t nthr = parallel_get_max_threads();
+        const size_t routed_rows = M * indices_size;
+        std::vector<std::vector<size_t>> thread_groups(nthr);
+        std::vector<size_t> thread_rows(nthr, 0);
+        size_t num_concurrent_groups = 0;
+        for (size_t i = 0; i < groups.size(); i++) {
+            const auto& group = groups[i];
+            if (nthr == 1 || group.rows * nthr >= routed_rows) {
+                compute_group(group, false);
+                continue;
+            }
+            const auto ithr = std::min_element(thread_rows.begin(), thread_rows.end()) - thread_rows.begin();
+            thread_groups[ithr].push_back(i);
+            thread_rows[ithr] += group.rows;
+            num_concurrent_groups++;
+        }
+        if (num_concurrent_groups > 0) {
+            parallel_nt_static(static_cast<int>(nthr), [&](const int ithr, [[maybe_unused]] const int num_threads) {
+                for (const auto i : thread_groups[ithr]) {
+                    compute_group(groups[i], true);
+                }
+            });
         }
+
+        cpu_parallel->parallel_for(packed_rows, [&](size_t row) {
+            const auto [group_idx, m] = find_packed_row(row);
+            const auto& group = groups[group_idx];
+            if (m < group.rows) {
+                const auto& gather_idx = gather_idx_map[group.expert * M + m];
+                auto* dst_row = dst_offset(gather_idx.second, gather_idx.first);
+                std::memcpy(dst_row, tmp_dst_offset(row), N_size * element_size);
+            }
+        });
     } else {
         CPU_NODE_ASSERT(gemv_impl, "GEMM implementation is not created");
 
@@ -7,8 +7,10 @@
 #include <memory>
 #include <oneapi/dnnl/dnnl.hpp>
 #include <string>
+#include <unordered_map>
 
 #include "cpu_memory.h"
+#include "cpu_types.h"
 #include "graph_context.h"
 #include "node.h"
 #include "nodes/executors/memory_arguments.hpp"
@@ -58,10 +60,13 @@ private:
 
     using GemvImplPtr = std::shared_ptr<onednn_matmul>;
 
+    // the gemm for M rows, nullptr if the repacked weights can't be used by a gemm
+    GemvImplPtr getGemmImpl(Dim M);
+
     Algorithm algorithm = Algorithm::GatherMatmulDefault;
     MemoryArgs memory;
     GemvImplPtr gemv_impl = nullptr;
-    GemvImplPtr gemm_impl = nullptr;
+    std::unordered_map<Dim, GemvImplPtr> gemm_impls;
 
     MemoryPtr m_weightsMemory = nullptr;
     MemoryPtr m_scalesMemory = nullptr;
@@ -70,8 +75,7 @@ private:
     MemoryPtr m_tmpInpBuffer = nullptr;
     MemoryDescPtr m_tmpInputDesc = nullptr;
     MemoryDescPtr m_tmpOutputDesc = nullptr;
-
-    bool bf16_amx_mode = false;
+    Dim m_maxPackedRows = 0;
 };
 
 }  // namespace ov::intel_cpu::node
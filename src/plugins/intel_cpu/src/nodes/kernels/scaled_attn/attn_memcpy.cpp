@@ -75,8 +75,12 @@ static void attn_memcpy_kernel(const ov::intel_cpu::PlainTensor& k_input,
     size_t S = k_input.m_dims[3];
     size_t SV = v_input.m_dims[3];
     cpu_parallel->parallel_for3d(L1, B, H, [&](size_t m, size_t b, size_t h) {
-        std::memcpy(past_k_output.ptr_v(b, h, m, 0), k_input.ptr_v(b, h, m, 0), S * k_input.m_element_size);
-        std::memcpy(past_v_output.ptr_v(b, h, m, 0), v_input.ptr_v(b, h, m, 0), SV * v_input.m_element_size);
+        std::memcpy(past_k_output.ptr_v(b, h, m, 0),
+                    k_input.ptr_v(b, h, m, 0),
+                    S * k_input.m_element_size / k_input.m_sub_byte_multiplier);
+        std::memcpy(past_v_output.ptr_v(b, h, m, 0),
+                    v_input.ptr_v(b, h, m, 0),
+                    SV * v_input.m_element_size / v_input.m_sub_byte_multiplier);
     });
 }
 
@@ -1157,6 +1157,8 @@ struct MHAHelper {
 #    endif
 
         for (size_t pq = 0; pq < q_len; pq++) {
+            // causal: the query token sees the past and the query tokens up to itself
+            const auto ncausal = cur_kv_len - q_len + pq + 1;
             for (size_t h = hq_beg; h < hq_end; h++) {
                 // apply attention mask & sofmax
                 float* score = _weight.ptr<float>(ithr, h - hq_beg, pq);
@@ -1165,7 +1167,7 @@ struct MHAHelper {
                 float alibi_slope = 0.F;
                 if (alibi_slopes) {
                     alibi_slope = alibi_slopes.ptr<float>()[h];
-                    alibi_lookup = _alibi_lookup.ptr<float>() + _alibi_lookup.m_dims[0] - cur_kv_len;
+                    alibi_lookup = _alibi_lookup.ptr<float>() + _alibi_lookup.m_dims[0] - ncausal;
                 }
                 float* sink = nullptr;
                 if (sinks) {
@@ -1173,10 +1175,10 @@ struct MHAHelper {
                 }
                 if (_sliding_window) {
                     size_t start_idx = 0;
-                    size_t new_causal = cur_kv_len;
+                    size_t new_causal = ncausal;
                     float* sw_alibi_lookup = nullptr;
-                    if (cur_kv_len > _sliding_window) {
-                        start_idx = cur_kv_len - _sliding_window;
+                    if (ncausal > _sliding_window) {
+                        start_idx = ncausal - _sliding_window;
                         new_causal = _sliding_window;
                     }
                     attn_softmax_kernel<float>(score + start_idx,
@@ -1203,7 +1205,7 @@ struct MHAHelper {
                                                nullptr,
                                                nullptr,
                                                false,
-                                               cur_kv_len,
+                                               ncausal,
                                                cur_kv_len,
                                                ov::element::f32,
                                                ov::element::f32,
@@ -1220,7 +1222,7 @@ struct MHAHelper {
             }
         }
 
-        memset(_output.ptr<float>(ithr), 0, q_len * H * SV * sizeof(float));
+        memset(_output.ptr<float>(ithr), 0, q_len * _output.stride(1) * sizeof(float));
         for (size_t pv = 0, i = 0; pv < cur_kv_len; pv += _block_size, i++) {
             auto block_number = block_table[i];
             for (size_t pq = 0; pq < q_len; pq++) {
@@ -1512,6 +1514,8 @@ struct MHA {
 
     WorkItems _workitems;
 
+    size_t _small_q_len = 1;
+
     MHA(MHAHelper<DATA_TYPE, KEY_PREC, VALUE_PREC>& helper) : _helper(helper) {}
 
     // one loop to handle first and second tokens
@@ -1637,8 +1641,11 @@ struct MHA {
         // loop along HK dimension: if mixed first/second token and elements count is enough, loop HK to reuse KV in the
         // CPU cache
         //    else if elements count is small, prefer to loop H to get more work to avoid thread imbalance
+        //    else if the heaviest item of a HK group costs more than the fair share of a thread, loop H to split it
+        const bool heaviest_item_exceeds_share =
+            _workitems.get_max_attn_cost() * _helper._nthr > _workitems.get_total_attn_cost() * Hk;
         bool loop_hk = _workitems.get_reorder_max_batch_size() == past_lens.m_dims[0] ||  // if only first token, loop H
-                               attn_work_count * Hk <= 2 * _helper._nthr
+                               attn_work_count * Hk <= 2 * _helper._nthr || heaviest_item_exceeds_share
                            ? false
                            : true;  // or less than 2 work items per thread, loop H
         auto weight_h = loop_hk ? _helper.H / Hk : 1;
@@ -1664,7 +1671,28 @@ struct MHA {
             const auto q_len = static_cast<size_t>(item.q_len);
             const auto ithr = static_cast<size_t>(parallel_get_thread_num());
 
-            if (q_len == 1) {
+            if (q_len > 1 && q_len <= _small_q_len) {
+                // a few tokens, e.g. the draft tokens of the speculative decoding: the gemv like kernel of the second
+                // token with the causal mask is cheaper than reordering the whole kv cache for the first token kernel
+                const auto cur_kv_len = static_cast<size_t>(past_lens.ptr<int32_t>()[batch_in_seq]) + q_len;
+                PlainTensor sub_query;
+                sub_query.resize({q_len, _helper.H, _helper.S}, q.ptr<DATA_TYPE>(batch_in_token));
+                _helper.exec_kernel_one_bh(
+                    sub_query.permute({1, 0, 2}),
+                    k_cache,
+                    v_cache,
+                    output_emb.slice(0, batch_in_token, batch_in_token + q_len),
+                    block_indices.ptr<int32_t>() + block_indices_begins.ptr<int32_t>()[batch_in_seq],
+                    ithr,
+                    hq_beg,
+                    hq_end,
+                    hk,
+                    q_len,
+                    cur_kv_len,
+                    alibi_slopes,
+                    nullptr,
+                    sinks);
+            } else if (q_len == 1) {
                 const auto cur_kv_len = static_cast<size_t>(past_lens.ptr<int32_t>()[batch_in_seq]) + 1;
                 float* score_output = nullptr;
                 if (output_score) {
@@ -1827,15 +1855,24 @@ struct MHA {
                     const PlainTensor& score_aggregation_window,
                     const PlainTensor& sinks,
                     const std::vector<PlainTensor>& sparse_attention_mask) {
-        _workitems
-            .reset(query, past_lens, subsequence_begins, block_indices, block_indices_begins, _helper._block_size);
+        // the scores output and the sparse attention are supported by the first token kernel only
+        _small_q_len =
+            output_score || !sparse_attention_mask.empty() ? 1 : std::min(MAX_SMALL_Q_LEN, _helper._block_size);
+        _workitems.reset(query,
+                         past_lens,
+                         subsequence_begins,
+                         block_indices,
+                         block_indices_begins,
+                         _helper._block_size,
+                         _small_q_len);
         if (output_score) {
             _helper.init_score_buffers(past_lens, subsequence_begins, score_aggregation_window);
         }
 
         auto nthr = static_cast<size_t>(parallel_get_max_threads());
 
-        if (past_lens.m_dims[0] >= nthr || _workitems.get_reorder_max_batch_size() > 0) {
+        if (past_lens.m_dims[0] >= nthr || _workitems.get_reorder_max_batch_size() > 0 ||
+            _workitems.get_small_q_batch_size() > 0) {
             exec_loop_mixed(query,
                             present_key,
                             present_value,
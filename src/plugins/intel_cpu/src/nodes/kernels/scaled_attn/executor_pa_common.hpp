@@ -5,14 +5,18 @@
 
 #include <xbyak/xbyak.h>
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <openvino/core/type/element_type.hpp>
+#include <queue>
 #include <utility>
 #include <vector>
 
 #include "cpu/x64/jit_generator.hpp"
 #include "cpu_memory.h"
+#include "openvino/core/parallel.hpp"
 #include "utils/plain_tensor.hpp"
 
 namespace ov::Extensions::Cpu {
@@ -59,12 +63,54 @@ struct PagedAttnQuantParams {
     bool is_sage_attn = false;
 };
 
+// the sequences with up to this number of query tokens and past kv (e.g. the draft tokens verified by the speculative
+// decoding) are computed like the second token: the M dimension is too small for the matrix multiplication to pay off
+constexpr size_t MAX_SMALL_Q_LEN = 16;
+
 struct AttnWorkItem {
     int32_t batch_in_reorder;  // which batch in reorder buffer will be used
     int32_t batch_in_seq;      // batch idx in sequence
     int32_t q_len;             // current sequence length, 1 for second token, 2+ for first token
     int32_t q_block_id;        // block id in this seq, valid at first token
+    int64_t cost;              // estimated cost: query tokens x visible kv tokens of the item
 };
+// Orders the attention work items for the parallel loop over them. The dynamic scheduler takes the items in order, so
+// the heaviest ones go first and the light decode items fill the tail of a mixed prefill/decode step. The static
+// scheduler gives each thread an equal contiguous range of the items (see ov::splitter), there the heaviest first order
+// would give all the prefill blocks to the first threads. So the items are dealt to the ranges heaviest first, each to
+// the range with the smallest cost so far, which interleaves the heavy and the light items.
+inline void order_attn_work_items(std::vector<AttnWorkItem>& items, size_t nthr, bool dynamic_scheduling) {
+    std::stable_sort(items.begin(), items.end(), [](const AttnWorkItem& a, const AttnWorkItem& b) {
+        return a.cost > b.cost;
+    });
+    nthr = std::min(nthr, items.size());
+    if (dynamic_scheduling || nthr <= 1) {
+        return;
+    }
+    const size_t n1 = (items.size() + nthr - 1) / nthr;
+    const size_t n2 = n1 - 1;
+    const size_t t1 = items.size() - n2 * nthr;
+    std::vector<std::vector<AttnWorkItem>> ranges(nthr);
+    using Load = std::pair<int64_t /*cost*/, size_t /*range*/>;
+    std::priority_queue<Load, std::vector<Load>, std::greater<>> loads;
+    for (size_t t = 0; t < nthr; t++) {
+        ranges[t].reserve(t < t1 ? n1 : n2);
+        loads.emplace(0, t);
+    }
+    for (const auto& item : items) {
+        const auto [cost, t] = loads.top();
+        loads.pop();
+        ranges[t].push_back(item);
+        if (ranges[t].size() < (t < t1 ? n1 : n2)) {
+            loads.emplace(cost + item.cost, t);
+        }
+    }
+    items.clear();
+    for (const auto& range : ranges) {
+        items.insert(items.end(), range.begin(), range.end());
+    }
+}
+
 struct ReorderWorkItem {
     int32_t batch_in_seq;      // batch idx in sequence
     int32_t batch_in_reorder;  // which batch in reorder buffer will be used
@@ -79,19 +125,28 @@ private:
     int32_t max_kv_len_in_reorder = 0;  // max kv len between first tokens
     int32_t max_batch_in_reorder = 0;
     int32_t total_kv_len = 0;
+    int64_t max_attn_cost = 0;
+    int64_t total_attn_cost = 0;
+    int32_t small_q_batch = 0;  // sequences with 2..small_q_len query tokens
 
 public:
+    // The sequences with up to small_q_len query tokens (e.g. the draft tokens verified by the speculative decoding)
+    // are computed like the second token by a single work item, so their kv cache is not reordered.
     void reset([[maybe_unused]] const ov::intel_cpu::PlainTensor& query,
                const ov::intel_cpu::PlainTensor& past_lens,
                const ov::intel_cpu::PlainTensor& subsequence_begins,
                const ov::intel_cpu::PlainTensor& block_indices,
                const ov::intel_cpu::PlainTensor& block_indices_begins,
-               size_t block_size) {
+               size_t block_size,
+               size_t small_q_len = 1) {
         attn_items.clear();
         reorder_items.clear();
         max_kv_len_in_reorder = 0;
         max_batch_in_reorder = 0;
         total_kv_len = 0;
+        max_attn_cost = 0;
+        total_attn_cost = 0;
+        small_q_batch = 0;
         auto seq_cout = static_cast<int32_t>(past_lens.m_dims[0]);
         for (int32_t i = 0; i < seq_cout; i++) {
             auto q_len = subsequence_begins.ptr<int32_t>()[i + 1] - subsequence_begins.ptr<int32_t>()[i];
@@ -101,8 +156,16 @@ public:
                 attn_items.emplace_back(AttnWorkItem{0,     // batch_in_reorder
                                                      i,     // batch_in_seq
                                                      1ULL,  // q_len
-                                                     // kv_len in blocks, used in the sort function
-                                                     kv_len_in_block - 1});
+                                                     // kv_len in blocks
+                                                     kv_len_in_block - 1,
+                                                     kv_len});  // cost
+            } else if (static_cast<size_t>(q_len) <= small_q_len) {
+                attn_items.emplace_back(AttnWorkItem{0,                          // batch_in_reorder
+                                                     i,                          // batch_in_seq
+                                                     q_len,                      // q_len
+                                                     0,                          // q_block_id
+                                                     int64_t{q_len} * kv_len});  // cost
+                small_q_batch++;
             } else {
                 auto reorder_sub_work_count = kv_len_in_block;
                 max_kv_len_in_reorder = std::max(max_kv_len_in_reorder, kv_len);
@@ -119,18 +182,29 @@ public:
 
                 // workitems for attention
                 auto attn_sub_work_count = static_cast<int32_t>(ov::intel_cpu::div_up(q_len, block_size));
+                const auto past_len = past_lens.ptr<int32_t>()[i];
                 for (int32_t block_id = 0; block_id < attn_sub_work_count; block_id++) {
+                    // causal: the queries of the block see the past and the tokens up to the block end
+                    const auto q_end = std::min<int64_t>(q_len, (block_id + 1) * static_cast<int64_t>(block_size));
+                    const auto q_cnt = q_end - block_id * static_cast<int64_t>(block_size);
                     attn_items.emplace_back(AttnWorkItem{
-                        max_batch_in_reorder,  // batch_in_reorder
-                        i,                     // batch_in_seq
-                        q_len,                 // q_len
-                        block_id               // q_block_id
+                        max_batch_in_reorder,       // batch_in_reorder
+                        i,                          // batch_in_seq
+                        q_len,                      // q_len
+                        block_id,                   // q_block_id
+                        q_cnt * (past_len + q_end)  // cost
                     });
                 }
                 max_batch_in_reorder++;
             }
             total_kv_len += kv_len;
         }
+        // parallel_for2d_dynamic falls back to the static split without TBB
+        order_attn_work_items(attn_items, static_cast<size_t>(parallel_get_max_threads()), OV_THREAD_USE_TBB != 0);
+        for (const auto& item : attn_items) {
+            max_attn_cost = std::max(max_attn_cost, item.cost);
+            total_attn_cost += item.cost;
+        }
     }
     [[nodiscard]] const AttnWorkItem& get_attn_work_item(size_t idx) const {
         return attn_items[idx];
@@ -153,6 +227,15 @@ public:
     [[nodiscard]] size_t get_total_kv_len() const {
         return static_cast<size_t>(total_kv_len);
     }
+    [[nodiscard]] size_t get_max_attn_cost() const {
+        return static_cast<size_t>(max_attn_cost);
+    }
+    [[nodiscard]] size_t get_total_attn_cost() const {
+        return static_cast<size_t>(total_attn_cost);
+    }
+    [[nodiscard]] size_t get_small_q_batch_size() const {
+        return static_cast<size_t>(small_q_batch);
+    }
 };
 
 #ifdef OPENVINO_ARCH_X86_64
@@ -131,6 +131,21 @@ void cvt_copy(float* dst, float* src, size_t n) {
 #    endif  // defined(HAVE_SVE)
 #endif      // defined(OPENVINO_ARCH_ARM64)
 
+// The element of the u4 kv cache, a byte keeps two values, the even one in the high half. It distinguishes the u4
+// cache from the u8 one in the kernels, the tensors of both are uint8 in memory.
+struct uint4x2_t {
+    uint8_t data;
+};
+
+template <typename T, typename... Is>
+static T* cache_ptr(const ov::intel_cpu::PlainTensor& cache, Is... indices) {
+    if constexpr (std::is_same_v<T, uint4x2_t>) {
+        return cache.ptr<T, ov::element::u4>(indices...);
+    } else {
+        return cache.ptr<T>(indices...);
+    }
+}
+
 template <typename T>
 static void attn_acc_value(float* out, float weight, T* v, size_t S, float* scale, float* zp, size_t group_size) {
     size_t i = 0;
@@ -498,6 +513,50 @@ static void attn_acc_value(float* out, float weight, uint8_t* v, size_t S, float
     }
 }
 
+static void
+attn_acc_value(float* out, float weight, uint4x2_t* v, size_t S, float* scale, float* zp, size_t group_size) {
+    auto* v_u4 = reinterpret_cast<uint8_t*>(v);
+    for (size_t group_id = 0; group_id < S / group_size; group_id++) {
+        size_t i = 0;
+        float group_scale = *(scale + group_id * 2);
+        float group_zp = *(zp + group_id * 2);
+        size_t offset = group_id * group_size;
+#if defined(HAVE_AVX512F)
+        auto attn_w_vec_fp32 = _mm512_set1_ps(weight * group_scale);
+        auto v_zp = _mm512_set1_ps(group_zp);
+        for (; i + 2 * vec_len_f32_avx512 <= group_size; i += 2 * vec_len_f32_avx512) {
+            __m512 v_f32_0;
+            __m512 v_f32_1;
+            mm512_loadu_u4_to_f32(v_u4 + (offset + i) / 2, v_f32_0, v_f32_1);
+            auto v_out0 = mm512_uni_loadu_ps(out + offset + i);
+            auto v_out1 = mm512_uni_loadu_ps(out + offset + i + vec_len_f32_avx512);
+            v_out0 = _mm512_fmadd_ps(attn_w_vec_fp32, _mm512_sub_ps(v_f32_0, v_zp), v_out0);
+            v_out1 = _mm512_fmadd_ps(attn_w_vec_fp32, _mm512_sub_ps(v_f32_1, v_zp), v_out1);
+            mm512_uni_storeu_ps(out + offset + i, v_out0);
+            mm512_uni_storeu_ps(out + offset + i + vec_len_f32_avx512, v_out1);
+        }
+#elif defined(HAVE_AVX2)
+        auto attn_w_vec_fp32 = _mm256_set1_ps(weight * group_scale);
+        auto v_zp = _mm256_set1_ps(group_zp);
+        for (; i + 2 * vec_len_f32_avx2 <= group_size; i += 2 * vec_len_f32_avx2) {
+            __m256 v_f32_0;
+            __m256 v_f32_1;
+            mm256_loadu_u4_to_f32(v_u4 + (offset + i) / 2, v_f32_0, v_f32_1);
+            auto v_out0 = mm256_uni_loadu_ps(out + offset + i);
+            auto v_out1 = mm256_uni_loadu_ps(out + offset + i + vec_len_f32_avx2);
+            v_out0 = _mm256_fmadd_ps(attn_w_vec_fp32, _mm256_sub_ps(v_f32_0, v_zp), v_out0);
+            v_out1 = _mm256_fmadd_ps(attn_w_vec_fp32, _mm256_sub_ps(v_f32_1, v_zp), v_out1);
+            mm256_uni_storeu_ps(out + offset + i, v_out0);
+            mm256_uni_storeu_ps(out + offset + i + vec_len_f32_avx2, v_out1);
+        }
+#endif
+        for (; i < group_size; i++) {
+            const auto value = extract_half_byte(v_u4[(offset + i) / 2], static_cast<bool>((offset + i) % 2));
+            out[offset + i] += weight * (value - group_zp) * group_scale;
+        }
+    }
+}
+
 template <typename T>
 void sum_q_head(T* a, size_t n, size_t group_size, float* out) {
     size_t group_id = 0;
@@ -1569,6 +1628,64 @@ static float dot_product(TA* a, uint8_t* b, size_t n, float* scale, float* zp, f
 #endif
 }
 
+// The u4 values are converted to f32 by 32 (avx512) or 16 (avx2) at once, the zero point is subtracted on the fly as
+// the head_sum trick doesn't pay off for the halved memory traffic.
+template <typename TA>
+static float dot_product(TA* a,
+                         uint4x2_t* b,
+                         size_t n,
+                         float* scale,
+                         float* zp,
+                         [[maybe_unused]] float* head_sum,
+                         size_t group_size) {
+    auto* b_u4 = reinterpret_cast<uint8_t*>(b);
+    float sum = 0.0F;
+    for (size_t group_id = 0; group_id < n / group_size; group_id++) {
+        size_t i = 0;
+        float group_scale = *(scale + group_id * 2);
+        float group_zp = *(zp + group_id * 2);
+        size_t offset = group_id * group_size;
+        float group_sum = 0.0F;
+#if defined(HAVE_AVX512F)
+        auto v_zp = _mm512_set1_ps(group_zp);
+        auto vsum0 = _mm512_set1_ps(0.0F);
+        auto vsum1 = _mm512_set1_ps(0.0F);
+        for (; i + 2 * vec_len_f32_avx512 <= group_size; i += 2 * vec_len_f32_avx512) {
+            __m512 vb0;
+            __m512 vb1;
+            mm512_loadu_u4_to_f32(b_u4 + (offset + i) / 2, vb0, vb1);
+            auto va0 = mm512_uni_loadu_ps(a + offset + i);
+            auto va1 = mm512_uni_loadu_ps(a + offset + i + vec_len_f32_avx512);
+            vsum0 = _mm512_fmadd_ps(va0, _mm512_sub_ps(vb0, v_zp), vsum0);
+            vsum1 = _mm512_fmadd_ps(va1, _mm512_sub_ps(vb1, v_zp), vsum1);
+        }
+        group_sum = _mm512_reduce_add_ps(_mm512_add_ps(vsum0, vsum1));
+#elif defined(HAVE_AVX2)
+        auto v_zp = _mm256_set1_ps(group_zp);
+        auto vsum0 = _mm256_set1_ps(0.0F);
+        auto vsum1 = _mm256_set1_ps(0.0F);
+        for (; i + 2 * vec_len_f32_avx2 <= group_size; i += 2 * vec_len_f32_avx2) {
+            __m256 vb0;
+            __m256 vb1;
+            mm256_loadu_u4_to_f32(b_u4 + (offset + i) / 2, vb0, vb1);
+            auto va0 = mm256_uni_loadu_ps(a + offset + i);
+            auto va1 = mm256_uni_loadu_ps(a + offset + i + vec_len_f32_avx2);
+            vsum0 = _mm256_fmadd_ps(va0, _mm256_sub_ps(vb0, v_zp), vsum0);
+            vsum1 = _mm256_fmadd_ps(va1, _mm256_sub_ps(vb1, v_zp), vsum1);
+        }
+        vsum0 = _mm256_add_ps(vsum0, vsum1);
+        hsum(vsum0);
+        group_sum = _mm256_cvtss_f32(vsum0);
+#endif
+        for (; i < group_size; i++) {
+            const auto value = extract_half_byte(b_u4[(offset + i) / 2], static_cast<bool>((offset + i) % 2));
+            group_sum += a[offset + i] * (value - group_zp);
+        }
+        sum += group_scale * group_sum;
+    }
+    return sum;
+}
+
 template <typename T>
 static void attn_reduce(T* dst, float* temp, size_t M, size_t S, size_t temp_stride) {
     size_t i = 0;
@@ -1731,7 +1848,7 @@ static void mha_single_token_kernel(const ov::intel_cpu::PlainTensor& query,
     // avx2 will pre-compute the zero point and try to save the sub instruction in the dot_product,
     //  but it seems not necessary for avx512. Possible reason may be that for avx2 the cost of dot_product
     //  is larger than the memory access time, but for avx512 is not and the cost of pre-compute is a pure increase.
-    if (pastkv_is_int8 && !quant_key_by_channel) {
+    if (pastkv_is_int8 && !quant_key_by_channel && !std::is_same_v<T2, uint4x2_t>) {
         // be sure no false sharing
         size_t group_num = S / key_group_size;
         head_sum.resize<float>({B, H, q_len, group_num + 16});
@@ -1759,7 +1876,7 @@ static void mha_single_token_kernel(const ov::intel_cpu::PlainTensor& query,
 #if defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC)
                         if (std::is_same_v<T3, ov::float16> && std::is_same_v<T, ov::float16>) {
                             if constexpr (std::is_same_v<T2, uint8_t>) {
-                                auto p_k = present_key.ptr<T2>(0, h_group, pk);
+                                auto p_k = cache_ptr<T2>(present_key, 0, h_group, pk);
                                 prefetch_bytes(S, _MM_HINT_T0, 4096, p_k);
                                 auto _qk = dot_product_fp16<ov::element::u8>(query.ptr<ov::float16>(0, h_group),
                                                                              p_k,
@@ -1772,7 +1889,7 @@ static void mha_single_token_kernel(const ov::intel_cpu::PlainTensor& query,
                                 parallel_it_step(pk, kv_len, b, B, h_group, h_group_num);
                                 continue;
                             } else if constexpr (std::is_same_v<T2, ov::float16>) {
-                                auto p_k = present_key.ptr<T2>(0, h_group, pk);
+                                auto p_k = cache_ptr<T2>(present_key, 0, h_group, pk);
                                 prefetch_bytes(S, _MM_HINT_T0, 4096, p_k);
                                 auto _qk = dot_product_fp16<ov::element::f16>(query.ptr<ov::float16>(0, h_group),
                                                                               p_k,
@@ -1795,7 +1912,7 @@ static void mha_single_token_kernel(const ov::intel_cpu::PlainTensor& query,
                             buf_attn_w.ptr<T3>(0, h_group, 0)[pk] =
                                 dot_product_by_channel(query.ptr<T>(0, h_group), p_k, S, p_scale, p_zp, key_group_size);
                         } else {
-                            auto p_k = present_key.ptr<T2>(0, h_group, pk);
+                            auto p_k = cache_ptr<T2>(present_key, 0, h_group, pk);
                             prefetch_bytes(S, _MM_HINT_T0, 4096, p_k);
                             buf_attn_w.ptr<T3>(0, h_group, 0)[pk] = dot_product(query.ptr<T>(0, h_group),
                                                                                 p_k,
@@ -1845,7 +1962,7 @@ static void mha_single_token_kernel(const ov::intel_cpu::PlainTensor& query,
                             buf_attn_w.ptr<T3>(b, h_group, 0)[pk] =
                                 dot_product_by_channel(query.ptr<T>(b, h_group), p_k, S, p_scale, p_zp, key_group_size);
                         } else {
-                            auto p_k = present_key.ptr<T2>(b_kv, h_group, pk);
+                            auto p_k = cache_ptr<T2>(present_key, b_kv, h_group, pk);
                             buf_attn_w.ptr<T3>(b, h_group, 0)[pk] = dot_product(query.ptr<T>(b, h_group),
                                                                                 p_k,
                                                                                 S,
@@ -1900,8 +2017,9 @@ static void mha_single_token_kernel(const ov::intel_cpu::PlainTensor& query,
                                                                                           p_zp,
                                                                                           key_group_size);
                             } else {
+                                auto p_k = cache_ptr<T2>(present_key, b_kv, h_group, pk);
                                 buf_attn_w.ptr<T3>(b, h, pq)[pk] = dot_product(query.ptr<T>(b, h, pq),
-                                                                               present_key.ptr<T2>(b_kv, h_group, pk),
+                                                                               p_k,
                                                                                S,
                                                                                p,
                                                                                p + 1,
@@ -1954,7 +2072,7 @@ static void mha_single_token_kernel(const ov::intel_cpu::PlainTensor& query,
             memset(buf_attn_score.ptr<T3>(ithr), 0, q_len * h_each_group_len * SV * sizeof(T3));
             for (size_t pv = 0; pv < kv_len; pv++) {
                 auto b_kv = beams ? beams.ptr<int32_t>(b)[pv] : b;
-                auto* v = present_value.ptr<T2>(b_kv, h_group, pv);
+                auto* v = cache_ptr<T2>(present_value, b_kv, h_group, pv);
                 auto* p = past_v_scale_zp.ptr<float>(pv, b_kv, h_group);
                 for (size_t pq = 0; pq < q_len; pq++) {
                     for (size_t h = h_group * h_each_group_len, group_idx = 0; h < (h_group + 1) * h_each_group_len;
@@ -1998,7 +2116,7 @@ static void mha_single_token_kernel(const ov::intel_cpu::PlainTensor& query,
             if (intel_cpu::all_of(1U, q_len, h_each_group_len)) {
                 for (size_t iwork = start; iwork < end; ++iwork) {
                     auto b_kv = beams ? beams.ptr<int32_t>(b)[pv] : b;
-                    auto* v = present_value.ptr<T2>(b_kv, h_group, pv);
+                    auto* v = cache_ptr<T2>(present_value, b_kv, h_group, pv);
                     auto* p = past_v_scale_zp.ptr<float>(pv, b_kv, h_group);
                     attn_acc_value(buf_attn_score.ptr<T3>(ithr, b, 0, h_group),
                                    buf_attn_w.ptr<T3>(b, h_group, 0, pv)[0],
@@ -2012,7 +2130,7 @@ static void mha_single_token_kernel(const ov::intel_cpu::PlainTensor& query,
             } else {
                 for (size_t iwork = start; iwork < end; ++iwork) {
                     auto b_kv = beams ? beams.ptr<int32_t>(b)[pv] : b;
-                    auto* v = present_value.ptr<T2>(b_kv, h_group, pv);
+                    auto* v = cache_ptr<T2>(present_value, b_kv, h_group, pv);
                     auto* p = past_v_scale_zp.ptr<float>(pv, b_kv, h_group);
                     for (size_t pq = 0; pq < q_len; pq++) {
                         for (size_t h = h_group * h_each_group_len; h < (h_group + 1) * h_each_group_len; h++) {
@@ -2063,8 +2181,31 @@ void mha_single_token(const ov::intel_cpu::PlainTensor& query,
                       bool quant_key_by_channel,
                       const ov::intel_cpu::PlainTensor& sink_input,
                       const ov::intel_cpu::CpuParallelPtr& cpu_parallel) {
+    OPENVINO_ASSERT(present_key.get_precision() != ov::element::u4 || !quant_key_by_channel,
+                    "u4 key cache supports the quantization by token only");
     if (query.get_precision() == ov::element::bf16) {
-        if (present_key.get_precision() == ov::element::u8) {
+        if (present_key.get_precision() == ov::element::u4) {
+            mha_single_token_kernel<ov::bfloat16, uint4x2_t, float>(query,
+                                                                    present_key,
+                                                                    present_value,
+                                                                    alibi_mask,
+                                                                    attention_mask,
+                                                                    beams,
+                                                                    output_emb,
+                                                                    buf_attn_w,
+                                                                    buf_attn_score,
+                                                                    has_out_transpose,
+                                                                    auto_causal,
+                                                                    d_scale,
+                                                                    past_k_scale_zp,
+                                                                    past_v_scale_zp,
+                                                                    head_sum,
+                                                                    key_group_size,
+                                                                    value_group_size,
+                                                                    quant_key_by_channel,
+                                                                    sink_input,
+                                                                    cpu_parallel);
+        } else if (present_key.get_precision() == ov::element::u8) {
             mha_single_token_kernel<ov::bfloat16, uint8_t, float>(query,
                                                                   present_key,
                                                                   present_value,
@@ -2109,7 +2250,29 @@ void mha_single_token(const ov::intel_cpu::PlainTensor& query,
         }
     } else if (query.get_precision() == ov::element::f16) {
 #if defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC)
-        if (present_key.get_precision() == ov::element::f16) {
+        if (present_key.get_precision() == ov::element::u4) {
+            // there are no fp16 kernels for the u4 cache, the attention weights are kept in f32
+            mha_single_token_kernel<ov::float16, uint4x2_t, float>(query,
+                                                                   present_key,
+                                                                   present_value,
+                                                                   alibi_mask,
+                                                                   attention_mask,
+                                                                   beams,
+                                                                   output_emb,
+                                                                   buf_attn_w,
+                                                                   buf_attn_score,
+                                                                   has_out_transpose,
+                                                                   auto_causal,
+                                                                   d_scale,
+                                                                   past_k_scale_zp,
+                                                                   past_v_scale_zp,
+                                                                   head_sum,
+                                                                   key_group_size,
+                                                                   value_group_size,
+                                                                   quant_key_by_channel,
+                                                                   sink_input,
+                                                                   cpu_parallel);
+        } else if (present_key.get_precision() == ov::element::f16) {
             mha_single_token_kernel<ov::float16, ov::float16, ov::float16>(query,
                                                                            present_key,
                                                                            present_value,
@@ -2156,7 +2319,28 @@ void mha_single_token(const ov::intel_cpu::PlainTensor& query,
             OPENVINO_THROW("Unsupported precision: ", present_key.get_precision());
         }
 #else
-        if (present_key.get_precision() == ov::element::u8) {
+        if (present_key.get_precision() == ov::element::u4) {
+            mha_single_token_kernel<ov::float16, uint4x2_t, float>(query,
+                                                                   present_key,
+                                                                   present_value,
+                                                                   alibi_mask,
+                                                                   attention_mask,
+                                                                   beams,
+                                                                   output_emb,
+                                                                   buf_attn_w,
+                                                                   buf_attn_score,
+                                                                   has_out_transpose,
+                                                                   auto_causal,
+                                                                   d_scale,
+                                                                   past_k_scale_zp,
+                                                                   past_v_scale_zp,
+                                                                   head_sum,
+                                                                   key_group_size,
+                                                                   value_group_size,
+                                                                   quant_key_by_channel,
+                                                                   sink_input,
+                                                                   cpu_parallel);
+        } else if (present_key.get_precision() == ov::element::u8) {
             mha_single_token_kernel<ov::float16, uint8_t, float>(query,
                                                                  present_key,
                                                                  present_value,
@@ -2201,7 +2385,28 @@ void mha_single_token(const ov::intel_cpu::PlainTensor& query,
         }
 #endif
     } else if (query.get_precision() == ov::element::f32) {
-        if (present_key.get_precision() == ov::element::u8) {
+        if (present_key.get_precision() == ov::element::u4) {
+            mha_single_token_kernel<float, uint4x2_t, float>(query,
+                                                             present_key,
+                                                             present_value,
+                                                             alibi_mask,
+                                                             attention_mask,
+                                                             beams,
+                                                             output_emb,
+                                                             buf_attn_w,
+                                                             buf_attn_score,
+                                                             has_out_transpose,
+                                                             auto_causal,
+                                                             d_scale,
+                                                             past_k_scale_zp,
+                                                             past_v_scale_zp,
+                                                             head_sum,
+                                                             key_group_size,
+                                                             value_group_size,
+                                                             quant_key_by_channel,
+                                                             sink_input,
+                                                             cpu_parallel);
+        } else if (present_key.get_precision() == ov::element::u8) {
             mha_single_token_kernel<float, uint8_t, float>(query,
                                                            present_key,
                                                            present_value,
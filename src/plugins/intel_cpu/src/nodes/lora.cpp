@@ -4,28 +4,95 @@
 
 #include "lora.h"
 
+#include <algorithm>
+#include <common/utils.hpp>
 #include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <oneapi/dnnl/dnnl.hpp>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <string>
+#include <tuple>
+#include <utility>
 #include <vector>
 
 #include "allocation_context.hpp"
+#include "cache/multi_cache.h"
+#include "cpu_parallel.hpp"
 #include "graph_context.h"
 #include "memory_desc/blocked_memory_desc.h"
 #include "node.h"
+#include "nodes/common/cpu_convert.h"
+#include "nodes/common/cpu_memcpy.h"
 #include "nodes/input.h"
 #include "nodes/node_config.h"
 #include "onednn/iml_type_mapper.h"
 #include "openvino/core/except.hpp"
 #include "openvino/core/node.hpp"
 #include "openvino/core/type.hpp"
+#include "openvino/core/type/element_type.hpp"
 #include "ov_ops/lora_subgraph.hpp"
 #include "shape_inference/shape_inference_pass_through.hpp"
 #include "utils/debug_capabilities.h"
+#include "utils/general_utils.h"
 
 namespace ov::intel_cpu::node {
 
+struct AdapterGemmKey {
+    size_t K;
+    size_t N;
+
+    [[nodiscard]] size_t hash() const {
+        using namespace dnnl::impl;
+
+        size_t seed = 0;
+        seed = hash_combine(seed, K);
+        seed = hash_combine(seed, N);
+        return seed;
+    }
+
+    bool operator==(const AdapterGemmKey& rhs) const {
+        return K == rhs.K && N == rhs.N;
+    }
+};
+
+// dst [M, N] = src [M, K] * weights^T, the weights are taken as is from the planar [N, K] adapter matrix. M is a
+// runtime dimension, so a single primitive serves the segments of any number of rows
+class LoRA::AdapterGemm {
+public:
+    AdapterGemm(const dnnl::engine& eng, const AdapterGemmKey& key)
+        : m_K(static_cast<dnnl::memory::dim>(key.K)),
+          m_N(static_cast<dnnl::memory::dim>(key.N)) {
+        using dims = dnnl::memory::dims;
+        const dnnl::memory::desc srcMd(dims{DNNL_RUNTIME_DIM_VAL, m_K}, dataType, dnnl::memory::format_tag::ab);
+        m_weightsMd = dnnl::memory::desc(dims{m_K, m_N}, dataType, dnnl::memory::format_tag::ba);
+        const dnnl::memory::desc dstMd(dims{DNNL_RUNTIME_DIM_VAL, m_N}, dataType, dnnl::memory::format_tag::ab);
+        auto primitiveDesc = dnnl::matmul::primitive_desc(eng, srcMd, m_weightsMd, dstMd);
+        m_prim = dnnl::matmul(primitiveDesc);
+    }
+
+    void exec(const dnnl::stream& strm, size_t M, const float* src, float* dst, const float* weights) const {
+        using dims = dnnl::memory::dims;
+        const auto eng = strm.get_engine();
+        const auto rows = static_cast<dnnl::memory::dim>(M);
+        dnnl::memory srcMemory(dnnl::memory::desc(dims{rows, m_K}, dataType, dnnl::memory::format_tag::ab),
+                               eng,
+                               const_cast<float*>(src));
+        dnnl::memory weightsMemory(m_weightsMd, eng, const_cast<float*>(weights));
+        dnnl::memory dstMemory(dnnl::memory::desc(dims{rows, m_N}, dataType, dnnl::memory::format_tag::ab), eng, dst);
+        m_prim.execute(strm,
+                       {{DNNL_ARG_SRC, srcMemory}, {DNNL_ARG_WEIGHTS, weightsMemory}, {DNNL_ARG_DST, dstMemory}});
+    }
+
+private:
+    static constexpr auto dataType = dnnl::memory::data_type::f32;
+
+    dnnl::memory::dim m_K;
+    dnnl::memory::dim m_N;
+    dnnl::memory::desc m_weightsMd;
+    dnnl::primitive m_prim;
+};
+
 bool LoRA::isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept {
     try {
         if (!ov::is_type<ov::op::internal::LoraSubgraph>(op)) {
@@ -52,9 +119,37 @@ LoRA::LoRA(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr& contex
                     op->get_friendly_name());
 
     m_body = loraModel->get_function();
+    m_adapterBanks = loraModel->get_input_size() == 6;
+}
+
+void LoRA::selectAdapterBanksPrimitiveDescriptor() {
+    // the banks are consumed in their own precision, so the whole banks aren't reordered on each inference, only the
+    // matrices of the selected adapters are converted by the segmented kernel
+    auto bankPrecision = [this](size_t port) {
+        const auto precision = getOriginalInputPrecisionAtPort(port);
+        return any_of(precision, ov::element::f16, ov::element::bf16) ? precision : ov::element::f32;
+    };
+    const auto bankAPrc = bankPrecision(2);
+    const auto bankAlphaPrc = bankPrecision(3);
+    const auto bankBPrc = bankPrecision(4);
+    // the segmented kernel works with the planar f32 data and accumulates the result in place of the main flow
+    addSupportedPrimDesc({{LayoutType::ncsp, ov::element::f32},
+                          {LayoutType::ncsp, ov::element::f32},
+                          {LayoutType::ncsp, bankAPrc},
+                          {LayoutType::ncsp, bankAlphaPrc},
+                          {LayoutType::ncsp, bankBPrc},
+                          {LayoutType::ncsp, ov::element::i32}},
+                         {{LayoutType::ncsp, ov::element::f32, false, 0}},
+                         impl_desc_type::gemm_any);
+    selectPrimitiveDescriptorByIndex(0);
 }
 
 void LoRA::selectOptimalPrimitiveDescriptor() {
+    if (m_adapterBanks) {
+        selectAdapterBanksPrimitiveDescriptor();
+        return;
+    }
+
     // for the input configuration, just always use the parent configuration
     std::vector<PortConfig> inConfs;
     std::vector<Input::InputConfig> graphInputConfig;
@@ -101,6 +196,10 @@ void LoRA::selectOptimalPrimitiveDescriptor() {
 }
 
 int LoRA::registerToAllocationContext(int offset, AllocationContext& context) {
+    if (m_adapterBanks) {
+        return Node::registerToAllocationContext(offset, context);
+    }
+
     CPU_NODE_ASSERT(getOriginalInputsNumber() == m_graph.inputsNumber(),
                     "Number of node inputs must be equal the number of inner graph's inputs");
 
@@ -128,6 +227,11 @@ int LoRA::registerToAllocationContext(int offset, AllocationContext& context) {
 }
 
 void LoRA::createPrimitive() {
+    if (m_adapterBanks) {
+        Node::createPrimitive();
+        return;
+    }
+
     CPU_NODE_ASSERT(getOriginalInputsNumber() == m_graph.inputsNumber(),
                     "Number of node inputs must be equal the number of inner graph's inputs");
     // Workaround to avoid making LoRa node always executable (isExecutable() = true)
@@ -142,14 +246,153 @@ void LoRA::createPrimitive() {
 }
 
 void LoRA::execute([[maybe_unused]] const dnnl::stream& strm) {
+    if (m_adapterBanks) {
+        executeAdapterBanks(strm);
+        return;
+    }
     m_graph.Infer();
 }
 
+LoRA::AdapterGemmPtr LoRA::getAdapterGemm(size_t K, size_t N) const {
+    AdapterGemmKey key{K, N};
+    const auto& eng = getEngine();
+    AdapterGemmPtr gemm;
+    std::tie(gemm, std::ignore) = context->getParamsCache()->getOrCreate(key, [&eng](const AdapterGemmKey& k) {
+        return std::make_shared<AdapterGemm>(eng, k);
+    });
+    return gemm;
+}
+
+void LoRA::executeAdapterBanks(const dnnl::stream& strm) {
+    const auto& mainMemory = getSrcMemoryAtPort(0);
+    const auto& inputDims = getSrcMemoryAtPort(1)->getStaticDims();
+    const auto& bankDims = getSrcMemoryAtPort(2)->getStaticDims();
+    const size_t batch = inputDims[0];
+    const size_t tokens = inputDims[1];
+    const size_t K = inputDims[2];
+    const size_t adapters = bankDims[0];
+    const size_t rank = bankDims[1];
+    const size_t N = getSrcMemoryAtPort(4)->getStaticDims()[1];
+
+    const auto* main = mainMemory->getDataAs<const float>();
+    const auto* input = getSrcDataAtPortAs<const float>(1);
+    const auto* bankA = getSrcDataAtPortAs<const uint8_t>(2);
+    const auto* bankAlpha = getSrcDataAtPortAs<const uint8_t>(3);
+    const auto* bankB = getSrcDataAtPortAs<const uint8_t>(4);
+    const auto* indices = getSrcDataAtPortAs<const int32_t>(5);
+    auto* dst = getDstDataAtPortAs<float>(0);
+
+    // the adapter contribution is accumulated on top of the main flow, the rows without an adapter keep it as is
+    if (dst != main) {
+        cpu_memcpy(dst, main, mainMemory->getSize());
+    }
+
+    // the indices follow the Gather semantic: the negative ones count from the end, the rows with the out of range
+    // ones aren't adapted
+    std::vector<std::pair<size_t, size_t>> rows;  // adapter, batch row
+    rows.reserve(batch);
+    for (size_t b = 0; b < batch; b++) {
+        const auto index = static_cast<int64_t>(indices[b]) + (indices[b] < 0 ? static_cast<int64_t>(adapters) : 0);
+        if (index >= 0 && index < static_cast<int64_t>(adapters)) {
+            rows.emplace_back(static_cast<size_t>(index), b);
+        }
+    }
+    std::stable_sort(rows.begin(), rows.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs.first < rhs.first;
+    });
+
+    // the adapter matrices in f32: A [rank, K], alpha [rank], B [N, rank]
+    const auto bankAPrc = getSrcMemoryAtPort(2)->getPrecision();
+    const auto bankAlphaPrc = getSrcMemoryAtPort(3)->getPrecision();
+    const auto bankBPrc = getSrcMemoryAtPort(4)->getPrecision();
+    if (bankAPrc != ov::element::f32 || bankAlphaPrc != ov::element::f32 || bankBPrc != ov::element::f32) {
+        m_adapterWeights.resize(rank * K + rank + N * rank);
+    }
+    auto adapterMatrix = [&](const uint8_t* bank, ov::element::Type prc, size_t adapter, size_t size, size_t offset) {
+        const auto* src = bank + adapter * size * prc.size();
+        if (prc == ov::element::f32) {
+            return reinterpret_cast<const float*>(src);
+        }
+        float* converted = m_adapterWeights.data() + offset;
+        cpu_convert(src, converted, prc, ov::element::f32, size);
+        return static_cast<const float*>(converted);
+    };
+
+    // the rows selecting the same adapter form a segment, each segment is computed by two gemms:
+    // lowRank = alpha * (x * A^T) and out = lowRank * B^T, which are then added to the segment rows of the output
+    const auto& cpuParallel = context->getCpuParallel();
+    for (size_t segmentBegin = 0, segmentEnd = 0; segmentBegin < rows.size(); segmentBegin = segmentEnd) {
+        const auto adapter = rows[segmentBegin].first;
+        segmentEnd = segmentBegin + 1;
+        while (segmentEnd < rows.size() && rows[segmentEnd].first == adapter) {
+            segmentEnd++;
+        }
+        const size_t segmentRows = segmentEnd - segmentBegin;
+        const size_t M = segmentRows * tokens;
+
+        const float* a = adapterMatrix(bankA, bankAPrc, adapter, rank * K, 0);
+        const float* alpha = adapterMatrix(bankAlpha, bankAlphaPrc, adapter, rank, rank * K);
+        const float* b = adapterMatrix(bankB, bankBPrc, adapter, N * rank, rank * K + rank);
+
+        // a single row segment is dense in the input, the tokens of several rows are gathered
+        const float* x = input + rows[segmentBegin].second * tokens * K;
+        if (segmentRows > 1) {
+            m_segmentInput.resize(M * K);
+            cpuParallel->parallel_for(segmentRows, [&](size_t r) {
+                cpu_memcpy(m_segmentInput.data() + r * tokens * K,
+                           input + rows[segmentBegin + r].second * tokens * K,
+                           tokens * K * sizeof(float));
+            });
+            x = m_segmentInput.data();
+        }
+
+        m_segmentLowRank.resize(M * rank);
+        m_segmentOutput.resize(M * N);
+        getAdapterGemm(K, rank)->exec(strm, M, x, m_segmentLowRank.data(), a);
+        cpuParallel->parallel_for(M, [&](size_t t) {
+            float* lowRank = m_segmentLowRank.data() + t * rank;
+            for (size_t r = 0; r < rank; r++) {
+                lowRank[r] *= alpha[r];
+            }
+        });
+        getAdapterGemm(rank, N)->exec(strm, M, m_segmentLowRank.data(), m_segmentOutput.data(), b);
+
+        cpuParallel->parallel_for(M, [&](size_t t) {
+            const size_t row = rows[segmentBegin + t / tokens].second;
+            float* out = dst + (row * tokens + t % tokens) * N;
+            const float* contribution = m_segmentOutput.data() + t * N;
+            for (size_t n = 0; n < N; n++) {
+                out[n] += contribution[n];
+            }
+        });
+    }
+}
+
 void LoRA::executeDynamicImpl(const dnnl::stream& strm) {
     execute(strm);
 }
 
 void LoRA::prepareParams() {
+    if (m_adapterBanks) {
+        // [batch, tokens, K], [adapters, rank, K], [adapters, 1, rank], [adapters, N, rank], [batch]
+        const auto& mainDims = getSrcMemoryAtPort(0)->getStaticDims();
+        const auto& inputDims = getSrcMemoryAtPort(1)->getStaticDims();
+        const auto& bankADims = getSrcMemoryAtPort(2)->getStaticDims();
+        const auto& bankAlphaDims = getSrcMemoryAtPort(3)->getStaticDims();
+        const auto& bankBDims = getSrcMemoryAtPort(4)->getStaticDims();
+        const auto& indicesDims = getSrcMemoryAtPort(5)->getStaticDims();
+        CPU_NODE_ASSERT(inputDims.size() == 3 && mainDims.size() == 3 && bankADims.size() == 3 &&
+                            bankAlphaDims.size() == 3 && bankBDims.size() == 3 && indicesDims.size() == 1,
+                        "has unexpected ranks of the adapter banks inputs");
+        CPU_NODE_ASSERT(mainDims[0] == inputDims[0] && mainDims[1] == inputDims[1] && indicesDims[0] == inputDims[0],
+                        "has inconsistent batch of the adapter banks inputs");
+        CPU_NODE_ASSERT(bankADims[2] == inputDims[2] && bankBDims[1] == mainDims[2],
+                        "has the adapter banks inconsistent with the main flow");
+        CPU_NODE_ASSERT(bankADims[0] == bankAlphaDims[0] && bankADims[0] == bankBDims[0] && bankAlphaDims[1] == 1 &&
+                            bankAlphaDims[2] == bankADims[1] && bankBDims[2] == bankADims[1],
+                        "has inconsistent adapter banks");
+        return;
+    }
     for (size_t i = 0; i < getOriginalInputsNumber(); i++) {
         // since the external and internal descriptors are compatible, we may pass the descriptor
         subgraphMemoryPtrs[i]->redefineDesc(getSrcMemoryAtPort(i)->getDescPtr());
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <memory>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <string>
@@ -39,7 +40,22 @@ public:
     void executeDynamicImpl(const dnnl::stream& strm) override;
 
 private:
+    class AdapterGemm;
+    using AdapterGemmPtr = std::shared_ptr<AdapterGemm>;
+
+    void selectAdapterBanksPrimitiveDescriptor();
+    void executeAdapterBanks(const dnnl::stream& strm);
+    AdapterGemmPtr getAdapterGemm(size_t K, size_t N) const;
+
     std::shared_ptr<const ov::Model> m_body;
+    // the adapter per batch row is gathered from the banks, the inner graph isn't used
+    bool m_adapterBanks = false;
+    // the scratch buffers of a segment: the gathered tokens, the low rank product, the adapter contribution and
+    // the adapter matrices converted to f32 when the banks are stored in a lower precision
+    std::vector<float> m_segmentInput;
+    std::vector<float> m_segmentLowRank;
+    std::vector<float> m_segmentOutput;
+    std::vector<float> m_adapterWeights;
     std::vector<MemoryPtr> subgraphMemoryPtrs;
     Graph m_graph;
 };
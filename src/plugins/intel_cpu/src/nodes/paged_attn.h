@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <memory>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <string>
@@ -52,6 +53,9 @@ public:
 
     static bool isQuantByChannel(Config::CacheQuantMode mode, ov::element::Type precision, bool isKey);
 
+    // the number of tokens in a block of the key/value caches
+    static constexpr size_t cacheBlockSize = 32;
+
 private:
     ov::element::Type getRuntimePrecision() const override;
 
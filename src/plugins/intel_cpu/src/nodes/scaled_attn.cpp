@@ -1753,8 +1753,13 @@ ScaledDotProductAttention::ScaledDotProductAttention(const std::shared_ptr<ov::N
     const auto keyS = *(keyDims.end() - 1);
     const auto valueS = *(valueDims.end() - 1);
     CPU_NODE_ASSERT(valueCachePrecision == keyCachePrecision, "supports same key/value cache precision");
-    CPU_NODE_ASSERT(any_of(keyCachePrecision, ov::element::f32, ov::element::f16, ov::element::bf16, ov::element::u8),
-                    "supports key/value cache precision f32, f16, bf16, u8 but gets ",
+    CPU_NODE_ASSERT(any_of(keyCachePrecision,
+                           ov::element::f32,
+                           ov::element::f16,
+                           ov::element::bf16,
+                           ov::element::u8,
+                           ov::element::u4),
+                    "supports key/value cache precision f32, f16, bf16, u8, u4 but gets ",
                     keyCachePrecision);
     m_key_quant_param.groupSize = (cpuConfig.keyCacheGroupSize == 0 || keyS % cpuConfig.keyCacheGroupSize != 0)
                                       ? keyS
@@ -1881,6 +1886,15 @@ void ScaledDotProductAttention::createPrimitive() {
         m_key_quant_param.isByChannel = false;
     }
     m_value_quant_param.groupSize = cpuConfig.valueCacheGroupSize ? cpuConfig.valueCacheGroupSize : valueS;
+    if (cpuConfig.keyCachePrecision == ov::element::u4) {
+        // the u4 cache packs 2 values per byte and is read by the single token kernel in groups along S
+        OPENVINO_ASSERT(!m_key_quant_param.isByChannel,
+                        "ScaledDotProductAttention AttentionExecutor creation fails, u4 key cache supports the "
+                        "quantization by token only");
+        OPENVINO_ASSERT(m_key_quant_param.groupSize % 2 == 0 && m_value_quant_param.groupSize % 2 == 0,
+                        "ScaledDotProductAttention AttentionExecutor creation fails, u4 key/value cache requires even "
+                        "group size");
+    }
     OPENVINO_ASSERT(keyS % m_key_quant_param.groupSize == 0,
                     "ScaledDotProductAttention AttentionExecutor creation fails key state " + std::to_string(keyS) +
                         " cannot be divided by group size " + std::to_string(m_key_quant_param.groupSize));
@@ -2161,15 +2175,15 @@ void ScaledDotProductAttention::resetBeamTablePastkv(const MemoryPtr& mem_cur_k,
             cpu_parallel->parallel_for3d(B, H, L0, [&](size_t b, size_t h, size_t m) {
                 auto idx = static_cast<size_t>(table[b]);
                 auto b_kv = static_cast<size_t>(old_beam_table_k.at<int32_t>({idx, m}));
-                memcpy(&new_pastk.at<char>({b, h, m}),
-                       &old_past_k.at<char>({b_kv, h, m}),
-                       S * old_past_k.m_element_size);
-                memcpy(&new_pastv.at<char>({b, h, m}),
-                       &old_past_v.at<char>({b_kv, h, m}),
-                       SV * old_past_v.m_element_size);
+                memcpy(new_pastk.ptr_v(b, h, m),
+                       old_past_k.ptr_v(b_kv, h, m),
+                       S * old_past_k.m_element_size / old_past_k.m_sub_byte_multiplier);
+                memcpy(new_pastv.ptr_v(b, h, m),
+                       old_past_v.ptr_v(b_kv, h, m),
+                       SV * old_past_v.m_element_size / old_past_v.m_sub_byte_multiplier);
             });
         }
-        if (kvcache_precision == ov::element::u8) {
+        if (any_of(kvcache_precision, ov::element::u8, ov::element::u4)) {
             auto& old_scale_zp_k = m_k_state->get_scale_zp();
             auto& old_scale_zp_v = m_v_state->get_scale_zp();
             PlainTensor new_scale_zp_k;
@@ -2250,7 +2264,7 @@ void ScaledDotProductAttention::resetBeamTablePastkv(const MemoryPtr& mem_cur_k,
                                                             VectorDims{},
                                                             strides);
         new_internal_mem_v->redefineDesc(mem_desc_v);
-        if (kvcache_precision == ov::element::u8) {
+        if (any_of(kvcache_precision, ov::element::u8, ov::element::u4)) {
             // past_k's shape is BHLS, internal layout LBHS
             // scale_zp's shape is LBHS, internal layout LBHS
             auto newMemDesc = std::make_shared<CpuBlockedMemoryDesc>(
@@ -2559,7 +2573,7 @@ void ScaledDotProductAttention::updatePastkv(const MemoryPtr& mem_cur_k, const M
         m_v_state->assign_internal_state(new_internal_mem_v);
         m_k_state->assign_internal_state_max_size(2 * (L0 + L1) * B * H * S);
         m_v_state->assign_internal_state_max_size(2 * (L0 + L1) * B * H * SV);
-        if (kvcache_precision == ov::element::u8) {
+        if (any_of(kvcache_precision, ov::element::u8, ov::element::u4)) {
             auto& old_scale_zp_k = m_k_state->get_scale_zp();
             auto& old_scale_zp_v = m_v_state->get_scale_zp();
             PlainTensor new_scale_zp_k;
@@ -2629,7 +2643,7 @@ void ScaledDotProductAttention::updatePastkv(const MemoryPtr& mem_cur_k, const M
         };
         internal_mem_k->redefineDesc(reset_desc(S));
         internal_mem_v->redefineDesc(reset_desc(SV));
-        if (kvcache_precision == ov::element::u8) {
+        if (any_of(kvcache_precision, ov::element::u8, ov::element::u4)) {
             auto& old_scale_zp_k = m_k_state->get_scale_zp();
             auto& old_scale_zp_v = m_v_state->get_scale_zp();
             // only dim0, dim1 need change
@@ -2682,7 +2696,7 @@ void ScaledDotProductAttention::updatePastkv(const MemoryPtr& mem_cur_k, const M
             init_v.reset(v_mem);
             init_k = init_k.permute(order);
             init_v = init_v.permute(order);
-            if (kvcache_precision == ov::element::u8) {
+            if (any_of(kvcache_precision, ov::element::u8, ov::element::u4)) {
                 auto newMemDesc = std::make_shared<CpuBlockedMemoryDesc>(
                     ov::element::f32,
                     ov::intel_cpu::Shape{static_cast<size_t>(parallel_get_max_threads()),
@@ -2708,7 +2722,7 @@ void ScaledDotProductAttention::updatePastkv(const MemoryPtr& mem_cur_k, const M
         }
     }
 
-    if (kvcache_precision == ov::element::u8) {
+    if (any_of(kvcache_precision, ov::element::u8, ov::element::u4)) {
         // past_k's shape is BHLS, internal layout LBHS
         // scale_zp's shape is LBHS, internal layout LBHS
         auto newMemDesc = std::make_shared<CpuBlockedMemoryDesc>(
@@ -2744,8 +2758,11 @@ ov::element::Type ScaledDotProductAttention::getKVCachePrecision() {
                              (all_of(ov::element::f16, keyCachePrecisionHint, valueCachePrecisionHint));
     kvcache_precision = enableKVCacheFP16 ? ov::element::f16 : rtPrecision;
     bool use_int8_kv_cache_precision = (all_of(ov::element::u8, keyCachePrecisionHint, valueCachePrecisionHint));
+    bool use_int4_kv_cache_precision = (all_of(ov::element::u4, keyCachePrecisionHint, valueCachePrecisionHint));
     if (use_int8_kv_cache_precision) {
         kvcache_precision = ov::element::u8;
+    } else if (use_int4_kv_cache_precision) {
+        kvcache_precision = ov::element::u4;
     } else {
         kvcache_precision = enableKVCacheFP16 ? ov::element::f16 : rtPrecision;
     }
@@ -0,0 +1,274 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "paged_kv_cache.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "kv_block_manager.hpp"
+#include "openvino/core/except.hpp"
+#include "openvino/core/model.hpp"
+#include "openvino/core/node.hpp"
+#include "openvino/core/shape.hpp"
+#include "openvino/core/type.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "openvino/op/paged_attention.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/runtime/isync_infer_request.hpp"
+#include "openvino/runtime/make_tensor.hpp"
+#include "openvino/runtime/tensor.hpp"
+#include "utils/general_utils.h"
+
+namespace ov::intel_cpu {
+
+namespace {
+
+// the PagedAttention inputs, see PagedAttentionExecutor
+constexpr size_t ID_KCACHE = 3;
+constexpr size_t ID_VCACHE = 4;
+constexpr size_t ID_PAST_LENS = 5;
+constexpr size_t ID_SUBSEQUENCE_BEGINS = 6;
+constexpr size_t ID_BLOCK_INDICES = 7;
+constexpr size_t ID_BLOCK_INDICES_BEGINS = 8;
+constexpr size_t ID_MAX_CONTEXT_LEN = 12;
+
+constexpr auto no_sequence = std::numeric_limits<KVBlockManager::SequenceId>::max();
+
+int64_t find_input(const ov::Model& model, const std::string& name) {
+    const auto& parameters = model.get_parameters();
+    for (size_t i = 0; i < parameters.size(); i++) {
+        if (parameters[i]->get_output_tensor(0).get_names().count(name) != 0) {
+            return static_cast<int64_t>(i);
+        }
+    }
+    return -1;
+}
+
+size_t get_input(const ov::Model& model, const std::shared_ptr<ov::Node>& node, size_t port) {
+    const auto parameter = ov::as_type_ptr<ov::op::v0::Parameter>(node->get_input_node_shared_ptr(port));
+    OPENVINO_ASSERT(parameter,
+                    "PagedKVCache: the input ",
+                    port,
+                    " of ",
+                    node->get_friendly_name(),
+                    " must be a model input to be managed by the plugin");
+    return static_cast<size_t>(model.get_parameter_index(parameter));
+}
+
+// the prompt prefix is looked up by the token ids, and the cached tokens can be removed from the token inputs only if
+// the tokens are along their first dimension
+bool supports_prefix_caching(const ov::Model& model) {
+    if (find_input(model, "input_ids") < 0) {
+        return false;
+    }
+    const auto position_ids = find_input(model, "position_ids");
+    return position_ids < 0 || model.get_parameters()[position_ids]->get_partial_shape().size() == 1;
+}
+
+}  // namespace
+
+PagedKVCache::PagedKVCache(const ov::Model& model, size_t num_blocks, size_t block_size)
+    : m_manager(num_blocks, block_size, supports_prefix_caching(model)) {
+    bool first = true;
+    for (const auto& node : model.get_ops()) {
+        if (!ov::is_type<ov::op::PagedAttentionExtension>(node)) {
+            continue;
+        }
+        // the block tables are shared by the layers
+        if (first) {
+            m_past_lens = get_input(model, node, ID_PAST_LENS);
+            m_subsequence_begins = get_input(model, node, ID_SUBSEQUENCE_BEGINS);
+            m_block_indices = get_input(model, node, ID_BLOCK_INDICES);
+            m_block_indices_begins = get_input(model, node, ID_BLOCK_INDICES_BEGINS);
+            m_max_context_len = get_input(model, node, ID_MAX_CONTEXT_LEN);
+            first = false;
+        }
+        for (auto port : {ID_KCACHE, ID_VCACHE}) {
+            const auto input = get_input(model, node, port);
+            const auto& parameter = model.get_parameters()[input];
+            const auto& shape = parameter->get_partial_shape();
+            OPENVINO_ASSERT(shape.rank().is_static() && shape.size() == 4 && shape[1].is_static() &&
+                                shape[2].is_static() && shape[3].is_static(),
+                            "PagedKVCache: unexpected shape ",
+                            shape,
+                            " of the cache ",
+                            parameter->get_friendly_name());
+            const ov::Shape cache_shape{num_blocks,
+                                        static_cast<size_t>(shape[1].get_length()),
+                                        static_cast<size_t>(shape[2].get_length()),
+                                        static_cast<size_t>(shape[3].get_length())};
+            m_caches.emplace_back(input, ov::Tensor(parameter->get_element_type(), cache_shape));
+        }
+    }
+    OPENVINO_ASSERT(!first, "PagedKVCache: the model has no PagedAttention operations");
+
+    for (const auto* name : {"input_ids", "inputs_embeds", "position_ids"}) {
+        const auto input = find_input(model, name);
+        if (input >= 0) {
+            m_token_inputs.push_back(static_cast<size_t>(input));
+        }
+    }
+    if (supports_prefix_caching(model)) {
+        m_input_ids = find_input(model, "input_ids");
+    }
+}
+
+bool PagedKVCache::is_paged_model(const ov::Model& model) {
+    const auto& ops = model.get_ops();
+    return std::any_of(ops.begin(), ops.end(), [](const std::shared_ptr<ov::Node>& node) {
+        return ov::is_type<ov::op::PagedAttentionExtension>(node);
+    });
+}
+
+void PagedKVCache::prepare(ov::ISyncInferRequest& request, Sequences& sequences) {
+    const auto& inputs = request.get_inputs();
+    const auto past_lens = ov::make_tensor(request.get_tensor(inputs[m_past_lens]));
+    const auto subsequence_begins = ov::make_tensor(request.get_tensor(inputs[m_subsequence_begins]));
+    const size_t num_sequences = past_lens.get_size();
+    OPENVINO_ASSERT(subsequence_begins.get_size() == num_sequences + 1,
+                    "PagedKVCache: subsequence_begins must have one element more than past_lens");
+    const auto* past = past_lens.data<const int32_t>();
+    const std::vector<int32_t> begins(subsequence_begins.data<const int32_t>(),
+                                      subsequence_begins.data<const int32_t>() + num_sequences + 1);
+
+    ov::Tensor input_ids;
+    if (m_input_ids >= 0) {
+        input_ids = ov::make_tensor(request.get_tensor(inputs[m_input_ids]));
+        OPENVINO_ASSERT(any_of(input_ids.get_element_type(), ov::element::i64, ov::element::i32) &&
+                            input_ids.get_size() == static_cast<size_t>(begins.back()),
+                        "PagedKVCache: input_ids don't match subsequence_begins");
+    }
+
+    // the sequences of the batch positions which aren't used anymore are released
+    while (sequences.size() > num_sequences) {
+        if (sequences.back() != no_sequence) {
+            m_manager.free_sequence(sequences.back());
+        }
+        sequences.pop_back();
+    }
+    sequences.resize(num_sequences, no_sequence);
+
+    std::vector<size_t> cached(num_sequences, 0);
+    for (size_t i = 0; i < num_sequences; i++) {
+        OPENVINO_ASSERT(begins[i] >= 0 && begins[i] <= begins[i + 1],
+                        "PagedKVCache: subsequence_begins must be non decreasing");
+        std::vector<KVBlockManager::Token> tokens(static_cast<size_t>(begins[i + 1] - begins[i]), 0);
+        if (input_ids && input_ids.get_element_type() == ov::element::i64) {
+            const auto* ids = input_ids.data<const int64_t>() + begins[i];
+            std::copy(ids, ids + tokens.size(), tokens.begin());
+        } else if (input_ids) {
+            const auto* ids = input_ids.data<const int32_t>() + begins[i];
+            std::copy(ids, ids + tokens.size(), tokens.begin());
+        }
+
+        if (past[i] == 0) {
+            if (sequences[i] != no_sequence) {
+                m_manager.free_sequence(sequences[i]);
+                sequences[i] = no_sequence;
+            }
+            const auto id = m_next_sequence++;
+            cached[i] = m_manager.add_sequence(id, tokens);
+            sequences[i] = id;
+        } else {
+            OPENVINO_ASSERT(sequences[i] != no_sequence && m_manager.get_num_computed_tokens(sequences[i]) ==
+                                                               static_cast<size_t>(past[i]),
+                            "PagedKVCache: the past length ",
+                            past[i],
+                            " of the sequence ",
+                            i,
+                            " doesn't match the number of its computed tokens");
+            // the copies are applied right away, so a rollback after a later failure keeps valid blocks
+            const auto copies = m_manager.append_tokens(sequences[i], tokens);
+            for (auto& cache : m_caches) {
+                KVBlockManager::copy_blocks(cache.second, copies);
+            }
+        }
+    }
+
+    for (auto& cache : m_caches) {
+        if (request.get_tensor(inputs[cache.first])->data() != cache.second.data()) {
+            request.set_tensor(inputs[cache.first], ov::get_tensor_impl(cache.second));
+        }
+    }
+
+    if (std::any_of(cached.begin(), cached.end(), [](size_t count) {
+            return count > 0;
+        })) {
+        remove_cached_tokens(request, begins, cached);
+    }
+
+    const auto paged_inputs = m_manager.get_paged_inputs(sequences);
+    set_input(request, m_past_lens, paged_inputs.past_lens);
+    set_input(request, m_subsequence_begins, paged_inputs.subsequence_begins);
+    set_input(request, m_block_indices, paged_inputs.block_indices);
+    set_input(request, m_block_indices_begins, paged_inputs.block_indices_begins);
+
+    ov::Tensor max_context_len(ov::element::i32, ov::Shape{});
+    *max_context_len.data<int32_t>() = paged_inputs.max_context_len;
+    request.set_tensor(inputs[m_max_context_len], ov::get_tensor_impl(max_context_len));
+}
+
+void PagedKVCache::commit(const Sequences& sequences) {
+    m_manager.commit(sequences);
+}
+
+void PagedKVCache::rollback(const Sequences& sequences) {
+    Sequences prepared;
+    std::copy_if(sequences.begin(), sequences.end(), std::back_inserter(prepared), [](KVBlockManager::SequenceId id) {
+        return id != no_sequence;
+    });
+    m_manager.rollback(prepared);
+}
+
+void PagedKVCache::release(Sequences& sequences) {
+    for (auto id : sequences) {
+        if (id != no_sequence) {
+            m_manager.free_sequence(id);
+        }
+    }
+    sequences.clear();
+}
+
+void PagedKVCache::set_input(ov::ISyncInferRequest& request, size_t input, const std::vector<int32_t>& values) const {
+    ov::Tensor tensor(ov::element::i32, ov::Shape{values.size()});
+    std::copy(values.begin(), values.end(), tensor.data<int32_t>());
+    request.set_tensor(request.get_inputs()[input], ov::get_tensor_impl(tensor));
+}
+
+void PagedKVCache::remove_cached_tokens(ov::ISyncInferRequest& request,
+                                        const std::vector<int32_t>& begins,
+                                        const std::vector<size_t>& cached) const {
+    const auto& inputs = request.get_inputs();
+    const auto num_cached = std::accumulate(cached.begin(), cached.end(), size_t{0});
+    for (auto input : m_token_inputs) {
+        const auto tensor = ov::make_tensor(request.get_tensor(inputs[input]));
+        auto shape = tensor.get_shape();
+        OPENVINO_ASSERT(!shape.empty() && shape[0] == static_cast<size_t>(begins.back()),
+                        "PagedKVCache: the input ",
+                        inputs[input].get_any_name(),
+                        " doesn't match subsequence_begins");
+        const size_t token_bytes = tensor.get_byte_size() / shape[0];
+        shape[0] -= num_cached;
+        ov::Tensor trimmed(tensor.get_element_type(), shape);
+        const auto* src = static_cast<const uint8_t*>(tensor.data());
+        auto* dst = static_cast<uint8_t*>(trimmed.data());
+        for (size_t i = 0; i < cached.size(); i++) {
+            const size_t count = static_cast<size_t>(begins[i + 1] - begins[i]) - cached[i];
+            std::memcpy(dst, src + (begins[i] + cached[i]) * token_bytes, count * token_bytes);
+            dst += count * token_bytes;
+        }
+        request.set_tensor(inputs[input], ov::get_tensor_impl(trimmed));
+    }
+}
+
+}  // namespace ov::intel_cpu
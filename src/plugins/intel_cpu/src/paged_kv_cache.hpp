@@ -0,0 +1,92 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "kv_block_manager.hpp"
+#include "openvino/core/model.hpp"
+#include "openvino/runtime/isync_infer_request.hpp"
+#include "openvino/runtime/tensor.hpp"
+
+namespace ov::intel_cpu {
+
+/**
+ * @brief Key/value caches of a PagedAttention model allocated and managed by the plugin.
+ *
+ * Enabled by ov::intel_cpu::paged_kv_cache_blocks. The caches are allocated once per compiled model and shared by all
+ * its infer requests, their blocks are handed out by the KVBlockManager, so the sequences of all the requests share the
+ * cached prompt prefixes.
+ *
+ * The application sets the token inputs, past_lens and subsequence_begins as usual, the past length of zero starts a
+ * new sequence in that position of the batch and releases the previous one. The plugin provides block_indices,
+ * block_indices_begins, max_context_len and the caches. The tokens of a prompt prefix found in the cache are removed
+ * from the token inputs and past_lens / subsequence_begins are updated accordingly, so after the inference these
+ * tensors describe the tokens the outputs are computed for.
+ */
+class PagedKVCache {
+public:
+    using Ptr = std::shared_ptr<PagedKVCache>;
+    using Sequences = std::vector<KVBlockManager::SequenceId>;
+
+    PagedKVCache(const ov::Model& model, size_t num_blocks, size_t block_size);
+
+    static bool is_paged_model(const ov::Model& model);
+
+    /**
+     * @brief Registers the tokens set to the request inputs for the sequences of the request and sets the block
+     * tables and the caches to the request.
+     * @param sequences the sequence in each batch position of the request, updated for the new sequences
+     */
+    void prepare(ov::ISyncInferRequest& request, Sequences& sequences);
+
+    /**
+     * @brief Marks the tokens of the sequences as computed after a successful inference.
+     */
+    void commit(const Sequences& sequences);
+
+    /**
+     * @brief Drops the tokens registered by prepare after a failed or canceled inference.
+     *
+     * The sequences keep their computed tokens only, which are the ones described by the past_lens set to the request
+     * by prepare, so the inference can be repeated with the same inputs. A sequence started by the failed inference
+     * keeps its cached prompt prefix.
+     */
+    void rollback(const Sequences& sequences);
+
+    /**
+     * @brief Releases the sequences, their computed blocks stay available for the prefix reuse.
+     */
+    void release(Sequences& sequences);
+
+    [[nodiscard]] KVBlockManager::Statistics get_statistics() const {
+        return m_manager.get_statistics();
+    }
+
+private:
+    void set_input(ov::ISyncInferRequest& request, size_t input, const std::vector<int32_t>& values) const;
+    void remove_cached_tokens(ov::ISyncInferRequest& request,
+                              const std::vector<int32_t>& begins,
+                              const std::vector<size_t>& cached) const;
+
+    KVBlockManager m_manager;
+    std::atomic<KVBlockManager::SequenceId> m_next_sequence{0};
+
+    // indices of the model inputs
+    size_t m_past_lens = 0;
+    size_t m_subsequence_begins = 0;
+    size_t m_block_indices = 0;
+    size_t m_block_indices_begins = 0;
+    size_t m_max_context_len = 0;
+    std::vector<size_t> m_token_inputs;  // inputs with the tokens along the first dimension
+    int64_t m_input_ids = -1;            // the token ids hashed for the prefix reuse, if the model takes them
+    std::vector<std::pair<size_t, ov::Tensor>> m_caches;
+};
+
+}  // namespace ov::intel_cpu
@@ -271,6 +271,8 @@ void Plugin::get_performance_streams(Config& config, const std::shared_ptr<ov::M
     } else {
         config.streamExecutorConfig = IStreamsExecutor::Config{"CPUStreamsExecutor", streams};
     }
+    // the executor config is recreated above, so the scheduling mode set by the user is applied again
+    config.streamExecutorConfig.set_property(ov::internal::task_scheduling.name(), config.taskScheduling);
 }
 
 void Plugin::calculate_streams(Config& conf, const std::shared_ptr<ov::Model>& model, bool imported) {
@@ -505,6 +507,12 @@ ov::Any Plugin::get_property(const std::string& name, const ov::AnyMap& options)
     if (name == ov::internal::exclusive_async_requests.name()) {
         return engConfig.exclusiveAsyncRequests;
     }
+    if (name == ov::internal::task_scheduling.name()) {
+        return engConfig.taskScheduling;
+    }
+    if (name == ov::internal::numa_node_id.name()) {
+        return decltype(ov::internal::numa_node_id)::value_type(engConfig.numaNodeId);
+    }
 
     if (name == ov::hint::dynamic_quantization_group_size) {
         return static_cast<decltype(ov::hint::dynamic_quantization_group_size)::value_type>(
@@ -611,6 +619,8 @@ ov::Any Plugin::get_ro_property(const std::string& name, [[maybe_unused]] const
             ov::PropertyName{ov::internal::caching_with_mmap.name(), ov::PropertyMutability::RO},
 #endif
             ov::PropertyName{ov::internal::exclusive_async_requests.name(), ov::PropertyMutability::RW},
+            ov::PropertyName{ov::internal::task_scheduling.name(), ov::PropertyMutability::RW},
+            ov::PropertyName{ov::internal::numa_node_id.name(), ov::PropertyMutability::RW},
             ov::PropertyName{ov::internal::compiled_model_runtime_properties.name(), ov::PropertyMutability::RO},
             ov::PropertyName{ov::internal::compiled_model_runtime_properties_supported.name(),
                              ov::PropertyMutability::RO}};
@@ -803,7 +813,12 @@ std::shared_ptr<ov::ICompiledModel> Plugin::deserialize_model(ModelDeserializer&
 
     // import config props from caching model
     calculate_streams(conf, model, true);
-    auto compiled_model = std::make_shared<CompiledModel>(model, shared_from_this(), conf, loaded_from_cache);
+    auto compiled_model = std::make_shared<CompiledModel>(model,
+                                                          shared_from_this(),
+                                                          conf,
+                                                          loaded_from_cache,
+                                                          nullptr,
+                                                          deserializer.packed_weights());
     return compiled_model;
 }
 }  // namespace ov::intel_cpu
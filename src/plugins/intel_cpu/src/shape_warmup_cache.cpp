@@ -0,0 +1,174 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shape_warmup_cache.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include "openvino/core/model.hpp"
+#include "openvino/core/partial_shape.hpp"
+#include "openvino/core/shape.hpp"
+#include "utils/debug_capabilities.h"
+
+namespace ov::intel_cpu {
+
+namespace {
+constexpr const char* header = "OV_CPU_SHAPE_WARMUP_CACHE 1";
+
+std::string to_line(const ShapeWarmupCache::Record& shapes) {
+    std::ostringstream os;
+    for (size_t i = 0; i < shapes.size(); i++) {
+        if (i > 0) {
+            os << ';';
+        }
+        for (size_t j = 0; j < shapes[i].size(); j++) {
+            if (j > 0) {
+                os << ',';
+            }
+            os << shapes[i][j];
+        }
+    }
+    return os.str();
+}
+
+bool from_line(const std::string& line, ShapeWarmupCache::Record& shapes) {
+    shapes.clear();
+    if (line.empty()) {
+        // single scalar input
+        shapes.emplace_back();
+        return true;
+    }
+    std::istringstream shapes_stream(line);
+    std::string shape_str;
+    while (std::getline(shapes_stream, shape_str, ';')) {
+        ov::Shape shape;
+        std::istringstream dims_stream(shape_str);
+        std::string dim_str;
+        while (std::getline(dims_stream, dim_str, ',')) {
+            try {
+                shape.push_back(std::stoull(dim_str));
+            } catch (...) {
+                return false;
+            }
+        }
+        shapes.push_back(std::move(shape));
+    }
+    // a trailing scalar input leaves no token after the last separator
+    if (line.back() == ';') {
+        shapes.emplace_back();
+    }
+    return true;
+}
+}  // namespace
+
+ShapeWarmupCache::ShapeWarmupCache(const std::filesystem::path& cache_dir,
+                                   const std::string& model_id,
+                                   const ov::Model& model,
+                                   size_t max_records)
+    : m_path(cache_dir / (model_id + ".cpu_shapes")),
+      m_max_records(max_records) {
+    for (const auto& param : model.get_parameters()) {
+        m_input_shapes.push_back(param->get_output_partial_shape(0));
+    }
+    load();
+}
+
+bool ShapeWarmupCache::is_compatible(const Record& shapes) const {
+    if (shapes.size() != m_input_shapes.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < shapes.size(); i++) {
+        if (!m_input_shapes[i].compatible(ov::PartialShape(shapes[i]))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void ShapeWarmupCache::load() {
+    std::ifstream file(m_path);
+    if (!file.is_open()) {
+        return;
+    }
+    std::string line;
+    if (!std::getline(file, line) || line != header) {
+        DEBUG_LOG("Ignore shape warmup cache with unexpected header: ", m_path);
+        return;
+    }
+    Record shapes;
+    while (m_records.size() < m_max_records && std::getline(file, line)) {
+        if (from_line(line, shapes) && is_compatible(shapes)) {
+            m_records.insert(shapes);
+        }
+    }
+}
+
+bool ShapeWarmupCache::record(const Record& shapes) {
+    std::lock_guard<std::mutex> lock(m_guard);
+    if (m_records.size() >= m_max_records) {
+        return false;
+    }
+    const bool inserted = m_records.insert(shapes).second;
+    m_dirty |= inserted;
+    return inserted;
+}
+
+std::vector<ShapeWarmupCache::Record> ShapeWarmupCache::records() const {
+    std::lock_guard<std::mutex> lock(m_guard);
+    return {m_records.begin(), m_records.end()};
+}
+
+void ShapeWarmupCache::flush() {
+    std::vector<std::string> lines;
+    {
+        std::lock_guard<std::mutex> lock(m_guard);
+        if (!m_dirty) {
+            return;
+        }
+        m_dirty = false;
+        lines.reserve(m_records.size());
+        for (const auto& shapes : m_records) {
+            lines.push_back(to_line(shapes));
+        }
+    }
+
+    // the cache is only a hint, so IO errors are not reported to the caller
+    std::error_code ec;
+    auto tmp_path = m_path;
+    const auto unique_id = std::hash<std::thread::id>{}(std::this_thread::get_id()) ^
+                           static_cast<size_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+    tmp_path += "." + std::to_string(unique_id) + ".tmp";
+    {
+        std::ofstream file(tmp_path, std::ios::trunc);
+        if (!file.is_open()) {
+            DEBUG_LOG("Cannot write shape warmup cache: ", tmp_path);
+            return;
+        }
+        file << header << '\n';
+        for (const auto& line : lines) {
+            file << line << '\n';
+        }
+        if (!file.good()) {
+            file.close();
+            std::filesystem::remove(tmp_path, ec);
+            return;
+        }
+    }
+    std::filesystem::rename(tmp_path, m_path, ec);
+    if (ec) {
+        std::filesystem::remove(tmp_path, ec);
+    }
+}
+
+}  // namespace ov::intel_cpu
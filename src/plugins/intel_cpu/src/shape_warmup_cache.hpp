@@ -0,0 +1,76 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "openvino/core/model.hpp"
+#include "openvino/core/shape.hpp"
+
+namespace ov::intel_cpu {
+
+/**
+ * @brief Persistent record of the input shapes a dynamic model was executed with.
+ *
+ * The CPU runtime cache (MultiCache) keeps the primitives and executors built for each shape in memory only, so a
+ * restarted process has to build them again on the first requests. The cache stores the distinct input shape
+ * combinations seen by the compiled model in a small file next to the compiled blobs in ov::cache_dir, so they can be
+ * replayed when the model is imported from the cache to prepare the runtime cache.
+ *
+ * The file is keyed by the model id, the hash of the runtime model topology computed at the compilation and kept in the
+ * compiled blob, and written atomically (temporary file + rename), so concurrent processes never read a partial record
+ * list.
+ *
+ * The cache is thread safe.
+ */
+class ShapeWarmupCache {
+public:
+    using Ptr = std::shared_ptr<ShapeWarmupCache>;
+    using Record = std::vector<ov::Shape>;
+
+    ShapeWarmupCache(const std::filesystem::path& cache_dir,
+                     const std::string& model_id,
+                     const ov::Model& model,
+                     size_t max_records);
+
+    /**
+     * @brief Adds the input shapes combination to the cache
+     * @return true if the combination was not recorded before
+     */
+    bool record(const Record& shapes);
+
+    /**
+     * @brief Returns recorded combinations compatible with the model inputs
+     */
+    [[nodiscard]] std::vector<Record> records() const;
+
+    /**
+     * @brief Writes the records to the file if there are new ones
+     */
+    void flush();
+
+    [[nodiscard]] const std::filesystem::path& path() const {
+        return m_path;
+    }
+
+private:
+    void load();
+    [[nodiscard]] bool is_compatible(const Record& shapes) const;
+
+    std::filesystem::path m_path;
+    std::vector<ov::PartialShape> m_input_shapes;
+    size_t m_max_records;
+    std::set<Record> m_records;
+    bool m_dirty = false;
+    mutable std::mutex m_guard;
+};
+
+}  // namespace ov::intel_cpu
@@ -588,8 +588,8 @@ void Transformations::PreLpt(const std::vector<ov::element::Type>& defaultPrecis
     cacheConfig.inferencePrecision = config.inferencePrecision;
     cacheConfig.keyCacheGroupSize = config.keyCacheGroupSize;
     cacheConfig.valueCacheGroupSize = config.valueCacheGroupSize;
-    cacheConfig.keyCacheBlockSize = 32;
-    cacheConfig.valueCacheBlockSize = 32;
+    cacheConfig.keyCacheBlockSize = node::PagedAttention::cacheBlockSize;
+    cacheConfig.valueCacheBlockSize = node::PagedAttention::cacheBlockSize;
 
     cacheConfig.keyCacheQuantBychannel =
         node::PagedAttention::isQuantByChannel(config.keyCacheQuantMode, config.keyCachePrecision, true);
@@ -901,7 +901,8 @@ void Transformations::PreLpt(const std::vector<ov::element::Type>& defaultPrecis
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::EnableDecompressionConvertConstantFolding);
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::KeepConstAndDecompression);
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::ConstantFolding);
-    CPU_REGISTER_PASS_COMMON(manager, ov::pass::LoraSubgraphFusion);
+    // the LoRA node runs the multi-adapter batches with the segmented kernel
+    CPU_REGISTER_PASS_COMMON(manager, ov::pass::LoraSubgraphFusion, true);
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::Validate);
 
     manager.run_passes(model);
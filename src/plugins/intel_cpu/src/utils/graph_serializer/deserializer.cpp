@@ -40,6 +40,7 @@
 #include "openvino/util/xml_parse_utils.hpp"
 #include "openvino/xml_util/xml_deserialize_util.hpp"
 #include "utils/codec_xor.hpp"
+#include "utils/graph_serializer/packed_weights.hpp"
 
 namespace ov::intel_cpu {
 
@@ -164,11 +165,20 @@ void ModelDeserializer::process_model(std::shared_ptr<ov::Model>& model,
     // Read model input/output precisions.
     pugi::xml_document xml_in_out_doc;
     if (hdr.custom_data_size > 0LU) {
+        // the xml may be followed by the packed weights
+        const auto xml_size = strnlen(buffer_base + hdr.custom_data_offset, hdr.custom_data_size);
         auto res = xml_in_out_doc.load_buffer(buffer_base + hdr.custom_data_offset,
-                                              hdr.custom_data_size,
+                                              xml_size,
                                               pugi::parse_default,
                                               pugi::encoding_utf8);
         OPENVINO_ASSERT(res.status == pugi::status_ok, "[CPU] Could to deserialize custom data.");
+
+        const auto root = xml_in_out_doc.child("cnndata");
+        const auto packed_size = PackedWeights::area_size(root);
+        OPENVINO_ASSERT(packed_size <= hdr.custom_data_size - xml_size, "[CPU] Unexpected size of the packed weights");
+        const auto* packed_data =
+            reinterpret_cast<const uint8_t*>(buffer_base + hdr.custom_data_offset + hdr.custom_data_size - packed_size);
+        m_packed_weights = PackedWeights::read(root, packed_data, packed_size, model_buffer);
     }
 
     // Map blob content
@@ -228,12 +238,20 @@ void ModelDeserializer::process_model(std::shared_ptr<ov::Model>& model,
 
     pugi::xml_document xmlInOutDoc;
     if (hdr.custom_data_size > 0) {
-        std::string xmlInOutString;
-        xmlInOutString.resize(hdr.custom_data_size);
-        model_stream.read(const_cast<char*>(xmlInOutString.c_str()), hdr.custom_data_size);
-        auto res = xmlInOutDoc.load_string(xmlInOutString.c_str());
+        auto xmlInOutString = std::make_shared<std::string>();
+        xmlInOutString->resize(hdr.custom_data_size);
+        model_stream.read(const_cast<char*>(xmlInOutString->c_str()), hdr.custom_data_size);
+        // stops at the terminator of the xml followed by the packed weights
+        auto res = xmlInOutDoc.load_string(xmlInOutString->c_str());
         OPENVINO_ASSERT(res.status == pugi::status_ok,
                         "NetworkNotRead: The inputs and outputs information is invalid.");
+
+        const auto root = xmlInOutDoc.child("cnndata");
+        const auto packed_size = PackedWeights::area_size(root);
+        OPENVINO_ASSERT(packed_size < hdr.custom_data_size, "[CPU] Unexpected size of the packed weights");
+        const auto* packed_data =
+            reinterpret_cast<const uint8_t*>(xmlInOutString->data() + hdr.custom_data_size - packed_size);
+        m_packed_weights = PackedWeights::read(root, packed_data, packed_size, xmlInOutString);
     }
 
     // read blob content
@@ -14,6 +14,7 @@
 #include "openvino/runtime/aligned_buffer.hpp"
 #include "openvino/util/xml_parse_utils.hpp"
 #include "utils/codec_xor.hpp"
+#include "utils/graph_serializer/packed_weights.hpp"
 
 namespace ov {
 class ICore;
@@ -89,6 +90,13 @@ public:
 
     void operator>>(std::shared_ptr<ov::Model>& model);
 
+    /**
+     * @brief Returns the repacked weights stored in the blob, available after the model is read
+     */
+    [[nodiscard]] const PackedWeights::Ptr& packed_weights() const {
+        return m_packed_weights;
+    }
+
 protected:
     static void set_info(pugi::xml_node& root, std::shared_ptr<ov::Model>& model);
 
@@ -105,6 +113,7 @@ protected:
     CacheDecrypt m_cache_decrypt;
     bool m_decript_from_string;
     std::shared_ptr<ov::AlignedBuffer> m_origin_weights_buf;
+    PackedWeights::Ptr m_packed_weights;
 };
 
 }  //  namespace ov::intel_cpu
@@ -0,0 +1,235 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "packed_weights.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <oneapi/dnnl/dnnl.hpp>
+#include <ostream>
+#include <pugixml.hpp>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "cpu_memory.h"
+#include "dnnl_extension_utils.h"
+#include "graph.h"
+#include "graph_context.h"
+#include "memory_desc/dnnl_memory_desc.h"
+#include "openvino/core/except.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "openvino/util/xml_parse_utils.hpp"
+#include "utils/debug_capabilities.h"
+#include "weights_cache.hpp"
+
+namespace ov::intel_cpu {
+
+namespace {
+constexpr const char* section_name = "packed_weights";
+
+size_t align_up(size_t value) {
+    return (value + PackedWeights::alignment - 1) / PackedWeights::alignment * PackedWeights::alignment;
+}
+
+std::string to_hex(const std::vector<uint8_t>& bytes) {
+    static constexpr const char* digits = "0123456789abcdef";
+    std::string result;
+    result.reserve(bytes.size() * 2);
+    for (const auto byte : bytes) {
+        result.push_back(digits[byte >> 4]);
+        result.push_back(digits[byte & 0xF]);
+    }
+    return result;
+}
+
+std::vector<uint8_t> from_hex(const std::string& str) {
+    auto digit = [](char c) -> uint8_t {
+        if (c >= '0' && c <= '9') {
+            return c - '0';
+        }
+        OPENVINO_ASSERT(c >= 'a' && c <= 'f', "[CPU] Unexpected packed weights descriptor");
+        return c - 'a' + 10;
+    };
+    OPENVINO_ASSERT(str.size() % 2 == 0, "[CPU] Unexpected packed weights descriptor");
+    std::vector<uint8_t> bytes(str.size() / 2);
+    for (size_t i = 0; i < bytes.size(); i++) {
+        bytes[i] = (digit(str[2 * i]) << 4) | digit(str[2 * i + 1]);
+    }
+    return bytes;
+}
+
+// node names are not guaranteed to be unique, such nodes are skipped to never mix up their weights
+std::unordered_map<std::string, NodePtr> unique_nodes(const Graph& graph) {
+    std::unordered_map<std::string, NodePtr> nodes;
+    std::unordered_map<std::string, size_t> counts;
+    for (const auto& node : graph.GetNodes()) {
+        nodes[node->getName()] = node;
+        counts[node->getName()]++;
+    }
+    for (const auto& [name, count] : counts) {
+        if (count > 1) {
+            nodes.erase(name);
+        }
+    }
+    return nodes;
+}
+}  // namespace
+
+std::string PackedWeights::make_signature(const ov::element::Type& inference_precision) {
+    return "isa:" + std::to_string(static_cast<int>(dnnl::get_effective_cpu_isa())) +
+           ";precision:" + inference_precision.get_type_name();
+}
+
+PackedWeights::Ptr PackedWeights::collect(const Graph& graph, std::string signature) {
+    auto packed = std::make_shared<PackedWeights>();
+    packed->m_signature = std::move(signature);
+
+    const auto nodes = unique_nodes(graph);
+    std::unordered_map<const IMemory*, size_t> offsets;
+    // keep the order of the graph nodes and the formats, so the same model gives the same blob
+    for (const auto& node : graph.GetNodes()) {
+        const auto& name = node->getName();
+        const auto& cache = node->getPrivateWeightCache();
+        if (!cache || !nodes.count(name)) {
+            continue;
+        }
+        const std::map<std::string, MemoryPtr> formats(cache->begin(), cache->end());
+        for (const auto& [format, memory] : formats) {
+            if (!memory || !memory->getDesc().isDefined() || memory->getSize() == 0) {
+                continue;
+            }
+            std::vector<uint8_t> desc_blob;
+            try {
+                desc_blob = memory->getDescWithType<DnnlMemoryDesc>()->getDnnlDesc().get_blob();
+            } catch (const std::exception&) {
+                DEBUG_LOG("Skip packed weights of ", name, " with not serializable descriptor ", format);
+                continue;
+            }
+
+            auto [it, inserted] = offsets.emplace(memory.get(), packed->m_size);
+            if (inserted) {
+                packed->m_size = align_up(packed->m_size + memory->getSize());
+            }
+            packed->m_entries.push_back({name, format, std::move(desc_blob), it->second, memory->getSize(), memory});
+        }
+    }
+    return packed;
+}
+
+PackedWeights::Ptr PackedWeights::read(const pugi::xml_node& root,
+                                       const uint8_t* data,
+                                       size_t size,
+                                       std::shared_ptr<void> holder) {
+    auto section = root.child(section_name);
+    if (!section) {
+        return nullptr;
+    }
+    OPENVINO_ASSERT(area_size(root) == size, "[CPU] Unexpected size of the packed weights");
+
+    auto packed = std::make_shared<PackedWeights>();
+    packed->m_signature = section.attribute("signature").value();
+    packed->m_size = size;
+    packed->m_data = data;
+    packed->m_holder = std::move(holder);
+    for (const auto& entry : section.children("entry")) {
+        Entry item{ov::util::pugixml::get_str_attr(entry, "node"),
+                   ov::util::pugixml::get_str_attr(entry, "format"),
+                   from_hex(ov::util::pugixml::get_str_attr(entry, "desc")),
+                   static_cast<size_t>(ov::util::pugixml::get_uint64_attr(entry, "offset")),
+                   static_cast<size_t>(ov::util::pugixml::get_uint64_attr(entry, "size")),
+                   nullptr};
+        OPENVINO_ASSERT(item.offset <= size && item.size <= size - item.offset,
+                        "[CPU] Packed weights of ",
+                        item.node,
+                        " are out of the blob bounds");
+        packed->m_entries.push_back(std::move(item));
+    }
+    return packed;
+}
+
+size_t PackedWeights::area_size(const pugi::xml_node& root) {
+    auto section = root.child(section_name);
+    return section ? static_cast<size_t>(ov::util::pugixml::get_uint64_attr(section, "size", 0)) : 0;
+}
+
+void PackedWeights::describe(pugi::xml_node& root) const {
+    auto section = root.append_child(section_name);
+    section.append_attribute("size").set_value(static_cast<unsigned long long>(m_size));
+    section.append_attribute("signature").set_value(m_signature.c_str());
+    for (const auto& item : m_entries) {
+        auto entry = section.append_child("entry");
+        entry.append_attribute("node").set_value(item.node.c_str());
+        entry.append_attribute("format").set_value(item.format.c_str());
+        entry.append_attribute("desc").set_value(to_hex(item.desc).c_str());
+        entry.append_attribute("offset").set_value(static_cast<unsigned long long>(item.offset));
+        entry.append_attribute("size").set_value(static_cast<unsigned long long>(item.size));
+    }
+}
+
+void PackedWeights::write(std::ostream& stream) const {
+    size_t pos = 0;
+    for (const auto& item : m_entries) {
+        // entries sharing the memory are written once
+        if (item.offset < pos) {
+            continue;
+        }
+        OPENVINO_ASSERT(item.memory, "[CPU] Packed weights of ", item.node, " have no data");
+        std::fill_n(std::ostreambuf_iterator<char>(stream), item.offset - pos, '\0');
+        stream.write(static_cast<const char*>(item.memory->getData()), item.size);
+        pos = item.offset + item.size;
+    }
+    std::fill_n(std::ostreambuf_iterator<char>(stream), m_size - pos, '\0');
+}
+
+size_t PackedWeights::apply(const Graph& graph, const std::string& signature) const {
+    if (signature != m_signature) {
+        DEBUG_LOG("Skip packed weights prepared for ", m_signature, " while running on ", signature);
+        return 0;
+    }
+
+    const auto nodes = unique_nodes(graph);
+    const auto engine = graph.getEngine();
+    const auto& weights_cache = graph.getGraphContext()->getWeightsCache();
+    // the pages of the blob are shared by the processes, so they are used in place only when no NUMA placement is
+    // requested for the weights
+    const bool in_place = WeightsSharing::followsStreamNode(weights_cache);
+    size_t applied = 0;
+    for (const auto& item : m_entries) {
+        auto node = nodes.find(item.node);
+        if (node == nodes.end()) {
+            continue;
+        }
+        const auto& cache = node->second->getPrivateWeightCache();
+        if (!cache || cache->count(item.format)) {
+            continue;
+        }
+
+        auto desc = DnnlExtensionUtils::makeDescriptor(dnnl::memory::desc(item.desc));
+        const auto* data = m_data + item.offset;
+        MemoryPtr memory;
+        if (in_place && reinterpret_cast<uintptr_t>(data) % alignment == 0) {
+            // the weights are never written, so the view over the blob is safe even for a read-only mapping
+            memory = std::make_shared<Memory>(engine, desc, data, false);
+        } else {
+            memory = std::make_shared<Memory>(engine, desc);
+            if (weights_cache) {
+                weights_cache->place(*memory);
+            }
+            std::memcpy(memory->getData(), data, item.size);
+        }
+        (*cache)[item.format] = memory;
+        applied++;
+    }
+    return applied;
+}
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,103 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <pugixml.hpp>
+#include <string>
+#include <vector>
+
+#include "cpu_memory.h"
+#include "openvino/core/type/element_type.hpp"
+
+namespace ov::intel_cpu {
+
+class Graph;
+
+/**
+ * @brief Weights repacked by the graph nodes into the layout of the selected primitives, stored in the compiled blob.
+ *
+ * The nodes keep the weights reordered for their primitives in the private weights cache. The export stores these
+ * copies in the custom data section of the blob, after the xml terminated by '\0':
+ *
+ *   [cnndata xml]['\0'][padding][entry 0 data][padding][entry 1 data]...
+ *
+ * The entries are 64 bytes aligned in the file, so when the blob is imported via mmap the private caches of the
+ * nodes are seeded with memory pointing straight into the mapped blob. Neither the reorder nor a private copy of the
+ * weights is needed then and the pages are shared by all the processes importing the same blob. With a REPLICATE or
+ * INTERLEAVE weights NUMA policy the entries are copied into memory placed by the weights cache of the graph instead.
+ *
+ * The entries are applied only to the nodes with unique names, and a seeded entry is used by a node only if its
+ * descriptor is compatible with the one selected at runtime, otherwise the weights are repacked as usual.
+ */
+class PackedWeights {
+public:
+    using Ptr = std::shared_ptr<PackedWeights>;
+
+    static constexpr size_t alignment = 64;
+
+    /**
+     * @brief Collects the repacked weights of the graph nodes
+     * @param signature describes the platform and the options the weights were packed for
+     */
+    static Ptr collect(const Graph& graph, std::string signature);
+
+    /**
+     * @brief Reads the entries described in the cnndata xml node
+     * @param data points to the packed weights area at the end of the custom data section
+     * @param holder keeps the data alive while the entries are in use
+     * @return nullptr if the blob does not contain packed weights
+     */
+    static Ptr read(const pugi::xml_node& root, const uint8_t* data, size_t size, std::shared_ptr<void> holder);
+
+    /**
+     * @brief Returns the size of the packed weights area stored in the cnndata xml node
+     */
+    static size_t area_size(const pugi::xml_node& root);
+
+    static std::string make_signature(const ov::element::Type& inference_precision);
+
+    void describe(pugi::xml_node& root) const;
+
+    /**
+     * @brief Writes the packed weights area, the stream position must be aligned
+     */
+    void write(std::ostream& stream) const;
+
+    /**
+     * @brief Seeds the private weights caches of the graph nodes
+     * @return number of the seeded entries
+     */
+    size_t apply(const Graph& graph, const std::string& signature) const;
+
+    [[nodiscard]] size_t size() const {
+        return m_size;
+    }
+
+    [[nodiscard]] bool empty() const {
+        return m_entries.empty();
+    }
+
+private:
+    struct Entry {
+        std::string node;
+        std::string format;
+        std::vector<uint8_t> desc;
+        size_t offset;
+        size_t size;
+        MemoryCPtr memory;  // source of the data on export
+    };
+
+    std::vector<Entry> m_entries;
+    std::string m_signature;
+    size_t m_size = 0;
+    const uint8_t* m_data = nullptr;
+    std::shared_ptr<void> m_holder;
+};
+
+}  // namespace ov::intel_cpu
@@ -4,13 +4,16 @@
 
 #include "serializer.hpp"
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
 #include <functional>
+#include <iterator>
 #include <memory>
 #include <ostream>
 #include <string>
+#include <utility>
 
 #include "openvino/core/model.hpp"
 #include "openvino/core/node.hpp"
@@ -21,6 +24,7 @@
 #include "openvino/pass/serialize.hpp"
 #include "openvino/xml_util/constant_writer.hpp"
 #include "openvino/xml_util/xml_serialize_util.hpp"
+#include "utils/graph_serializer/packed_weights.hpp"
 
 namespace ov::intel_cpu {
 
@@ -140,14 +144,30 @@ private:
 
 ////////// ModelSerializer //////////
 
-ModelSerializer::ModelSerializer(std::ostream& ostream, const CacheEncrypt& encrypt_fn, bool weightless_mode)
+ModelSerializer::ModelSerializer(std::ostream& ostream,
+                                 const CacheEncrypt& encrypt_fn,
+                                 bool weightless_mode,
+                                 PackedWeights::Ptr packed_weights)
     : ov::pass::StreamSerialize(
           ostream,
-          [](std::ostream& stream) {
+          [packed_weights = std::move(packed_weights)](std::ostream& stream) {
               pugi::xml_document xml_doc;
               pugi::xml_node root = xml_doc.append_child("cnndata");
               root.append_child("outputs");
+              const bool has_packed_weights = packed_weights && !packed_weights->empty();
+              if (has_packed_weights) {
+                  packed_weights->describe(root);
+              }
               xml_doc.save(stream);
+              if (has_packed_weights) {
+                  // the xml is terminated explicitly, the packed weights area ends the custom data section
+                  stream.put('\0');
+                  const auto pos = static_cast<size_t>(stream.tellp());
+                  const auto padding = (PackedWeights::alignment - pos % PackedWeights::alignment) %
+                                       PackedWeights::alignment;
+                  std::fill_n(std::ostreambuf_iterator<char>(stream), padding, '\0');
+                  packed_weights->write(stream);
+              }
           },
           encrypt_fn),
       m_weightless_mode(weightless_mode) {};
@@ -10,6 +10,7 @@
 
 #include "openvino/core/model.hpp"
 #include "openvino/pass/serialize.hpp"
+#include "utils/graph_serializer/packed_weights.hpp"
 
 namespace ov::intel_cpu {
 
@@ -17,7 +18,10 @@ class ModelSerializer : private ov::pass::StreamSerialize {
 public:
     using CacheEncrypt = std::function<std::string(const std::string&)>;
 
-    explicit ModelSerializer(std::ostream& ostream, const CacheEncrypt& encrypt_fn = {}, bool weightless_mode = false);
+    explicit ModelSerializer(std::ostream& ostream,
+                             const CacheEncrypt& encrypt_fn = {},
+                             bool weightless_mode = false,
+                             PackedWeights::Ptr packed_weights = nullptr);
 
     void operator<<(const std::shared_ptr<ov::Model>& model);
 
@@ -8,6 +8,7 @@
 #include <ostream>
 #include <string>
 
+#include "cache/cache_statistics.h"
 #include "compiled_model.h"
 #include "openvino/core/except.hpp"
 #include "utils/debug_caps_config.h"
@@ -47,6 +48,13 @@ static void dumpStatistics(std::ostream& os,
         for (size_t i = 0; i < scratchpads.size(); ++i) {
             os << "Scratchpad " << i << " size: " << scratchpads[i]->size() << " bytes\n\n";
         }
+
+        const auto cache_statistics = ctx->getParamsCache()->getStatistics();
+        os << "Runtime cache capacity: " << ctx->getConfig().rtCacheCapacity << " records\n";
+        os << "Runtime cache records: " << cache_statistics.size << "\n";
+        os << "Runtime cache hits: " << cache_statistics.hits << "\n";
+        os << "Runtime cache misses: " << cache_statistics.misses << "\n";
+        os << "Runtime cache evictions: " << cache_statistics.evictions << "\n\n";
     }
     os << "Weights cache statistics\n";
     auto weights_statistics = weights_cache.dumpStatistics();
@@ -54,6 +62,9 @@ static void dumpStatistics(std::ostream& os,
         os << "Socket ID: " << item.first << "\n";
         os << "Total size: " << item.second.total_size << " bytes\n";
         os << "Total memory objects: " << item.second.total_memory_objects << "\n";
+        for (auto&& [node, size] : item.second.resident_size) {
+            os << "Resident on NUMA node " << node << ": " << size << " bytes\n";
+        }
     }
 }
 
@@ -86,6 +97,13 @@ static void dumpStatisticsCSV(std::ofstream& os,
         for (size_t i = 0; i < scratchpads.size(); ++i) {
             os << i << ";" << scratchpads[i]->size() << ";;;;;\n";
         }
+
+        const auto cache_statistics = ctx->getParamsCache()->getStatistics();
+        os << ";;;;;;\n";
+        os << "Runtime cache stats;;;;;;\n";
+        os << "Capacity [-];Records [-];Hits [-];Misses [-];Evictions [-];;\n";
+        os << ctx->getConfig().rtCacheCapacity << ";" << cache_statistics.size << ";" << cache_statistics.hits << ";"
+           << cache_statistics.misses << ";" << cache_statistics.evictions << ";;\n";
     }
     auto weights_statistics = weights_cache.dumpStatistics();
     if (!weights_statistics.empty()) {
@@ -97,6 +115,19 @@ static void dumpStatisticsCSV(std::ofstream& os,
     for (auto&& item : weights_statistics) {
         os << item.first << ";" << item.second.total_size << ";" << item.second.total_memory_objects << ";;;;;\n";
     }
+
+    bool has_resident_size = false;
+    for (auto&& item : weights_statistics) {
+        if (!item.second.resident_size.empty() && !has_resident_size) {
+            os << ";;;;;;\n";
+            os << "Weights NUMA residency;;;;;;\n";
+            os << "Cache ID;NUMA node;Resident size [bytes];;;;\n";
+            has_resident_size = true;
+        }
+        for (auto&& [node, size] : item.second.resident_size) {
+            os << item.first << ";" << node << ";" << size << ";;;;\n";
+        }
+    }
 }
 
 void dumpMemoryStats(const DebugCapsConfig& conf,
@@ -4,8 +4,10 @@
 
 #include "weights_cache.hpp"
 
+#include <algorithm>
 #include <atomic>
 #include <functional>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -13,8 +15,10 @@
 #include <vector>
 
 #include "cpu_memory.h"
+#include "internal_properties.hpp"
 #include "openvino/core/except.hpp"
 #include "openvino/runtime/system_conf.hpp"
+#include "utils/debug_capabilities.h"
 
 namespace ov::intel_cpu {
 
@@ -91,10 +95,61 @@ WeightsSharing::SharedMemory::Ptr WeightsSharing::get(const std::string& key) co
                                           newPtr);
 }
 
-SocketsWeights::SocketsWeights() {
-    int num_sockets = get_num_sockets();
-    for (int socket_id = 0; socket_id < num_sockets; socket_id++) {
-        _cache_map[socket_id] = std::make_shared<WeightsSharing>();
+void WeightsSharing::place(const IMemory& memory) const {
+    if (memory.getDesc().empty()) {
+        return;
+    }
+    switch (policy) {
+    case WeightsNumaPolicy::REPLICATE:
+        // mbind before the first touch only sets the policy, so no pages are moved
+        if (numaNodeId >= 0 && !mbind_move(memory.getData(), memory.getSize(), numaNodeId)) {
+            DEBUG_LOG("Weights cannot be bound to numa node ", numaNodeId);
+        }
+        break;
+    case WeightsNumaPolicy::INTERLEAVE:
+        if (!mbind_interleave(memory.getData(), memory.getSize())) {
+            DEBUG_LOG("Weights cannot be interleaved over numa nodes");
+        }
+        break;
+    case WeightsNumaPolicy::BIND:
+    default:
+        // the pages are first touched by the stream threads, which are pinned to the stream node
+        break;
+    }
+}
+
+SocketsWeights::SocketsWeights(WeightsNumaPolicy policy) : _policy(policy) {
+    switch (_policy) {
+    case WeightsNumaPolicy::REPLICATE: {
+        int num_numa_nodes = get_num_numa_nodes();
+        for (int numa_node_id = 0; numa_node_id < num_numa_nodes; numa_node_id++) {
+            _cache_map[numa_node_id] = std::make_shared<WeightsSharing>(_policy, numa_node_id);
+        }
+        break;
+    }
+    case WeightsNumaPolicy::INTERLEAVE:
+        _cache_map[0] = std::make_shared<WeightsSharing>(_policy, -1);
+        break;
+    case WeightsNumaPolicy::BIND:
+    default: {
+        int num_sockets = get_num_sockets();
+        for (int socket_id = 0; socket_id < num_sockets; socket_id++) {
+            _cache_map[socket_id] = std::make_shared<WeightsSharing>(_policy, -1);
+        }
+        break;
+    }
+    }
+}
+
+const WeightsSharing::Ptr& SocketsWeights::forStream(int socket_id, int numa_node_id) const {
+    switch (_policy) {
+    case WeightsNumaPolicy::REPLICATE:
+        return (*this)[std::max(0, numa_node_id)];
+    case WeightsNumaPolicy::INTERLEAVE:
+        return (*this)[0];
+    case WeightsNumaPolicy::BIND:
+    default:
+        return (*this)[std::max(0, socket_id)];
     }
 }
 
@@ -112,7 +167,7 @@ const WeightsSharing::Ptr& SocketsWeights::operator[](int socket_id) const {
 
 #ifdef CPU_DEBUG_CAPS
 WeightsSharing::Statistics WeightsSharing::dumpStatistics() const {
-    Statistics retVal = {0, 0};
+    Statistics retVal = {0, 0, {}};
 
     std::lock_guard<std::mutex> lock(guard);
 
@@ -121,6 +176,9 @@ WeightsSharing::Statistics WeightsSharing::dumpStatistics() const {
         if (memory) {
             retVal.total_size += memory->getDesc().getCurrentMemSize();
             retVal.total_memory_objects++;
+            for (const auto& [node, size] : numa_resident_size(memory->getData(), memory->getSize())) {
+                retVal.resident_size[node] += size;
+            }
         }
     }
 
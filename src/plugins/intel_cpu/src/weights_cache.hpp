@@ -16,6 +16,7 @@
 #include <vector>
 
 #include "cpu_memory.h"
+#include "internal_properties.hpp"
 
 // TODO: While CPU plugin has no ease way to clone graph object we use weight
 //       caching in global Engine context to avoid tensor memory duplication.
@@ -46,11 +47,18 @@ public:
     struct Statistics {
         size_t total_size;  // bytes
         size_t total_memory_objects;
+        std::map<int, size_t> resident_size;  // bytes per NUMA node
     };
 #endif  // CPU_DEBUG_CAPS
 
     using Ptr = std::shared_ptr<WeightsSharing>;
 
+    WeightsSharing() = default;
+    /**
+     * @param numaNodeId the node the copies are placed on in the REPLICATE mode
+     */
+    WeightsSharing(WeightsNumaPolicy policy, int numaNodeId) : policy(policy), numaNodeId(numaNodeId) {}
+
     class SharedMemory {
     public:
         using Ptr = std::shared_ptr<SharedMemory>;
@@ -73,6 +81,23 @@ public:
 
     SharedMemory::Ptr get(const std::string& key) const;
 
+    /**
+     * Places the pages of a new weights copy according to the NUMA policy.
+     * Must be called before the memory is filled, so the pages are first touched on the right node
+     */
+    void place(const IMemory& memory) const;
+
+    [[nodiscard]] WeightsNumaPolicy getPolicy() const {
+        return policy;
+    }
+
+    /**
+     * Whether the weights are moved to the NUMA node of the stream which executes the node
+     */
+    static bool followsStreamNode(const Ptr& cache) {
+        return !cache || cache->policy == WeightsNumaPolicy::BIND;
+    }
+
 #ifdef CPU_DEBUG_CAPS
     Statistics dumpStatistics() const;
 #endif  // CPU_DEBUG_CAPS
@@ -80,25 +105,35 @@ public:
 protected:
     mutable std::mutex guard;
     std::unordered_map<std::string, MemoryInfo::Ptr> sharedWeights;
+    WeightsNumaPolicy policy = WeightsNumaPolicy::BIND;
+    int numaNodeId = -1;
 };
 
 /**
  * Collection of memory caching store per socket
+ * The stores are keyed by the socket id in the BIND mode, by the NUMA node id in the REPLICATE mode, and a single
+ * store is shared by all the streams in the INTERLEAVE mode
  *
  * Is a thread safe
  */
 class SocketsWeights {
 public:
-    SocketsWeights();
+    explicit SocketsWeights(WeightsNumaPolicy policy = WeightsNumaPolicy::BIND);
 
     WeightsSharing::Ptr& operator[](int socket_id);
     const WeightsSharing::Ptr& operator[](int socket_id) const;
 
+    /**
+     * Returns the store used by a stream running on the socket and the NUMA node
+     */
+    const WeightsSharing::Ptr& forStream(int socket_id, int numa_node_id) const;
+
 #ifdef CPU_DEBUG_CAPS
     [[nodiscard]] std::vector<std::pair<int, WeightsSharing::Statistics>> dumpStatistics() const;
 #endif  // CPU_DEBUG_CAPS
 
 private:
+    WeightsNumaPolicy _policy;
     std::map<int, WeightsSharing::Ptr> _cache_map;
 };
 
@@ -2,15 +2,21 @@
 // SPDX-License-corer: Apache-2.0
 //
 
+#include <cstring>
+#include <sstream>
+#include <string>
+
 #include "openvino/runtime/core.hpp"
 #include "openvino/runtime/compiled_model.hpp"
 #include "common_test_utils/test_common.hpp"
 #include "common_test_utils/node_builders/eltwise.hpp"
 #include "common_test_utils/node_builders/constant.hpp"
+#include "common_test_utils/ov_tensor_utils.hpp"
 #include "functional_test_utils/skip_tests_config.hpp"
 #include "openvino/opsets/opset9_decl.hpp"
 #include "openvino/op/matmul.hpp"
 #include "openvino/op/softmax.hpp"
+#include "openvino/pass/serialize.hpp"
 #include "openvino/opsets/opset9_decl.hpp"
 
 namespace {
@@ -124,4 +130,65 @@ INSTANTIATE_TEST_SUITE_P(smoke_ExportImportTest,
                                                              testing_property_for_enable_hyper_threading,
                                                              testing_property_for_enable_cpu_pinning)));
 
+TEST(ExportImportTest, PackedWeights) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED();
+    ov::Core core;
+    auto compiled_model = core.compile_model(MakeMatMulModel(), "CPU", ov::num_streams(1));
+
+    auto input = ov::test::utils::create_and_fill_tensor(ov::element::f32, {1, 4096});
+    auto infer = [&](ov::CompiledModel& model) {
+        auto request = model.create_infer_request();
+        request.set_input_tensor(input);
+        request.infer();
+        return request.get_output_tensor();
+    };
+    auto expected = infer(compiled_model);
+
+    std::stringstream exported_model;
+    compiled_model.export_model(exported_model);
+    const auto blob = exported_model.str();
+
+    // the packed weights area ends the custom data section, its size is described in the cnndata xml
+    ov::pass::StreamSerialize::DataHeader hdr = {};
+    ASSERT_GT(blob.size(), sizeof(hdr));
+    std::memcpy(&hdr, blob.data(), sizeof(hdr));
+    const auto xml = blob.substr(hdr.custom_data_offset, hdr.custom_data_size);
+    const std::string size_attr = "<packed_weights size=\"";
+    const auto size_pos = xml.find(size_attr);
+    ASSERT_NE(size_pos, std::string::npos) << "The repacked weights are not stored in the blob";
+    ASSERT_NE(xml.find("<entry ", size_pos), std::string::npos) << "The repacked weights are not stored in the blob";
+    const auto packed_size = std::stoull(xml.substr(size_pos + size_attr.size()));
+    ASSERT_GT(packed_size, 0u);
+    ASSERT_LE(packed_size, hdr.custom_data_size);
+    const auto packed_offset = hdr.custom_data_offset + hdr.custom_data_size - packed_size;
+
+    // the weights are not repacked from the constants on import, so the zeroed packed weights change the results
+    auto corrupted_blob = blob;
+    std::memset(&corrupted_blob[packed_offset], 0, packed_size);
+
+    // the repacked weights are read from the stream
+    {
+        std::stringstream ss(blob);
+        auto imported_model = core.import_model(ss, "CPU", ov::num_streams(1));
+        ov::test::utils::compare(expected, infer(imported_model));
+
+        std::stringstream corrupted_ss(corrupted_blob);
+        auto corrupted_model = core.import_model(corrupted_ss, "CPU", ov::num_streams(1));
+        EXPECT_ANY_THROW(ov::test::utils::compare(expected, infer(corrupted_model)));
+    }
+
+    // the repacked weights are used in place from the blob tensor
+    {
+        ov::Tensor blob_tensor(ov::element::u8, {blob.size()});
+        std::memcpy(blob_tensor.data(), blob.data(), blob.size());
+        auto imported_model = core.import_model(blob_tensor, "CPU", ov::num_streams(1));
+        ov::test::utils::compare(expected, infer(imported_model));
+
+        ov::Tensor corrupted_tensor(ov::element::u8, {corrupted_blob.size()});
+        std::memcpy(corrupted_tensor.data(), corrupted_blob.data(), corrupted_blob.size());
+        auto corrupted_model = core.import_model(corrupted_tensor, "CPU", ov::num_streams(1));
+        EXPECT_ANY_THROW(ov::test::utils::compare(expected, infer(corrupted_model)));
+    }
+}
+
 }  // namespace
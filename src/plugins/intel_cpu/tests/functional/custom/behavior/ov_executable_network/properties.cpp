@@ -6,11 +6,19 @@
 
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <filesystem>
+#include <thread>
+
+#include "common_test_utils/common_utils.hpp"
 #include "common_test_utils/ov_tensor_utils.hpp"
 #include "common_test_utils/subgraph_builders/matmul_bias.hpp"
 #include "internal_properties.hpp"
 #include "openvino/runtime/compiled_model.hpp"
 #include "openvino/runtime/core.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/relu.hpp"
+#include "openvino/op/result.hpp"
 #include "openvino/runtime/intel_cpu/properties.hpp"
 #include "openvino/runtime/system_conf.hpp"
 #include "utils/properties_test.hpp"
@@ -54,7 +62,9 @@ TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkSupportedPropertiesAreAvailable
         RO_property(ov::key_cache_precision.name()),
         RO_property(ov::value_cache_precision.name()),
         RO_property(ov::key_cache_group_size.name()),
-        RO_property(ov::value_cache_group_size.name())
+        RO_property(ov::value_cache_group_size.name()),
+        RO_property(ov::intel_cpu::runtime_statistics.name()),
+        RO_property(ov::intel_cpu::kv_cache_memory_size.name())
     };
 
     ov::Core ie;
@@ -413,6 +423,79 @@ TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckCPUExecutionDevice) {
     ASSERT_EQ(value.as<std::string>(), "CPU");
 }
 
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckRuntimeStatistics) {
+    auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{-1, 16});
+    auto relu = std::make_shared<ov::op::v0::Relu>(param);
+    auto result = std::make_shared<ov::op::v0::Result>(relu);
+    auto dynamic_model = std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{param});
+
+    ov::Core ie;
+    ov::CompiledModel compiledModel = ie.compile_model(dynamic_model, deviceName, ov::num_streams(1));
+    std::map<std::string, uint64_t> statistics;
+    OV_ASSERT_NO_THROW(statistics = compiledModel.get_property(ov::intel_cpu::runtime_statistics));
+    ASSERT_EQ(statistics.at("PREPARE_PARAMS"), 0);
+
+    auto request = compiledModel.create_infer_request();
+    for (size_t batch : {1, 8, 1}) {
+        request.set_input_tensor(ov::Tensor(ov::element::f32, ov::Shape{batch, 16}));
+        request.infer();
+    }
+    OV_ASSERT_NO_THROW(statistics = compiledModel.get_property(ov::intel_cpu::runtime_statistics));
+    // each new shape updates the primitives and looks them up in the runtime cache
+    EXPECT_GE(statistics.at("PREPARE_PARAMS"), 3);
+    EXPECT_GT(statistics.at("RUNTIME_CACHE_HITS"), 0);
+    EXPECT_GT(statistics.at("RUNTIME_CACHE_MISSES"), 0);
+    EXPECT_EQ(statistics.count("RUNTIME_CACHE_EVICTIONS"), 1);
+    EXPECT_EQ(statistics.count("OUTPUT_REALLOCATIONS"), 1);
+}
+
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkShapeWarmupCacheAfterImport) {
+    auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{-1, 16});
+    auto relu = std::make_shared<ov::op::v0::Relu>(param);
+    auto result = std::make_shared<ov::op::v0::Result>(relu);
+    auto dynamic_model = std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{param});
+
+    const auto cache_dir = ov::test::utils::generateTestFilePrefix() + "_shape_warmup_cache";
+    const ov::AnyMap config{{ov::intel_cpu::cpu_shape_warmup_cache.name(), true}, ov::num_streams(1)};
+    const std::vector<size_t> batches{1, 8, 3};
+    auto infer = [&](ov::CompiledModel& compiled_model) {
+        auto request = compiled_model.create_infer_request();
+        for (size_t batch : batches) {
+            request.set_input_tensor(ov::Tensor(ov::element::f32, ov::Shape{batch, 16}));
+            request.infer();
+        }
+    };
+
+    ov::Core ie;
+    ie.set_property(ov::cache_dir(cache_dir));
+    {
+        // the model is exported to the cache, the shapes are written when the compiled model is released
+        auto compiledModel = ie.compile_model(dynamic_model, deviceName, config);
+        ASSERT_FALSE(compiledModel.get_property(ov::loaded_from_cache));
+        infer(compiledModel);
+    }
+
+    auto compiledModel = ie.compile_model(dynamic_model, deviceName, config);
+    ASSERT_TRUE(compiledModel.get_property(ov::loaded_from_cache));
+    // the recorded shapes are inferred in the background after the import
+    auto statistics = compiledModel.get_property(ov::intel_cpu::runtime_statistics);
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+    while (statistics.at("PREPARE_PARAMS") < batches.size() && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        statistics = compiledModel.get_property(ov::intel_cpu::runtime_statistics);
+    }
+    ASSERT_GE(statistics.at("PREPARE_PARAMS"), batches.size());
+    const auto misses = statistics.at("RUNTIME_CACHE_MISSES");
+
+    infer(compiledModel);
+    statistics = compiledModel.get_property(ov::intel_cpu::runtime_statistics);
+    // the warmed shapes are served from the runtime cache
+    EXPECT_EQ(statistics.at("RUNTIME_CACHE_MISSES"), misses);
+
+    std::error_code ec;
+    std::filesystem::remove_all(cache_dir, ec);
+}
+
 TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckCPURuntimOptions) {
     ov::Core ie;
     ov::Any type;
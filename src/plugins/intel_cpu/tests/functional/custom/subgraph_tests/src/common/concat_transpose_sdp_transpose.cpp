@@ -2,16 +2,19 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include "common_test_utils/common_utils.hpp"
 #include "common_test_utils/include/common_test_utils/ov_tensor_utils.hpp"
 #include "internal_properties.hpp"
 #include "openvino/core/type/float16.hpp"
 #include "openvino/opsets/opset13_decl.hpp"
 #include "openvino/pass/manager.hpp"
+#include "openvino/util/file_util.hpp"
 #include "shared_test_classes/base/ov_subgraph.hpp"
 #include "transformations/op_conversions/scaled_dot_product_attention_decomposition.hpp"
 #include "utils/cpu_test_utils.hpp"
 #include "utils/general_utils.h"
 #include "openvino/opsets/opset13_decl.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
 #include "openvino/op/add.hpp"
 #include "openvino/op/concat.hpp"
 #include "openvino/op/gather.hpp"
@@ -388,6 +391,120 @@ INSTANTIATE_TEST_SUITE_P(smoke_ConcatSDPTransposeByChannelTest,
                          ConcatSDPTransposeTest::getTestCaseName);
 }  //  namespace
 
+class ConcatSDPTransposeU4Test : public ConcatSDPTransposeTest {
+public:
+    void SetUp() override {
+        ConcatSDPTransposeTest::SetUp();
+        configuration[ov::key_cache_precision.name()] = ov::element::u4;
+        configuration[ov::value_cache_precision.name()] = ov::element::u4;
+        abs_threshold = 0.1f;
+    }
+};
+
+TEST_P(ConcatSDPTransposeU4Test, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED();
+    auto actualOutputs = run_test(function);
+    CheckNumberOfNodesWithType(compiledModel, "ScaledDotProductAttention", 1);
+    CheckNumberOfNodesWithType(compiledModel, "Concatenation", 0);
+    auto expectedOutputs = run_test(functionRefs);
+    CheckNumberOfNodesWithType(compiledModel, "ScaledDotProductAttention", 0);
+    for (size_t i = 0; i < actualOutputs.size(); i++) {
+        ov::test::utils::compare(expectedOutputs[i], actualOutputs[i], abs_threshold, rel_threshold);
+    }
+}
+
+namespace {
+INSTANTIATE_TEST_SUITE_P(smoke_ConcatSDPTransposeU4Test,
+                         ConcatSDPTransposeU4Test,
+                         ::testing::Combine(::testing::Values(ElementType::f32),
+                                            ::testing::ValuesIn(inputShapeAndReorders),
+                                            ::testing::Values(false),
+                                            ::testing::Values(false),
+                                            ::testing::Values(16)),
+                         ConcatSDPTransposeU4Test::getTestCaseName);
+}  //  namespace
+
+class ConcatSDPTransposeTestOffload : public ConcatSDPTransposeTestBase {
+public:
+    std::vector<ov::Tensor> run_test(std::shared_ptr<ov::Model> model, bool offload) {
+        function = model;
+        prepare();
+        std::vector<ov::Tensor> outputs;
+        const auto file_prefix = ov::test::utils::generateTestFilePrefix();
+        int idx = 0;
+        for (auto&& shapes : targetStaticShapes) {
+            generate(idx++, shapes);
+            for (const auto& input : inputs) {
+                inferRequest.set_tensor(input.first, input.second);
+            }
+            inferRequest.infer();
+            auto outputTensor = inferRequest.get_output_tensor(0);
+            ov::Tensor copy{outputTensor.get_element_type(), outputTensor.get_shape()};
+            outputTensor.copy_to(copy);
+            outputs.push_back(copy);
+            if (offload) {
+                EXPECT_GT(compiledModel.get_property(ov::intel_cpu::kv_cache_memory_size), 0);
+                // the next inference loads the states back
+                for (auto&& state : inferRequest.query_state()) {
+                    const auto file_path = file_prefix + "_" + state.get_name() + ".bin";
+                    state.offload(file_path);
+                    EXPECT_TRUE(ov::util::file_exists(file_path));
+                }
+                // the offloaded states hold no memory
+                EXPECT_EQ(compiledModel.get_property(ov::intel_cpu::kv_cache_memory_size), 0);
+            }
+        }
+        for (auto&& state : inferRequest.query_state()) {
+            auto state_tensor = state.get_state();
+            ov::Tensor copy{state_tensor.get_element_type(), state_tensor.get_shape()};
+            state_tensor.copy_to(copy);
+            outputs.push_back(copy);
+            if (offload) {
+                // get_state() reads the offloaded state without loading it back, reset() drops the file
+                const auto file_path = file_prefix + "_" + state.get_name() + ".bin";
+                EXPECT_TRUE(ov::util::file_exists(file_path));
+                state.reset();
+                EXPECT_FALSE(ov::util::file_exists(file_path));
+            }
+        }
+        reset();
+
+        return outputs;
+    }
+};
+
+TEST_P(ConcatSDPTransposeTestOffload, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED();
+    auto actualOutputs = run_test(function, true);
+    CheckNumberOfNodesWithType(compiledModel, "ScaledDotProductAttention", 1);
+    auto expectedOutputs = run_test(functionRefs, false);
+    CheckNumberOfNodesWithType(compiledModel, "ScaledDotProductAttention", 0);
+    ASSERT_EQ(expectedOutputs.size(), actualOutputs.size());
+    for (size_t i = 0; i < actualOutputs.size(); i++) {
+        ov::test::utils::compare(expectedOutputs[i], actualOutputs[i], abs_threshold, rel_threshold);
+    }
+}
+
+namespace {
+INSTANTIATE_TEST_SUITE_P(smoke_ConcatSDPTransposeTestOffload,
+                         ConcatSDPTransposeTestOffload,
+                         ::testing::Combine(::testing::Values(ElementType::f32),
+                                            ::testing::ValuesIn(inputShapeAndReorders),
+                                            ::testing::Values(false),
+                                            ::testing::Values(false),
+                                            ::testing::Values(0)),
+                         ConcatSDPTransposeTestOffload::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_ConcatSDPTransposeByChannelTestOffload,
+                         ConcatSDPTransposeTestOffload,
+                         ::testing::Combine(::testing::Values(ElementType::f32),
+                                            ::testing::ValuesIn(shapesWithGreedySearch),
+                                            ::testing::Values(false),
+                                            ::testing::Values(true),
+                                            ::testing::Values(8)),
+                         ConcatSDPTransposeTestOffload::getTestCaseName);
+}  //  namespace
+
 class ConcatSDPTransposeTestSetState : public ConcatSDPTransposeTestBase {
 public:
     void reduce_state() {
@@ -0,0 +1,100 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+#include <numeric>
+#include <vector>
+
+#include "common_test_utils/ov_plugin_cache.hpp"
+#include "common_test_utils/ov_tensor_utils.hpp"
+#include "openvino/op/softmax.hpp"
+
+namespace ov {
+namespace test {
+
+/* The user input tensors matching the input memory descriptor are bound to the graph memory, the other ones are
+   copied into the graph and the reason is reported by the "InputCopy" perf counter of the input.
+
+    Param
+      |
+   Softmax
+      |
+    Result
+*/
+
+class InputZeroCopyTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, shape);
+        param->set_friendly_name("input");
+        auto softmax = std::make_shared<ov::op::v1::Softmax>(param, 1);
+        auto result = std::make_shared<ov::op::v0::Result>(softmax);
+        auto model = std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{param});
+
+        auto core = ov::test::utils::PluginCache::get().core();
+        compiled_model = core->compile_model(model, "CPU", ov::enable_profiling(true));
+    }
+
+    static const ov::ProfilingInfo* find_input_copy(const std::vector<ov::ProfilingInfo>& perf_counts) {
+        for (const auto& item : perf_counts) {
+            if (item.node_type == "InputCopy") {
+                return &item;
+            }
+        }
+        return nullptr;
+    }
+
+    const ov::Shape shape{1, 4, 8, 8};
+    ov::CompiledModel compiled_model;
+};
+
+TEST_F(InputZeroCopyTest, smoke_BindCompatibleTensor) {
+    auto req = compiled_model.create_infer_request();
+    ov::Tensor input(ov::element::f32, shape);
+    std::iota(input.data<float>(), input.data<float>() + input.get_size(), 0.f);
+    req.set_input_tensor(input);
+    req.infer();
+
+    EXPECT_EQ(find_input_copy(req.get_profiling_info()), nullptr);
+}
+
+TEST_F(InputZeroCopyTest, smoke_CopyMisalignedTensor) {
+    auto ref_req = compiled_model.create_infer_request();
+    auto req = compiled_model.create_infer_request();
+
+    ov::Tensor bound(ov::element::f32, shape);
+    std::iota(bound.data<float>(), bound.data<float>() + bound.get_size(), 0.f);
+    const ov::Tensor bound_copy(ov::element::f32, shape);
+    bound.copy_to(bound_copy);
+    req.set_input_tensor(bound);
+    req.infer();
+    ASSERT_EQ(find_input_copy(req.get_profiling_info()), nullptr);
+
+    ov::Tensor aligned(ov::element::f32, shape);
+    std::iota(aligned.data<float>(), aligned.data<float>() + aligned.get_size(), 100.f);
+    std::vector<uint8_t> buffer(aligned.get_byte_size() + sizeof(float));
+    auto* misaligned_ptr = buffer.data() + 1;
+    std::memcpy(misaligned_ptr, aligned.data(), aligned.get_byte_size());
+    ov::Tensor misaligned(ov::element::f32, shape, misaligned_ptr);
+
+    req.set_input_tensor(misaligned);
+    req.infer();
+    const auto* input_copy = find_input_copy(req.get_profiling_info());
+    ASSERT_NE(input_copy, nullptr);
+    EXPECT_EQ(input_copy->node_name, "input");
+    EXPECT_EQ(input_copy->exec_type, "misaligned data");
+
+    // the data of the misaligned tensor must not be written to the tensor bound before
+    ov::test::utils::compare(bound_copy, bound);
+
+    ref_req.set_input_tensor(aligned);
+    ref_req.infer();
+    ov::test::utils::compare(ref_req.get_output_tensor(), req.get_output_tensor());
+}
+
+}  // namespace test
+}  // namespace ov
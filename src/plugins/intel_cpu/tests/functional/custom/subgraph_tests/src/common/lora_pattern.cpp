@@ -9,6 +9,7 @@
 #include "utils/cpu_test_utils.hpp"
 #include "openvino/op/add.hpp"
 #include "openvino/op/convert.hpp"
+#include "openvino/op/gather.hpp"
 #include "openvino/op/matmul.hpp"
 #include "openvino/op/multiply.hpp"
 #include "openvino/op/transpose.hpp"
@@ -283,6 +284,45 @@ protected:
     static constexpr size_t num_channels = 64ul;
 };
 
+class LoraPatternAdapterBanksCPUTest : public LoraPatternBaseCPUTest {
+protected:
+    void init_function() override {
+        ov::PartialShape shape_x = {-1, -1, K};
+        ov::PartialShape shape_w = {N, K};
+
+        auto param_y = std::make_shared<ov::op::v0::Parameter>(netType, shape_x);
+        auto param_w = std::make_shared<ov::op::v0::Parameter>(netType, shape_w);
+        // the adapter of every batch row
+        auto param_indices = std::make_shared<ov::op::v0::Parameter>(ov::element::i32, ov::PartialShape{-1});
+
+        auto tx = std::make_shared<ov::op::v0::MatMul>(param_y, param_w, false, true);
+
+        // LoRA parameters of all the adapters from states
+        auto states = create_states({{-1, N, -1}, {-1, 1, -1}, {-1, -1, K}}, {t4_name, t5_name, t6_name});
+        ov::OutputVector matrices;
+        for (const auto& bank : states.first) {
+            auto axis = ov::op::v0::Constant::create(ov::element::i32, ov::Shape{}, {0});
+            matrices.push_back(std::make_shared<ov::op::v8::Gather>(bank, param_indices, axis));
+        }
+
+        auto t5810 = std::make_shared<ov::op::v0::MatMul>(param_y, matrices[2], false, true);
+        auto t5811 = std::make_shared<ov::op::v1::Multiply>(t5810, matrices[1]);
+        auto t5812 = std::make_shared<ov::op::v0::MatMul>(t5811, matrices[0], false, true);
+
+        auto tz = std::make_shared<ov::op::v1::Add>(tx, t5812);
+
+        auto result_x = std::make_shared<ov::op::v0::Result>(tx);
+        auto result_z = std::make_shared<ov::op::v0::Result>(tz);
+
+        function = std::make_shared<ov::Model>(ov::ResultVector({result_x, result_z}),
+                                               states.second,
+                                               ov::ParameterVector({param_y, param_w, param_indices}));
+    }
+
+    static constexpr size_t K = 563ul;   // Weights matrix K dimension
+    static constexpr size_t N = 2048ul;  // Weights matrix N dimension
+};
+
 TEST_P(LoraPatternMatmulCPUTest, CompareWithRefs) {
     SKIP_IF_CURRENT_TEST_IS_DISABLED();
     targetStaticShapes = {{{{1, 20, K}}, {{N, K}}}};
@@ -299,6 +339,15 @@ TEST_P(LoraPatternConvolutionCPUTest, CompareWithRefs) {
     CPUTestUtils::CheckNumberOfNodesWithType(compiledModel, "MatMul", 0);
 }
 
+TEST_P(LoraPatternAdapterBanksCPUTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED();
+    targetStaticShapes = {{{{5, 7, K}}, {{N, K}}, {{5}}}};
+    run_test();
+    CPUTestUtils::CheckNumberOfNodesWithType(compiledModel, "LoRA", 1);
+    CPUTestUtils::CheckNumberOfNodesWithType(compiledModel, "MatMul", 1);
+    CPUTestUtils::CheckNumberOfNodesWithType(compiledModel, "Gather", 0);
+}
+
 const ov::element::TypeVector states_precisions {ov::element::f32, ov::element::f16};
 const std::vector<StatesPolicy> states_policies {StatesPolicy::EMPTY_TENSORS, StatesPolicy::RANDOM_TENSORS};
 
@@ -314,5 +363,11 @@ INSTANTIATE_TEST_SUITE_P(smoke_Snippets_LoRA_CPU_Conv, LoraPatternConvolutionCPU
                                  ::testing::ValuesIn(states_policies)),
                          LoraPatternBaseCPUTest::getTestCaseName);
 
+INSTANTIATE_TEST_SUITE_P(smoke_Snippets_LoRA_CPU_AdapterBanks, LoraPatternAdapterBanksCPUTest,
+                         ::testing::Combine(
+                                 ::testing::ValuesIn(states_precisions),
+                                 ::testing::ValuesIn(states_policies)),
+                         LoraPatternBaseCPUTest::getTestCaseName);
+
 }  // namespace test
 }  // namespace ov
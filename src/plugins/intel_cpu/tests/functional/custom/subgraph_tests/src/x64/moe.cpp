@@ -284,6 +284,12 @@ const std::vector<MoePatternParams> moe_params_smoke = {
         4,                                                           // number_of_experts
         256                                                          // intermediate_size
     },
+    {
+        {{-1, -1, 128}, {{1, 64, 128}, {1, 3, 128}, {2, 40, 128}}},  // Many experts with a few tokens each
+        2,                                                           // topk
+        32,                                                          // number_of_experts
+        128                                                          // intermediate_size
+    },
 };
 
 std::vector<ov::AnyMap> generate_additional_config() {
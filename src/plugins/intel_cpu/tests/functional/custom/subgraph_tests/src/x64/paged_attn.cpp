@@ -657,6 +657,12 @@ const std::vector<InputShapes> inputShapeAndReorders = {  // greedy search
         {{-1, 1, 8, 64}, {{256, 1, 8, 64}, {1, 1, 8, 64}}},
         // B, L0, H, S
         {{-1, 1, 8, 64}, {{0, 1, 8, 64}, {256, 1, 8, 64}}},
+    },
+    {
+        // L1, B, H, S: verification of the draft tokens of the speculative decoding
+        {{-1, 1, 8, 64}, {{256, 1, 8, 64}, {5, 1, 8, 64}, {1, 1, 8, 64}}},
+        // B, L0, H, S
+        {{-1, 1, 8, 64}, {{0, 1, 8, 64}, {256, 1, 8, 64}, {261, 1, 8, 64}}},
     }};
 
 INSTANTIATE_TEST_SUITE_P(smoke_PagedAttnVSSDPATest,
@@ -0,0 +1,90 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include <vector>
+
+#include "compiled_model.h"
+#include "graph.h"
+#include "openvino/core/model.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/result.hpp"
+#include "openvino/op/softmax.hpp"
+#include "openvino/runtime/iasync_infer_request.hpp"
+#include "openvino/runtime/make_tensor.hpp"
+#include "openvino/runtime/properties.hpp"
+#include "plugin.h"
+
+using namespace ov::intel_cpu;
+
+namespace {
+
+class InputZeroCopyTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, shape);
+        auto softmax = std::make_shared<ov::op::v1::Softmax>(param, 1);
+        auto result = std::make_shared<ov::op::v0::Result>(softmax);
+        auto model = std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{param});
+
+        auto plugin = std::make_shared<Plugin>();
+        plugin->set_device_name("CPU");
+        // a single stream, so the request and the test refer to the same graph
+        compiled_model =
+            std::dynamic_pointer_cast<const CompiledModel>(plugin->compile_model(model, {ov::num_streams(1)}));
+        ASSERT_NE(compiled_model, nullptr);
+    }
+
+    // the memory the input node of the graph provides to its consumers
+    const void* graph_input_data() const {
+        CompiledModelHolder holder(compiled_model);
+        return holder.graph().getInputNodeByIndex(0)->getDstDataAtPort(0);
+    }
+
+    ov::SoPtr<ov::ITensor> make_input(float start) const {
+        auto tensor = ov::make_tensor(ov::element::f32, shape);
+        std::iota(tensor->data<float>(), tensor->data<float>() + tensor->get_size(), start);
+        return tensor;
+    }
+
+    const ov::Shape shape{1, 4, 8, 8};
+    std::shared_ptr<const CompiledModel> compiled_model;
+};
+
+TEST_F(InputZeroCopyTest, BindCompatibleTensor) {
+    auto request = compiled_model->create_infer_request();
+    const auto input = make_input(0.f);
+    request->set_tensor(compiled_model->inputs()[0], input);
+    request->infer();
+
+    EXPECT_EQ(graph_input_data(), input->data());
+}
+
+TEST_F(InputZeroCopyTest, RebindAfterMisalignedTensor) {
+    auto request = compiled_model->create_infer_request();
+    const auto bound = make_input(0.f);
+    request->set_tensor(compiled_model->inputs()[0], bound);
+    request->infer();
+    ASSERT_EQ(graph_input_data(), bound->data());
+
+    const auto aligned = make_input(100.f);
+    std::vector<uint8_t> buffer(aligned->get_byte_size() + sizeof(float));
+    auto* misaligned_ptr = buffer.data() + 1;
+    const auto misaligned = ov::make_tensor(ov::element::f32, shape, misaligned_ptr);
+    request->set_tensor(compiled_model->inputs()[0], misaligned);
+    request->infer();
+    EXPECT_NE(graph_input_data(), misaligned_ptr);
+    EXPECT_NE(graph_input_data(), bound->data());
+
+    // the tensor bound before is bound again instead of being copied
+    request->set_tensor(compiled_model->inputs()[0], bound);
+    request->infer();
+    EXPECT_EQ(graph_input_data(), bound->data());
+}
+
+}  // namespace
@@ -0,0 +1,204 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+#include "common_test_utils/test_assertions.hpp"
+#include "kv_block_manager.hpp"
+#include "openvino/core/except.hpp"
+#include "openvino/runtime/tensor.hpp"
+
+using namespace ov::intel_cpu;
+
+namespace {
+std::vector<KVBlockManager::Token> make_tokens(size_t count, KVBlockManager::Token start = 0) {
+    std::vector<KVBlockManager::Token> tokens(count);
+    std::iota(tokens.begin(), tokens.end(), start);
+    return tokens;
+}
+}  // namespace
+
+TEST(KVBlockManagerTests, PagedInputs) {
+    constexpr size_t block_size = 4;
+    KVBlockManager manager(16, block_size);
+
+    ASSERT_EQ(manager.add_sequence(0, make_tokens(6)), 0);
+    ASSERT_EQ(manager.add_sequence(1, make_tokens(3, 100)), 0);
+
+    auto inputs = manager.get_paged_inputs({0, 1});
+    ASSERT_EQ(inputs.past_lens, (std::vector<int32_t>{0, 0}));
+    ASSERT_EQ(inputs.subsequence_begins, (std::vector<int32_t>{0, 6, 9}));
+    ASSERT_EQ(inputs.block_indices_begins, (std::vector<int32_t>{0, 2, 3}));
+    ASSERT_EQ(inputs.block_indices.size(), 3);
+    ASSERT_EQ(inputs.max_context_len, 6);
+
+    manager.commit({0, 1});
+    OV_ASSERT_NO_THROW(manager.append_tokens(0, {42}));
+    inputs = manager.get_paged_inputs({0});
+    ASSERT_EQ(inputs.past_lens, (std::vector<int32_t>{6}));
+    ASSERT_EQ(inputs.subsequence_begins, (std::vector<int32_t>{0, 1}));
+    ASSERT_EQ(inputs.block_indices.size(), 2);
+}
+
+TEST(KVBlockManagerTests, PrefixReuse) {
+    constexpr size_t block_size = 4;
+    KVBlockManager manager(16, block_size);
+
+    auto prompt = make_tokens(10);
+    ASSERT_EQ(manager.add_sequence(0, prompt), 0);
+    manager.commit({0});
+
+    // two full blocks are shared, the partially filled one is not
+    ASSERT_EQ(manager.add_sequence(1, prompt), 2 * block_size);
+    auto table0 = manager.get_block_table(0);
+    auto table1 = manager.get_block_table(1);
+    ASSERT_EQ(table0[0], table1[0]);
+    ASSERT_EQ(table0[1], table1[1]);
+    ASSERT_NE(table0[2], table1[2]);
+
+    auto inputs = manager.get_paged_inputs({1});
+    ASSERT_EQ(inputs.past_lens, (std::vector<int32_t>{2 * block_size}));
+    ASSERT_EQ(inputs.subsequence_begins, (std::vector<int32_t>{0, 2}));
+
+    // the last prompt token is recomputed even if the whole prompt is cached
+    auto aligned = make_tokens(2 * block_size);
+    ASSERT_EQ(manager.add_sequence(2, aligned), block_size);
+
+    // diverged prompt reuses only the common full blocks
+    auto diverged = prompt;
+    diverged[5] = -1;
+    ASSERT_EQ(manager.add_sequence(3, diverged), block_size);
+
+    auto stats = manager.get_statistics();
+    ASSERT_EQ(stats.hit_tokens, 4 * block_size);
+}
+
+TEST(KVBlockManagerTests, PrefixChain) {
+    constexpr size_t block_size = 4;
+    KVBlockManager manager(16, block_size);
+
+    auto prompt = make_tokens(9);
+    manager.add_sequence(0, prompt);
+    manager.commit({0});
+
+    // the same tokens in the second block don't match without the same first block
+    auto other_prefix = prompt;
+    other_prefix[0] = -1;
+    ASSERT_EQ(manager.add_sequence(1, other_prefix), 0);
+    ASSERT_NE(manager.get_block_table(0)[1], manager.get_block_table(1)[1]);
+}
+
+TEST(KVBlockManagerTests, PrefixSurvivesFree) {
+    constexpr size_t block_size = 4;
+    KVBlockManager manager(8, block_size);
+
+    auto prompt = make_tokens(9);
+    manager.add_sequence(0, prompt);
+    manager.commit({0});
+    manager.free_sequence(0);
+
+    auto stats = manager.get_statistics();
+    ASSERT_EQ(stats.cached_blocks, 2);
+    ASSERT_EQ(stats.free_blocks, 6);
+
+    ASSERT_EQ(manager.add_sequence(1, prompt), 2 * block_size);
+    stats = manager.get_statistics();
+    ASSERT_EQ(stats.cached_blocks, 0);
+}
+
+TEST(KVBlockManagerTests, CopyOnWrite) {
+    constexpr size_t block_size = 4;
+    KVBlockManager manager(8, block_size);
+
+    manager.add_sequence(0, make_tokens(6));
+    manager.commit({0});
+    manager.fork_sequence(0, 1);
+    ASSERT_EQ(manager.get_block_table(0), manager.get_block_table(1));
+
+    auto copies = manager.append_tokens(1, {7});
+    ASSERT_EQ(copies.size(), 1);
+    auto table0 = manager.get_block_table(0);
+    auto table1 = manager.get_block_table(1);
+    ASSERT_EQ(table0[0], table1[0]);
+    ASSERT_EQ(copies[0].src, table0[1]);
+    ASSERT_EQ(copies[0].dst, table1[1]);
+
+    // the original owner holds the only reference now and writes in place
+    ASSERT_TRUE(manager.append_tokens(0, {8}).empty());
+
+    ov::Tensor cache(ov::element::f32, {8, 2, block_size, 2});
+    auto* data = cache.data<float>();
+    const size_t block_elems = cache.get_size() / 8;
+    std::iota(data, data + cache.get_size(), 0.0f);
+    KVBlockManager::copy_blocks(cache, copies);
+    for (size_t i = 0; i < block_elems; i++) {
+        ASSERT_EQ(data[copies[0].dst * block_elems + i], data[copies[0].src * block_elems + i]);
+    }
+}
+
+TEST(KVBlockManagerTests, LruEviction) {
+    constexpr size_t block_size = 2;
+    KVBlockManager manager(4, block_size);
+
+    manager.add_sequence(0, make_tokens(5));
+    manager.commit({0});
+    manager.free_sequence(0);
+    ASSERT_EQ(manager.get_statistics().cached_blocks, 2);
+
+    // the new sequence needs all the blocks, so the cached prefix is evicted
+    manager.add_sequence(1, make_tokens(8, 100));
+    auto stats = manager.get_statistics();
+    ASSERT_EQ(stats.evicted_blocks, 2);
+    ASSERT_EQ(stats.cached_blocks, 0);
+    ASSERT_EQ(stats.free_blocks, 0);
+
+    ASSERT_FALSE(manager.can_add_sequence(1));
+    OV_EXPECT_THROW_HAS_SUBSTRING(manager.add_sequence(2, make_tokens(1)), ov::Exception, "out of KV cache blocks");
+}
+
+TEST(KVBlockManagerTests, PrefixCachingDisabled) {
+    constexpr size_t block_size = 4;
+    KVBlockManager manager(16, block_size, false);
+
+    auto prompt = make_tokens(12);
+    manager.add_sequence(0, prompt);
+    manager.commit({0});
+    ASSERT_EQ(manager.add_sequence(1, prompt), 0);
+}
+
+TEST(KVBlockManagerTests, Rollback) {
+    constexpr size_t block_size = 4;
+    KVBlockManager manager(8, block_size);
+
+    manager.add_sequence(0, make_tokens(6));
+    manager.commit({0});
+    const auto table = manager.get_block_table(0);
+    const auto free_blocks = manager.get_statistics().free_blocks;
+
+    manager.append_tokens(0, make_tokens(5, 6));
+    ASSERT_EQ(manager.get_block_table(0).size(), 3);
+    manager.rollback({0});
+    ASSERT_EQ(manager.get_num_computed_tokens(0), 6);
+    ASSERT_EQ(manager.get_block_table(0), table);
+    ASSERT_EQ(manager.get_statistics().free_blocks, free_blocks);
+
+    // the repeated tokens are the only uncomputed ones
+    manager.append_tokens(0, make_tokens(5, 6));
+    auto inputs = manager.get_paged_inputs({0});
+    ASSERT_EQ(inputs.past_lens, (std::vector<int32_t>{6}));
+    ASSERT_EQ(inputs.subsequence_begins, (std::vector<int32_t>{0, 5}));
+
+    // a new sequence keeps its cached prefix only
+    manager.commit({0});
+    ASSERT_EQ(manager.add_sequence(1, make_tokens(10)), 2 * block_size);
+    manager.rollback({1});
+    ASSERT_EQ(manager.get_block_table(1).size(), 2);
+    inputs = manager.get_paged_inputs({1});
+    ASSERT_EQ(inputs.past_lens, (std::vector<int32_t>{2 * block_size}));
+    ASSERT_EQ(inputs.subsequence_begins, (std::vector<int32_t>{0, 0}));
+}
@@ -0,0 +1,187 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <numeric>
+#include <vector>
+
+#include "nodes/kernels/scaled_attn/executor_pa_common.hpp"
+#include "openvino/core/parallel.hpp"
+#include "utils/plain_tensor.hpp"
+
+using namespace ov::intel_cpu;
+using namespace ov::Extensions::Cpu;
+
+TEST(PagedAttnWorkItemsTests, MixedPrefillDecodeOrderedByCost) {
+    constexpr size_t block_size = 32;
+    // decode with 11 tokens, prefill of 70 tokens, decode with 101 tokens
+    std::vector<int32_t> past_lens_data{10, 0, 100};
+    std::vector<int32_t> subsequence_begins_data{0, 1, 71, 72};
+    std::vector<int32_t> block_indices_begins_data{0, 1, 4, 8};
+    std::vector<int32_t> block_indices_data(8);
+    std::iota(block_indices_data.begin(), block_indices_data.end(), 0);
+
+    PlainTensor query, past_lens, subsequence_begins, block_indices, block_indices_begins;
+    past_lens.resize<int32_t>({past_lens_data.size()}, past_lens_data.data());
+    subsequence_begins.resize<int32_t>({subsequence_begins_data.size()}, subsequence_begins_data.data());
+    block_indices.resize<int32_t>({block_indices_data.size()}, block_indices_data.data());
+    block_indices_begins.resize<int32_t>({block_indices_begins_data.size()}, block_indices_begins_data.data());
+
+    WorkItems work_items;
+    work_items.reset(query, past_lens, subsequence_begins, block_indices, block_indices_begins, block_size);
+
+    // the order depends on the scheduling of the build, so the items are compared heaviest first
+    std::vector<AttnWorkItem> items;
+    for (size_t i = 0; i < work_items.attn_work_size(); i++) {
+        items.push_back(work_items.get_attn_work_item(i));
+    }
+    order_attn_work_items(items, 1, true);
+
+    // the prefill blocks see 32, 64 and 70 tokens
+    const std::vector<int64_t> expected_costs{32 * 64, 32 * 32, 6 * 70, 101, 11};
+    const std::vector<int32_t> expected_seqs{1, 1, 1, 2, 0};
+    ASSERT_EQ(items.size(), expected_costs.size());
+    for (size_t i = 0; i < expected_costs.size(); i++) {
+        EXPECT_EQ(items[i].cost, expected_costs[i]) << "at " << i;
+        EXPECT_EQ(items[i].batch_in_seq, expected_seqs[i]) << "at " << i;
+    }
+    EXPECT_EQ(items[0].q_block_id, 1);
+    EXPECT_EQ(work_items.get_max_attn_cost(), 32u * 64);
+    EXPECT_EQ(work_items.get_total_attn_cost(), 32u * 64 + 32 * 32 + 6 * 70 + 101 + 11);
+
+    // the kv blocks of the prefill only are reordered
+    EXPECT_EQ(work_items.get_reorder_max_batch_size(), 1u);
+    EXPECT_EQ(work_items.reorder_work_size(), 3u);
+}
+
+TEST(PagedAttnWorkItemsTests, SmallQueryIsSingleItem) {
+    constexpr size_t block_size = 32;
+    // decode with 11 tokens, 5 draft tokens after 100 tokens
+    std::vector<int32_t> past_lens_data{10, 100};
+    std::vector<int32_t> subsequence_begins_data{0, 1, 6};
+    std::vector<int32_t> block_indices_begins_data{0, 1, 5};
+    std::vector<int32_t> block_indices_data(5);
+    std::iota(block_indices_data.begin(), block_indices_data.end(), 0);
+
+    PlainTensor query, past_lens, subsequence_begins, block_indices, block_indices_begins;
+    past_lens.resize<int32_t>({past_lens_data.size()}, past_lens_data.data());
+    subsequence_begins.resize<int32_t>({subsequence_begins_data.size()}, subsequence_begins_data.data());
+    block_indices.resize<int32_t>({block_indices_data.size()}, block_indices_data.data());
+    block_indices_begins.resize<int32_t>({block_indices_begins_data.size()}, block_indices_begins_data.data());
+
+    WorkItems work_items;
+    work_items.reset(query, past_lens, subsequence_begins, block_indices, block_indices_begins, block_size, 16);
+    ASSERT_EQ(work_items.attn_work_size(), 2u);
+    const auto& item = work_items.get_attn_work_item(0);
+    EXPECT_EQ(item.batch_in_seq, 1);
+    EXPECT_EQ(item.q_len, 5);
+    EXPECT_EQ(item.cost, 5 * 105);
+    EXPECT_EQ(work_items.get_small_q_batch_size(), 1u);
+    EXPECT_EQ(work_items.get_reorder_max_batch_size(), 0u);
+    EXPECT_EQ(work_items.reorder_work_size(), 0u);
+
+    // the same step computed as the first token
+    work_items.reset(query, past_lens, subsequence_begins, block_indices, block_indices_begins, block_size);
+    EXPECT_EQ(work_items.get_small_q_batch_size(), 0u);
+    EXPECT_EQ(work_items.get_reorder_max_batch_size(), 1u);
+    EXPECT_EQ(work_items.reorder_work_size(), 4u);
+}
+
+namespace {
+// a prefill of 1024 tokens in blocks of 32 and 60 decode sequences, in the order of the sequences
+std::vector<AttnWorkItem> mixed_prefill_decode_items() {
+    std::vector<AttnWorkItem> items;
+    constexpr int32_t prefill_len = 1024;
+    constexpr int32_t block_size = 32;
+    for (int32_t block_id = 0; block_id < prefill_len / block_size; block_id++) {
+        items.push_back(AttnWorkItem{0, 0, prefill_len, block_id, int64_t{block_size} * (block_id + 1) * block_size});
+    }
+    for (int32_t i = 1; i <= 60; i++) {
+        items.push_back(AttnWorkItem{0, i, 1, 0, 500 + 50 * i});
+    }
+    return items;
+}
+}  // namespace
+
+TEST(PagedAttnWorkItemsTests, DynamicSchedulingHeaviestFirst) {
+    auto items = mixed_prefill_decode_items();
+    order_attn_work_items(items, 8, true);
+    EXPECT_TRUE(std::is_sorted(items.begin(), items.end(), [](const AttnWorkItem& a, const AttnWorkItem& b) {
+        return a.cost > b.cost;
+    }));
+}
+
+TEST(PagedAttnWorkItemsTests, StaticSchedulingBalancesRanges) {
+    auto items = mixed_prefill_decode_items();
+    constexpr size_t nthr = 8;
+    int64_t total = 0;
+    int64_t max_item = 0;
+    for (const auto& item : items) {
+        total += item.cost;
+        max_item = std::max(max_item, item.cost);
+    }
+
+    order_attn_work_items(items, nthr, false);
+    ASSERT_EQ(items.size(), 92u);
+    // the ranges of the static split: 92 items on 8 threads are 4 ranges of 12 and 4 ranges of 11 items
+    size_t start = 0;
+    for (size_t t = 0; t < nthr; t++) {
+        const size_t count = t < 4 ? 12 : 11;
+        int64_t cost = 0;
+        for (size_t i = start; i < start + count; i++) {
+            cost += items[i].cost;
+        }
+        // every range is within one item of the fair share
+        EXPECT_LE(cost, total / static_cast<int64_t>(nthr) + max_item) << "range " << t;
+        EXPECT_GE(cost, total / static_cast<int64_t>(nthr) - max_item) << "range " << t;
+        start += count;
+    }
+}
+
+// a benchmark of the work items order for the parallel loops of the build, not run by default since it measures time
+TEST(PagedAttnWorkItemsTests, DISABLED_MixedPrefillDecodeSchedulingPerformance) {
+    using namespace std::chrono;
+    constexpr size_t heads = 8;
+    constexpr size_t repeats = 20;
+    // the work of an item is proportional to its cost
+    const auto work = [](const AttnWorkItem& item) {
+        volatile float sum = 0.f;
+        for (int64_t i = 0; i < item.cost / 4; i++) {
+            sum = sum + 1.f;
+        }
+    };
+    const auto run = [&](const std::vector<AttnWorkItem>& items, bool dynamic) {
+        const auto start = steady_clock::now();
+        for (size_t r = 0; r < repeats; r++) {
+            if (dynamic) {
+                ov::parallel_for2d_dynamic(items.size(), heads, [&](size_t w, size_t) {
+                    work(items[w]);
+                });
+            } else {
+                ov::parallel_for2d(items.size(), heads, [&](size_t w, size_t) {
+                    work(items[w]);
+                });
+            }
+        }
+        return duration_cast<microseconds>(steady_clock::now() - start).count() / static_cast<int64_t>(repeats);
+    };
+
+    const auto nthr = static_cast<size_t>(parallel_get_max_threads());
+    const auto by_sequence = mixed_prefill_decode_items();
+    auto heaviest_first = by_sequence;
+    order_attn_work_items(heaviest_first, nthr, true);
+    auto balanced = by_sequence;
+    order_attn_work_items(balanced, nthr, false);
+    for (const bool dynamic : {false, true}) {
+        std::cout << (dynamic ? "parallel_for2d_dynamic" : "parallel_for2d") << " on " << nthr
+                  << " threads: sequence order " << run(by_sequence, dynamic) << " us, heaviest first "
+                  << run(heaviest_first, dynamic) << " us, balanced ranges " << run(balanced, dynamic) << " us"
+                  << std::endl;
+    }
+}
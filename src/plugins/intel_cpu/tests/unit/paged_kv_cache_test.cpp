@@ -0,0 +1,264 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "paged_kv_cache.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "common_test_utils/test_assertions.hpp"
+#include "openvino/core/except.hpp"
+#include "openvino/core/model.hpp"
+#include "openvino/op/paged_attention.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/result.hpp"
+#include "openvino/runtime/make_tensor.hpp"
+#include "openvino/runtime/tensor.hpp"
+#include "unit_test_utils/mocks/openvino/runtime/mock_icompiled_model.hpp"
+#include "unit_test_utils/mocks/openvino/runtime/mock_iplugin.hpp"
+#include "unit_test_utils/mocks/openvino/runtime/mock_isync_infer_request.hpp"
+
+using namespace ov::intel_cpu;
+using namespace ::testing;
+
+namespace {
+
+constexpr size_t block_size = 4;
+constexpr size_t num_blocks = 16;
+
+// the PagedAttention inputs, see PagedAttentionExecutor
+constexpr size_t ID_PAST_LENS = 5;
+constexpr size_t ID_SUBSEQUENCE_BEGINS = 6;
+constexpr size_t ID_BLOCK_INDICES = 7;
+constexpr size_t ID_MAX_CONTEXT_LEN = 12;
+
+std::shared_ptr<ov::Model> make_paged_model() {
+    const std::vector<std::pair<ov::element::Type, ov::PartialShape>> inputs = {
+        {ov::element::f32, {-1, 4}},                 // query
+        {ov::element::f32, {-1, 4}},                 // key
+        {ov::element::f32, {-1, 4}},                 // value
+        {ov::element::f32, {-1, 1, block_size, 4}},  // key_cache
+        {ov::element::f32, {-1, 1, block_size, 4}},  // value_cache
+        {ov::element::i32, {-1}},                    // past_lens
+        {ov::element::i32, {-1}},                    // subsequence_begins
+        {ov::element::i32, {-1}},                    // block_indices
+        {ov::element::i32, {-1}},                    // block_indices_begins
+        {ov::element::f32, {}},                      // scale
+        {ov::element::i32, {}},                      // sliding_window
+        {ov::element::f32, {0}},                     // alibi_slopes
+        {ov::element::i32, {}},                      // max_context_len
+        {ov::element::i32, {-1}},                    // score_aggregation_window
+        {ov::element::i32, {0}},                     // rotated_block_indices
+        {ov::element::i32, {0}},                     // rotation_deltas
+        {ov::element::f32, {0}},                     // rotation_trig_lut
+        {ov::element::f32, {0}},                     // xattention_threshold
+        {ov::element::i32, {}},                      // xattention_block_size
+        {ov::element::i32, {}},                      // xattention_stride
+        {ov::element::f32, {0}},                     // sinks
+        {ov::element::i32, {}},                      // adaptive_rkv_start_size
+        {ov::element::i32, {0}},                     // adaptive_rkv_evictable_sizes
+        {ov::element::i32, {0}},                     // adaptive_rkv_diversity_block_set_indices
+        {ov::element::i32, {0}},                     // adaptive_rkv_diversity_block_set_indices_begins
+    };
+    ov::ParameterVector parameters;
+    ov::OutputVector args;
+    for (const auto& input : inputs) {
+        parameters.push_back(std::make_shared<ov::op::v0::Parameter>(input.first, input.second));
+        parameters.back()->output(0).set_names({"pa_input_" + std::to_string(args.size())});
+        args.push_back(parameters.back());
+    }
+    // the token ids are hashed for the prefix reuse and trimmed along with the other token inputs
+    auto input_ids = std::make_shared<ov::op::v0::Parameter>(ov::element::i64, ov::PartialShape{-1});
+    input_ids->output(0).set_names({"input_ids"});
+    parameters.push_back(input_ids);
+
+    auto paged_attention = std::make_shared<ov::op::PagedAttentionExtension>(args);
+    auto result = std::make_shared<ov::op::v0::Result>(paged_attention->output(0));
+    return std::make_shared<ov::Model>(ov::ResultVector{result}, parameters);
+}
+
+class PagedKVCacheTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        model = make_paged_model();
+        plugin = std::make_shared<ov::MockIPlugin>();
+        std::shared_ptr<const ov::Model> const_model = model;
+        compiled_model = std::make_shared<ov::MockICompiledModel>(const_model, plugin);
+        ON_CALL(*compiled_model, inputs()).WillByDefault(ReturnRefOfCopy(const_model->inputs()));
+        ON_CALL(*compiled_model, outputs()).WillByDefault(ReturnRefOfCopy(const_model->outputs()));
+        cache = std::make_shared<PagedKVCache>(*model, num_blocks, block_size);
+    }
+
+    std::shared_ptr<ov::MockISyncInferRequest> make_request() const {
+        auto request = std::make_shared<ov::MockISyncInferRequest>(compiled_model);
+        // the inputs not managed by the cache are set once, the caches and the block tables are set by prepare
+        for (const auto& input : request->get_inputs()) {
+            auto shape = input.get_partial_shape();
+            for (auto& dim : shape) {
+                if (dim.is_dynamic()) {
+                    dim = 1;
+                }
+            }
+            request->set_tensor(input, ov::make_tensor(input.get_element_type(), shape.to_shape()));
+        }
+        return request;
+    }
+
+    // sets the tokens of the sequences, the key/value/query inputs are not used by the cache and aren't trimmed
+    static void set_tokens(ov::ISyncInferRequest& request,
+                           const std::vector<std::vector<int64_t>>& tokens,
+                           const std::vector<int32_t>& past) {
+        std::vector<int32_t> begins{0};
+        std::vector<int64_t> ids;
+        for (const auto& sequence : tokens) {
+            ids.insert(ids.end(), sequence.begin(), sequence.end());
+            begins.push_back(static_cast<int32_t>(ids.size()));
+        }
+        set_input(request, ID_PAST_LENS, past);
+        set_input(request, ID_SUBSEQUENCE_BEGINS, begins);
+        set_input(request, request.get_inputs().size() - 1, ids);
+    }
+
+    template <typename T>
+    static void set_input(ov::ISyncInferRequest& request, size_t input, const std::vector<T>& values) {
+        ov::Tensor tensor(ov::element::from<T>(), ov::Shape{values.size()});
+        std::copy(values.begin(), values.end(), tensor.data<T>());
+        request.set_tensor(request.get_inputs()[input], ov::get_tensor_impl(tensor));
+    }
+
+    template <typename T>
+    static std::vector<T> get_input(const ov::ISyncInferRequest& request, size_t input) {
+        const auto tensor = ov::make_tensor(request.get_tensor(request.get_inputs()[input]));
+        return {tensor.data<const T>(), tensor.data<const T>() + tensor.get_size()};
+    }
+
+    static std::vector<int64_t> get_input_ids(const ov::ISyncInferRequest& request) {
+        return get_input<int64_t>(request, request.get_inputs().size() - 1);
+    }
+
+    static std::vector<int64_t> make_tokens(size_t count, int64_t start = 0) {
+        std::vector<int64_t> tokens(count);
+        std::iota(tokens.begin(), tokens.end(), start);
+        return tokens;
+    }
+
+    std::shared_ptr<ov::Model> model;
+    std::shared_ptr<ov::MockIPlugin> plugin;
+    std::shared_ptr<ov::MockICompiledModel> compiled_model;
+    std::shared_ptr<PagedKVCache> cache;
+};
+
+}  // namespace
+
+TEST_F(PagedKVCacheTest, PrefixHitTrimsTokenInputs) {
+    const auto prompt = make_tokens(10);
+    auto first = make_request();
+    PagedKVCache::Sequences first_sequences;
+    set_tokens(*first, {prompt}, {0});
+    cache->prepare(*first, first_sequences);
+    ASSERT_EQ(get_input_ids(*first), prompt);
+    ASSERT_EQ(get_input<int32_t>(*first, ID_MAX_CONTEXT_LEN), (std::vector<int32_t>{10}));
+    cache->commit(first_sequences);
+    cache->release(first_sequences);
+
+    // the two full blocks of the prompt are cached, only the rest of it is computed
+    auto second = make_request();
+    PagedKVCache::Sequences second_sequences;
+    set_tokens(*second, {make_tokens(3, 100), prompt}, {0, 0});
+    cache->prepare(*second, second_sequences);
+    ASSERT_EQ(second_sequences.size(), 2);
+    ASSERT_EQ(get_input_ids(*second), (std::vector<int64_t>{100, 101, 102, 8, 9}));
+    ASSERT_EQ(get_input<int32_t>(*second, ID_PAST_LENS), (std::vector<int32_t>{0, 2 * block_size}));
+    ASSERT_EQ(get_input<int32_t>(*second, ID_SUBSEQUENCE_BEGINS), (std::vector<int32_t>{0, 3, 5}));
+    ASSERT_EQ(get_input<int32_t>(*second, ID_BLOCK_INDICES).size(), 4);
+    ASSERT_EQ(cache->get_statistics().hit_tokens, 2 * block_size);
+}
+
+TEST_F(PagedKVCacheTest, ZeroPastRestartsSequence) {
+    auto request = make_request();
+    PagedKVCache::Sequences sequences;
+    set_tokens(*request, {make_tokens(6, 100)}, {0});
+    cache->prepare(*request, sequences);
+    cache->commit(sequences);
+    const auto first_sequence = sequences[0];
+
+    set_tokens(*request, {{106}}, {6});
+    cache->prepare(*request, sequences);
+    ASSERT_EQ(sequences[0], first_sequence);
+    cache->commit(sequences);
+
+    // the past length of zero releases the sequence and starts a new one in its place
+    set_tokens(*request, {make_tokens(3, 200)}, {0});
+    cache->prepare(*request, sequences);
+    ASSERT_NE(sequences[0], first_sequence);
+    ASSERT_EQ(get_input<int32_t>(*request, ID_PAST_LENS), (std::vector<int32_t>{0}));
+    ASSERT_EQ(get_input<int32_t>(*request, ID_BLOCK_INDICES).size(), 1);
+    cache->commit(sequences);
+    cache->release(sequences);
+    ASSERT_TRUE(sequences.empty());
+    ASSERT_EQ(cache->get_statistics().free_blocks + cache->get_statistics().cached_blocks, num_blocks);
+}
+
+TEST_F(PagedKVCacheTest, PastLengthMismatch) {
+    auto request = make_request();
+    PagedKVCache::Sequences sequences;
+    set_tokens(*request, {make_tokens(6)}, {0});
+    cache->prepare(*request, sequences);
+    cache->commit(sequences);
+
+    set_tokens(*request, {{6}}, {5});
+    OV_EXPECT_THROW_HAS_SUBSTRING(cache->prepare(*request, sequences),
+                                  ov::Exception,
+                                  "doesn't match the number of its computed tokens");
+
+    // a batch position without a sequence has no computed tokens
+    set_tokens(*request, {{6}, {7}}, {6, 1});
+    OV_EXPECT_THROW_HAS_SUBSTRING(cache->prepare(*request, sequences),
+                                  ov::Exception,
+                                  "doesn't match the number of its computed tokens");
+}
+
+TEST_F(PagedKVCacheTest, RollbackAfterFailedInference) {
+    const auto prompt = make_tokens(10);
+    auto request = make_request();
+    PagedKVCache::Sequences sequences;
+    set_tokens(*request, {prompt}, {0});
+    cache->prepare(*request, sequences);
+    cache->commit(sequences);
+
+    set_tokens(*request, {{10, 11, 12}}, {10});
+    cache->prepare(*request, sequences);
+    const auto block_indices = get_input<int32_t>(*request, ID_BLOCK_INDICES);
+    // the inference fails, so the appended tokens are not computed
+    cache->rollback(sequences);
+
+    // the inference is repeated with the same inputs
+    OV_ASSERT_NO_THROW(cache->prepare(*request, sequences));
+    ASSERT_EQ(get_input<int32_t>(*request, ID_PAST_LENS), (std::vector<int32_t>{10}));
+    ASSERT_EQ(get_input<int32_t>(*request, ID_SUBSEQUENCE_BEGINS), (std::vector<int32_t>{0, 3}));
+    ASSERT_EQ(get_input<int32_t>(*request, ID_BLOCK_INDICES), block_indices);
+    cache->commit(sequences);
+
+    set_tokens(*request, {{13}}, {13});
+    OV_ASSERT_NO_THROW(cache->prepare(*request, sequences));
+    cache->commit(sequences);
+
+    // a new sequence with a cached prefix is repeated with the trimmed inputs set by the failed prepare
+    auto other = make_request();
+    PagedKVCache::Sequences other_sequences;
+    set_tokens(*other, {prompt}, {0});
+    cache->prepare(*other, other_sequences);
+    cache->rollback(other_sequences);
+    OV_ASSERT_NO_THROW(cache->prepare(*other, other_sequences));
+    ASSERT_EQ(get_input_ids(*other), (std::vector<int64_t>{8, 9}));
+    ASSERT_EQ(get_input<int32_t>(*other, ID_PAST_LENS), (std::vector<int32_t>{2 * block_size}));
+    cache->commit(other_sequences);
+}
@@ -7,6 +7,7 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
+#include "cache/clock_cache.h"
 #include "cache/lru_cache.h"
 #include "cache/multi_cache.h"
 #include "common_test_utils/test_assertions.hpp"
@@ -97,6 +98,105 @@ TEST(LruCacheTests, Empty) {
         ASSERT_EQ(cache.get({i}), int());
     }
 }
+TEST(ClockCacheTests, Put) {
+    constexpr size_t capacity = 10;
+    ClockCache<IntKey, int> cache(capacity);
+    for (size_t i = 0; i < 2 * capacity; ++i) {
+        OV_ASSERT_NO_THROW(cache.put({10}, 10));
+    }
+
+    ASSERT_EQ(cache.get({10}), 10);
+    ASSERT_EQ(cache.getStatistics().size, 1);
+}
+
+TEST(ClockCacheTests, Get) {
+    constexpr int capacity = 10;
+    ClockCache<IntKey, int> cache(capacity);
+    for (int i = 1; i < 2 * capacity; ++i) {
+        OV_ASSERT_NO_THROW(cache.put({i}, i));
+    }
+
+    for (int i = 1; i < capacity; ++i) {
+        ASSERT_EQ(cache.get({i}), int());
+    }
+
+    for (int i = capacity; i < 2 * capacity; ++i) {
+        ASSERT_EQ(cache.get({i}), i);
+    }
+}
+
+TEST(ClockCacheTests, SecondChancePolicy) {
+    constexpr int capacity = 10;
+    ClockCache<IntKey, int> cache(capacity);
+    for (int i = 1; i <= capacity; ++i) {
+        OV_ASSERT_NO_THROW(cache.put({i}, i));
+    }
+
+    // referenced records survive the next clock pass
+    for (int i = 1; i <= capacity / 2; ++i) {
+        ASSERT_EQ(cache.get({i}), i);
+    }
+
+    for (int i = 21; i < 21 + capacity / 2; ++i) {
+        OV_ASSERT_NO_THROW(cache.put({i}, i));
+    }
+
+    for (int i = 1; i <= capacity / 2; ++i) {
+        ASSERT_EQ(cache.get({i}), i);
+    }
+
+    for (int i = capacity / 2 + 1; i <= capacity; ++i) {
+        ASSERT_EQ(cache.get({i}), int());
+    }
+}
+
+TEST(ClockCacheTests, Evict) {
+    constexpr int capacity = 100;
+    ClockCache<IntKey, int> cache(capacity);
+    for (int i = 0; i < capacity; ++i) {
+        OV_ASSERT_NO_THROW(cache.put({i}, i));
+    }
+    OV_ASSERT_NO_THROW(cache.evict(capacity / 2));
+    ASSERT_EQ(cache.getStatistics().size, capacity / 2);
+    OV_ASSERT_NO_THROW(cache.evict(2 * capacity));
+    ASSERT_EQ(cache.getStatistics().size, 0);
+    for (int i = 0; i < capacity; ++i) {
+        ASSERT_EQ(cache.get({i}), int());
+    }
+    OV_ASSERT_NO_THROW(cache.evict(0));
+}
+
+TEST(ClockCacheTests, Empty) {
+    constexpr size_t capacity = 0;
+    constexpr int attempts = 10;
+    ClockCache<IntKey, int> cache(capacity);
+    for (int i = 1; i < attempts; ++i) {
+        OV_ASSERT_NO_THROW(cache.put({i}, i));
+    }
+
+    for (int i = 1; i < attempts; ++i) {
+        ASSERT_EQ(cache.get({i}), int());
+    }
+}
+
+TEST(ClockCacheTests, Statistics) {
+    constexpr int capacity = 1000;
+    ClockCache<IntKey, int> cache(capacity);
+    for (int i = 0; i < capacity; ++i) {
+        ASSERT_EQ(cache.get({i}), int());
+        OV_ASSERT_NO_THROW(cache.put({i}, i));
+    }
+    for (int i = 0; i < capacity; ++i) {
+        cache.get({i});
+    }
+
+    auto statistics = cache.getStatistics();
+    // records evicted by an overflowed shard miss on the second pass
+    ASSERT_EQ(statistics.misses, capacity + statistics.evictions);
+    ASSERT_EQ(statistics.hits + statistics.evictions, capacity);
+    ASSERT_EQ(statistics.size + statistics.evictions, capacity);
+}
+
 namespace {
 template<typename T, typename K>
 class mockBuilder {
@@ -380,3 +480,40 @@ TEST(MultiCacheTests, SmokeTypeIdSync) {
         vecThreads.emplace_back(std::thread(testRoutine, std::ref(vecCache[i])));
     }
 }
+
+TEST(MultiCacheTests, ConcurrentGetOrCreate) {
+    using IntValueType = std::shared_ptr<int>;
+
+    constexpr size_t capacity = 256;
+    constexpr size_t numThreads = 16;
+    constexpr int numKeys = 512;
+    constexpr int iterations = 4;
+
+    auto intBuilder = [&](const IntKey& key) { return std::make_shared<int>(key.data); };
+
+    MultiCache cache(capacity);
+
+    auto testRoutine = [&](size_t seed) {
+        for (int iter = 0; iter < iterations; ++iter) {
+            for (int i = 0; i < numKeys; ++i) {
+                const int key = static_cast<int>((i + seed * 31) % numKeys);
+                auto intResult = cache.getOrCreate(IntKey{key}, intBuilder);
+                ASSERT_NE(intResult.first, IntValueType());
+                ASSERT_EQ(*intResult.first, key);
+            }
+        }
+    };
+
+    {
+        std::vector<ScopedThread> vecThreads;
+        vecThreads.reserve(numThreads);
+        for (size_t i = 0; i < numThreads; ++i) {
+            vecThreads.emplace_back(std::thread(testRoutine, i));
+        }
+    }
+
+    auto statistics = cache.getStatistics();
+    ASSERT_EQ(statistics.hits + statistics.misses, numThreads * numKeys * iterations);
+    ASSERT_LE(statistics.size, capacity);
+    ASSERT_GE(statistics.misses, static_cast<size_t>(numKeys));
+}
@@ -0,0 +1,79 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <memory>
+#include <string>
+
+#include "common_test_utils/common_utils.hpp"
+#include "openvino/core/model.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/parameter.hpp"
+#include "shape_warmup_cache.hpp"
+
+using namespace ov::intel_cpu;
+
+namespace {
+std::shared_ptr<ov::Model> make_model(const ov::PartialShape& shape) {
+    auto a = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, shape);
+    auto b = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{});
+    auto add = std::make_shared<ov::op::v1::Add>(a, b);
+    return std::make_shared<ov::Model>(ov::OutputVector{add}, ov::ParameterVector{a, b}, "warmup");
+}
+
+class ShapeWarmupCacheTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        m_dir = std::filesystem::temp_directory_path() / (ov::test::utils::generateTestFilePrefix() + "_shape_cache");
+        std::filesystem::create_directories(m_dir);
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(m_dir);
+    }
+
+    std::filesystem::path m_dir;
+};
+}  // namespace
+
+TEST_F(ShapeWarmupCacheTest, RecordAndReload) {
+    auto model = make_model({-1, 3, -1});
+    {
+        ShapeWarmupCache cache(m_dir, "model", *model, 16);
+        ASSERT_TRUE(cache.records().empty());
+        ASSERT_TRUE(cache.record({{1, 3, 10}, {}}));
+        ASSERT_TRUE(cache.record({{2, 3, 7}, {}}));
+        ASSERT_FALSE(cache.record({{1, 3, 10}, {}}));
+        cache.flush();
+        ASSERT_TRUE(std::filesystem::exists(cache.path()));
+    }
+
+    ShapeWarmupCache cache(m_dir, "model", *model, 16);
+    auto records = cache.records();
+    ASSERT_EQ(records.size(), 2);
+    ASSERT_EQ(records[0], (ShapeWarmupCache::Record{{1, 3, 10}, {}}));
+    ASSERT_EQ(records[1], (ShapeWarmupCache::Record{{2, 3, 7}, {}}));
+}
+
+TEST_F(ShapeWarmupCacheTest, MaxRecords) {
+    auto model = make_model({-1, 3, -1});
+    ShapeWarmupCache cache(m_dir, "model", *model, 2);
+    ASSERT_TRUE(cache.record({{1, 3, 1}, {}}));
+    ASSERT_TRUE(cache.record({{1, 3, 2}, {}}));
+    ASSERT_FALSE(cache.record({{1, 3, 3}, {}}));
+    ASSERT_EQ(cache.records().size(), 2);
+}
+
+TEST_F(ShapeWarmupCacheTest, ModelId) {
+    auto model = make_model({-1, 3, -1});
+    ShapeWarmupCache cache(m_dir, "model", *model, 16);
+    cache.record({{1, 3, 10}, {}});
+    cache.flush();
+
+    ShapeWarmupCache other_cache(m_dir, "other_model", *model, 16);
+    ASSERT_NE(cache.path(), other_cache.path());
+    ASSERT_TRUE(other_cache.records().empty());
+}
@@ -0,0 +1,40 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <string>
+
+#include "internal_properties.hpp"
+#include "openvino/core/any.hpp"
+#include "weights_cache.hpp"
+
+using namespace ov::intel_cpu;
+
+TEST(WeightsNumaPolicyTests, ParseProperty) {
+    for (auto policy : {WeightsNumaPolicy::BIND, WeightsNumaPolicy::REPLICATE, WeightsNumaPolicy::INTERLEAVE}) {
+        std::stringstream ss;
+        ss << policy;
+        ASSERT_EQ(ov::Any(ss.str()).as<WeightsNumaPolicy>(), policy);
+    }
+    ASSERT_ANY_THROW(ov::Any(std::string("FIRST_TOUCH")).as<WeightsNumaPolicy>());
+}
+
+TEST(SocketsWeightsTests, StoreSelection) {
+    SocketsWeights bind_weights;
+    ASSERT_EQ(bind_weights.forStream(0, 0), bind_weights[0]);
+    ASSERT_EQ(bind_weights[0]->getPolicy(), WeightsNumaPolicy::BIND);
+
+    SocketsWeights replicated_weights(WeightsNumaPolicy::REPLICATE);
+    ASSERT_EQ(replicated_weights.forStream(0, 0), replicated_weights[0]);
+    ASSERT_EQ(replicated_weights[0]->getPolicy(), WeightsNumaPolicy::REPLICATE);
+
+    // a single store is shared by all the streams
+    SocketsWeights interleaved_weights(WeightsNumaPolicy::INTERLEAVE);
+    ASSERT_NE(interleaved_weights[0], nullptr);
+    ASSERT_EQ(interleaved_weights.forStream(1, 3), interleaved_weights[0]);
+    ASSERT_FALSE(WeightsSharing::followsStreamNode(interleaved_weights[0]));
+    ASSERT_TRUE(WeightsSharing::followsStreamNode(nullptr));
+}
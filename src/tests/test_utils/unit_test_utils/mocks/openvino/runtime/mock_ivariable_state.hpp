@@ -20,6 +20,7 @@ public:
     MOCK_METHOD(void, reset, ());
     MOCK_METHOD(void, set_state, (const ov::SoPtr<ov::ITensor>&));
     MOCK_METHOD(ov::SoPtr<ov::ITensor>, get_state, (), (const));
+    MOCK_METHOD(void, offload, (const std::string&));
 };
 
 }  // namespace ov